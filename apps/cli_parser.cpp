@@ -108,7 +108,7 @@ static void print_table(const std::set<std::string>& list, int colw, int coln);
 static void print_btml(const void * buf, unsigned len);
 static void describe_module(unsigned type_id);
 static void print_help(const std::string& what);
-static int cli_cmd(bloc::Parser& p, bloc::Context& ctx, std::list<const bloc::Statement*>& statements);
+static int cli_cmd(bloc::Parser& p, bloc::Context& ctx, std::vector<const bloc::Statement*>& statements);
 
 static breaker_t g_breaker;
 
@@ -141,6 +141,10 @@ void cli_parser(const MainOptions& options, const std::vector<std::string>& args
 
   /* set context as trusted to allow use of restricted plugins */
   ctx.trusted(true);
+  ctx.bytecode(options.bytecode);
+  ctx.optimization(options.optimization);
+  if (options.stack > 0)
+    ctx.stackBudget(size_t(options.stack) * 1024);
   /* setup breaking state */
   g_breaker = { true, &ctx };
 #ifdef LIBBLOC_MSWIN
@@ -165,7 +169,7 @@ void cli_parser(const MainOptions& options, const std::vector<std::string>& args
 
   g_msgdb = new MsgDB();
 
-  std::list<const bloc::Statement*> statements;
+  std::vector<const bloc::Statement*> statements;
   while (p->state() != bloc::Parser::Aborted)
   {
     const bloc::Statement * s = nullptr;
@@ -479,7 +483,7 @@ static bool load_args(bloc::Context& ctx, const std::vector<std::string>& args)
   /* load arguments into the context, as table named $ARG */
   bloc::Collection * c = new bloc::Collection(bloc::Value::type_literal.levelUp());
   for (const std::string& arg : args)
-    c->push_back(bloc::Value(new bloc::Literal(arg)));
+    c->push_back(bloc::Value(bloc::Literal(arg)));
   try
   {
     const bloc::Symbol& symbol = ctx.registerSymbol(std::string("$ARG"), c->table_type());
@@ -570,6 +574,10 @@ static void output_cli(bloc::Context& ctx)
           PRINT(bloc::Value::readableTuple(*(val->tuple())).c_str());
           PRINT("\n");
           break;
+        case bloc::Type::MAPTYPE:
+          PRINT(val->toString().c_str());
+          PRINT("\n");
+          break;
         default:
           /* not printable */
           break;
@@ -846,7 +854,7 @@ static void print_help(const std::string& what)
   }
 }
 
-static int cli_cmd(bloc::Parser& p, bloc::Context& ctx, std::list<const bloc::Statement*>& statements)
+static int cli_cmd(bloc::Parser& p, bloc::Context& ctx, std::vector<const bloc::Statement*>& statements)
 {
   bloc::TokenPtr t = p.front();
   CMD c = find_cmd(p.front()->text);
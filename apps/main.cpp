@@ -28,6 +28,8 @@
 #include <blocc/exception_parse.h>
 #include <blocc/exception_runtime.h>
 #include <blocc/string_reader.h>
+#include <blocc/token_image.h>
+#include <blocc/profiler.h>
 #include <blocc/plugin_manager.h>
 #include <blocc/collection.h>
 #include <blocc/debug.h>
@@ -120,6 +122,10 @@ int main(int argc, char **argv) {
     /* mark the end of expression: could be semi-colon or nl */
     reader.append(";");
     bloc::Context ctx(::fileno(STDOUT), ::fileno(STDERR));
+    ctx.bytecode(options.bytecode);
+    ctx.optimization(options.optimization);
+    if (options.stack > 0)
+      ctx.stackBudget(size_t(options.stack) * 1024);
     bloc::Parser * p = bloc::Parser::createInteractiveParser(ctx, reader);
     bloc::Expression * exp = nullptr;
     try
@@ -172,11 +178,15 @@ int main(int argc, char **argv) {
     bloc::Context ctx(::fileno(outfile), ::fileno(STDERR));
     /* set context as trusted to allow use of restricted plugins */
     ctx.trusted(true);
+    ctx.bytecode(options.bytecode);
+    ctx.optimization(options.optimization);
+    if (options.stack > 0)
+      ctx.stackBudget(size_t(options.stack) * 1024);
 
     /* load arguments 1..n into the context, as table named $ARG */
     bloc::Collection * c_arg = new bloc::Collection(bloc::Value::type_literal.levelUp());
     for (auto it = ++prog.begin(); it != prog.end(); ++it)
-      c_arg->push_back(bloc::Value(new bloc::Literal(std::move(*it))));
+      c_arg->push_back(bloc::Value(bloc::Literal(std::move(*it))));
     try
     {
       const bloc::Symbol& c_sym = ctx.registerSymbol(std::string("$ARG"), c_arg->table_type());
@@ -188,11 +198,41 @@ int main(int argc, char **argv) {
       return EXIT_FAILURE;
     }
 
+    /* the precompiled image is valid until the source changes */
+    bloc::TokenImage image;
+    bloc::TokenImage::Signature sig;
+    std::string image_path;
+    if (prog[0] != "-" && bloc::TokenImage::sign(prog[0], sig))
+      image_path.assign(prog[0]).append(".img");
+    else if (options.compile)
+    {
+      PRINTF("Failed to compile '%s'.\n", prog[0].c_str());
+      return EXIT_FAILURE;
+    }
+
     bloc::Executable * exec = nullptr;
     try
     {
-      ReadFile file(progfile);
-      exec = bloc::Parser::parse(ctx, file);
+      if (options.compile)
+      {
+        ReadFile file(progfile);
+        exec = bloc::Parser::compile(ctx, file, image);
+        if (exec && !image.save(image_path, sig))
+        {
+          PRINTF("Failed to open file '%s' for write.\n", image_path.c_str());
+          delete exec;
+          exec = nullptr;
+        }
+      }
+      else if (!image_path.empty() && image.load(image_path, sig))
+      {
+        exec = bloc::Parser::parse(ctx, image);
+      }
+      else
+      {
+        ReadFile file(progfile);
+        exec = bloc::Parser::parse(ctx, file);
+      }
     }
     catch (bloc::ParseError& pe)
     {
@@ -206,8 +246,13 @@ int main(int argc, char **argv) {
 
     try
     {
-      exec->run();
-      ret = output(exec->context());
+      /* the compiled program won't be run */
+      if (!options.compile)
+      {
+        ctx.profile(options.profile);
+        exec->run();
+        ret = output(exec->context());
+      }
     }
     catch (bloc::RuntimeError& re)
     {
@@ -215,6 +260,9 @@ int main(int argc, char **argv) {
       fprintf(ctx.ctxerr(), "Error: %s\n", re.what());
       fflush(ctx.ctxerr());
     }
+    /* the report refers to the statements, so print it before deleting */
+    if (ctx.profiler())
+      ctx.profiler()->report(ctx.ctxerr());
     delete exec;
   }
 
@@ -256,6 +304,9 @@ static bool output(bloc::Context& ctx)
         case bloc::Type::IMAGINARY:
           ::fputs(bloc::Value::readableImaginary(*(val->imaginary())).c_str(), ctx.ctxout());
           break;
+        case bloc::Type::MAPTYPE:
+          ::fputs(val->toString().c_str(), ctx.ctxout());
+          break;
         default:
           /* not printable */
          break;
@@ -19,6 +19,7 @@
 #include "main_options.h"
 
 #include <cstring>
+#include <cstdlib>
 #include <string>
 #include <vector>
 
@@ -56,6 +57,16 @@ const char * getCmd(char **begin, char **end, MainOptions& options, std::vector<
         options.color = true;
       else if (cmdOption(*it, "--expr", nullptr) || cmdOption(*it, "-e", nullptr))
         options.doexp = true;
+      else if (cmdOption(*it, "--bytecode", nullptr))
+        options.bytecode = true;
+      else if (cmdOption(*it, "--compile", nullptr))
+        options.compile = true;
+      else if (cmdOption(*it, "--profile", nullptr))
+        options.profile = true;
+      else if (cmdOption(*it, "--opt=", nullptr))
+        options.optimization = (unsigned) ::atoi(*it + 6);
+      else if (cmdOption(*it, "--stack=", nullptr))
+        options.stack = (unsigned) ::atoi(*it + 8);
       else if (cmdOption(*it, "--out", &options.file_sout))
         continue;
       else
@@ -30,6 +30,11 @@ struct MainOptions
   bool docli = false;                   /* run CLI, arguments to follow will be loaded into the context */
   bool color = false;                   /* enable colored output */
   bool doexp = false;                   /* execute the expression to follow */
+  bool bytecode = false;                /* lower expressions to bytecode */
+  bool compile = false;                 /* write the image of the program, it won't be run */
+  bool profile = false;                 /* print the profile of the program at exit */
+  unsigned optimization = 1;            /* level of the parse time optimizer, 0 to disable */
+  unsigned stack = 0;                   /* stack budget of the calls in KB, 0 for the default */
   std::string dbg_hints;                /* debug hints */
   std::string file_sout;                /* forward output stream */
 };
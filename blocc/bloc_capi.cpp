@@ -27,13 +27,15 @@
 #include "plugin_manager.h"
 #include "string_reader.h"
 #include "collection.h"
+#include "profiler.h"
 #include "tuple.h"
 #include "value.h"
 #include "debug.h"
 
 #define to_bool(a) (a == bloc_true ? true : false)
 
-static struct { const char * msg; int no; } bloc_error = { "", 0 };
+/* the last error is held per thread, as errno */
+static thread_local struct { const char * msg; int no; } bloc_error = { "", 0 };
 
 const char*
 bloc_strerror() {
@@ -181,6 +183,28 @@ bloc_ctx_trace(bloc_context *ctx)
   return (reinterpret_cast<bloc::Context*>(ctx)->trace() ? bloc_true : bloc_false);
 }
 
+void
+bloc_ctx_enable_profile(bloc_context *ctx, bloc_bool yesno)
+{
+  reinterpret_cast<bloc::Context*>(ctx)->profile(to_bool(yesno));
+}
+
+bloc_bool
+bloc_ctx_profile(bloc_context *ctx)
+{
+  return (reinterpret_cast<bloc::Context*>(ctx)->profile() ? bloc_true : bloc_false);
+}
+
+bloc_bool
+bloc_ctx_profile_report(bloc_context *ctx, FILE *out, unsigned max)
+{
+  bloc::Profiler * profiler = reinterpret_cast<bloc::Context*>(ctx)->profiler();
+  if (!profiler)
+    return bloc_false;
+  profiler->report(out, max);
+  return bloc_true;
+}
+
 void
 bloc_ctx_purge_working_mem(bloc_context *ctx)
 {
@@ -229,6 +253,8 @@ bloc_create_null(bloc_type_major type)
     return reinterpret_cast<bloc_value*>(new bloc::Value(bloc::Value::type_pointer));
   case IMAGINARY:
     return reinterpret_cast<bloc_value*>(new bloc::Value(bloc::Value::type_imaginary));
+  case MAPTYPE:
+    return reinterpret_cast<bloc_value*>(new bloc::Value(bloc::Value::type_maptype));
   default:
    return reinterpret_cast<bloc_value*>(new bloc::Value());
   }
@@ -257,8 +283,7 @@ bloc_create_literal(const char *v)
 {
   if (!v)
     return reinterpret_cast<bloc_value*>(new bloc::Value(bloc::Value::type_literal));
-  bloc::Literal * lv = new bloc::Literal(v);
-  return reinterpret_cast<bloc_value*>(new bloc::Value(lv));
+  return reinterpret_cast<bloc_value*>(new bloc::Value(bloc::Literal(v)));
 }
 
 
@@ -274,10 +299,7 @@ bloc_create_tabchar(const char *v, unsigned len)
 bloc_value*
 bloc_create_imaginary(bloc_pair i)
 {
-  bloc::Imaginary * ii = new bloc::Imaginary;
-  ii->a = i.a;
-  ii->b = i.b;
-  return reinterpret_cast<bloc_value*>(new bloc::Value(ii));
+  return reinterpret_cast<bloc_value*>(new bloc::Value(bloc::Imaginary{i.a, i.b}));
 }
 
 bloc_bool
@@ -293,8 +315,7 @@ bloc_assign_literal(bloc_value *val, const char *v)
       mv->swap(bloc::Value(bloc::Value::type_literal).to_lvalue(mv->lvalue()));
     else
     {
-      bloc::Literal * lv = new bloc::Literal(v);
-      mv->swap(bloc::Value(lv).to_lvalue(mv->lvalue()));
+      mv->swap(bloc::Value(bloc::Literal(v)).to_lvalue(mv->lvalue()));
     }
     return bloc_true;
   }
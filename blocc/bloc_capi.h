@@ -52,6 +52,7 @@ typedef enum
   ROWTYPE,
   POINTER,
   IMAGINARY,
+  MAPTYPE,
 } bloc_type_major;
 
 /**
@@ -262,6 +263,34 @@ bloc_ctx_enable_trace(bloc_context *ctx, bloc_bool yesno);
 LIBBLOC_API bloc_bool
 bloc_ctx_trace(bloc_context *ctx);
 
+/**
+ * Enable or disable the profiler for the context.
+ * Enabling it again discards the collected data.
+ * @param ctx the context
+ * @param yesno `bloc_true` to enable profiling, `bloc_false` to disable
+ */
+LIBBLOC_API void
+bloc_ctx_enable_profile(bloc_context *ctx, bloc_bool yesno);
+
+/**
+ * Query whether profiling is enabled for the context.
+ * @param ctx the context
+ * @return `bloc_true` if profiling is enabled, otherwise `bloc_false`
+ */
+LIBBLOC_API bloc_bool
+bloc_ctx_profile(bloc_context *ctx);
+
+/**
+ * Print the profile collected by the context, sorted by exclusive time.
+ * It must be printed before freeing the profiled executable.
+ * @param ctx the context
+ * @param out the output stream
+ * @param max the maximum count of entries to print, 0 for all
+ * @return `bloc_true` on success, or `bloc_false` if profiling is disabled
+ */
+LIBBLOC_API bloc_bool
+bloc_ctx_profile_report(bloc_context *ctx, FILE *out, unsigned max);
+
 /**
  * Purge the context's working memory used for intermediate results.
  * @param ctx the context
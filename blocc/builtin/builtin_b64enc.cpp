@@ -40,14 +40,14 @@ Value& B64ENCExpression::value(Context & ctx) const
     {
     case Type::LITERAL:
     {
-      v = Value(new Literal());
+      v = Value(Literal());
       Literal * str = arg0.literal();
       b64encode(str->data(), str->size(), *v.literal());
       break;
     }
     case Type::TABCHAR:
     {
-      v = Value(new Literal());
+      v = Value(Literal());
       TabChar * raw = arg0.tabchar();
       b64encode(raw->data(), raw->size(), *v.literal());
       break;
@@ -53,7 +53,7 @@ Value& CEILExpression::value(Context & ctx) const
     else
     {
       Imaginary z = *val.imaginary();
-      v = Value(new Imaginary{std::ceil(z.a), std::ceil(z.b)});
+      v = Value(Imaginary{std::ceil(z.a), std::ceil(z.b)});
     }
     break;
   default:
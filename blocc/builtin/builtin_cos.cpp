@@ -63,7 +63,7 @@ Value& COSExpression::value(Context & ctx) const
     else
     {
       auto z = std::cos(IMAGINARY_TO_COMPLEX(*val.imaginary()));
-      v = Value(new Imaginary{z.real(), z.imag()});
+      v = Value(Imaginary{z.real(), z.imag()});
     }
     break;
   default:
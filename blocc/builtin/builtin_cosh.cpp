@@ -55,7 +55,7 @@ Value& COSHExpression::value(Context & ctx) const
     else
     {
       auto z = std::cosh(IMAGINARY_TO_COMPLEX(*val.imaginary()));
-      v = Value(new Imaginary{z.real(), z.imag()});
+      v = Value(Imaginary{z.real(), z.imag()});
     }
     break;
   default:
@@ -53,7 +53,7 @@ Value& FLOORExpression::value(Context & ctx) const
     else
     {
       Imaginary z = *val.imaginary();
-      v = Value(new Imaginary{std::floor(z.a), std::floor(z.b)});
+      v = Value(Imaginary{std::floor(z.a), std::floor(z.b)});
     }
     break;
   default:
@@ -44,7 +44,7 @@ Value& GETENVExpression::value(Context & ctx) const
     {
       const char * buf = ::getenv(val.literal()->c_str());
       if (buf != nullptr)
-      v = Value(new Literal(buf));
+      v = Value(Literal(buf));
     }
     break;
   default:
@@ -64,23 +64,23 @@ Value& GETSYSExpression::value(Context & ctx) const
     else if (*(val.literal()) == "compatible")
       v = Value(Integer(Context::compatible()));
     else if (*(val.literal()) == "language")
-      v = Value(new Literal(Context::language()));
+      v = Value(Literal(Context::language()));
     else if (*(val.literal()) == "country")
-      v = Value(new Literal(Context::country()));
+      v = Value(Literal(Context::country()));
     else if (*(val.literal()) == "integer_max")
       v = Value(Integer(INT64_MAX));
     else if (*(val.literal()) == "integer_min")
       v = Value(Integer(INT64_MIN));
     else if (*(val.literal()) == "system")
 #if defined(LIBBLOC_MSWIN)
-      v = Value(new Literal("MSWIN"));
+      v = Value(Literal("MSWIN"));
 #elif defined(LIBBLOC_UNIX)
-      v = Value(new Literal("UNIX"));
+      v = Value(Literal("UNIX"));
 #else
       v = Value(Value::type_literal);
 #endif
     else if (*(val.literal()) == "endianess")
-      v = Value(new Literal((machine_bom == BIG_ENDIAN ? "BE" : "LE")));
+      v = Value(Literal((machine_bom == BIG_ENDIAN ? "BE" : "LE")));
     else
       throw RuntimeError(EXC_RT_NOT_IMPLEMENTED);
     break;
@@ -79,10 +79,10 @@ Value& HEXExpression::value(Context & ctx) const
     switch (arg0.type().major())
     {
     case Type::INTEGER:
-      v = Value(new Literal(hex(*arg0.integer(), n)));
+      v = Value(Literal(hex(*arg0.integer(), n)));
       break;
     case Type::NUMERIC:
-      v = Value(new Literal(hex(Integer(*arg0.numeric()), n)));
+      v = Value(Literal(hex(Integer(*arg0.numeric()), n)));
       break;
     default:
       throw RuntimeError(EXC_RT_FUNC_ARG_TYPE_S, KEYWORDS[FUNC_HEX]);
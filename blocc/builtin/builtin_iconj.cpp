@@ -40,7 +40,7 @@ Value& ICONJExpression::value(Context & ctx) const
   case Type::IMAGINARY:
     if (val.isNull())
       return val;
-    v = Value(new Imaginary{val.imaginary()->a, - val.imaginary()->b});
+    v = Value(Imaginary{val.imaginary()->a, - val.imaginary()->b});
     break;
   default:
     throw RuntimeError(EXC_RT_FUNC_ARG_TYPE_S, KEYWORDS[oper]);
@@ -35,7 +35,7 @@ public:
 
   virtual ~IIExpression() { }
 
-  IIExpression() : BuiltinExpression(FUNC_II), v(new Imaginary{0, 1}) { v.to_lvalue(true); }
+  IIExpression() : BuiltinExpression(FUNC_II), v(Imaginary{0, 1}) { v.to_lvalue(true); }
 
   const Type& type(Context& ctx) const override { return Value::type_imaginary; }
 
@@ -55,7 +55,7 @@ Value& INPUTExpression::value(Context & ctx) const
     /* discard nl */
     if (buf[l - 1] == '\n')
       --l;
-    a0.swap(Value(new Literal(buf, l)).to_lvalue(a0.lvalue()));
+    a0.swap(Value(Literal(buf, l)).to_lvalue(a0.lvalue()));
   }
   return ctx.allocate(Value(Bool(n > 0 ? true : false)));
 }
@@ -75,6 +75,7 @@ INPUTExpression * INPUTExpression::parse(Parser& p, Context& ctx)
       throw ParseError(EXC_PARSE_FUNC_ARG_TYPE_S, KEYWORDS[FUNC_INPUT], t);
     if (ctx.getSymbol(args.back()->symbolId()).locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, ctx.getSymbol(args.back()->symbolId()).name().c_str(), t);
+    ctx.symbolWritten(args.back()->symbolId());
     if (p.front()->code == Parser::Chain)
     {
       t = p.pop();
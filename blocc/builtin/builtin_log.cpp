@@ -63,7 +63,7 @@ Value& LOGExpression::value(Context & ctx) const
     else
     {
       auto z = std::log(IMAGINARY_TO_COMPLEX(*val.imaginary()));
-      v = Value(new Imaginary{z.real(), z.imag()});
+      v = Value(Imaginary{z.real(), z.imag()});
     }
     break;
   default:
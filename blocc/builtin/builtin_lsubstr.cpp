@@ -66,7 +66,7 @@ Value& LSUBSTRExpression::value(Context & ctx) const
       return val;
     a = std::max<int64_t>(std::min<int64_t>(b, c), 0L);
     if (val.lvalue())
-      return ctx.allocate(Value(new Literal(val.literal()->substr(0, a))));
+      return ctx.allocate(Value(Literal(val.literal()->substr(0, a))));
     val.literal()->assign(val.literal()->substr(0, a));
     return val;
   }
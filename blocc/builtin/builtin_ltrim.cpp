@@ -49,12 +49,12 @@ Value& LTRIMExpression::value(Context& ctx) const
     if (a < c)
     {
       if (val.lvalue())
-        return ctx.allocate(Value(new Literal(rv->substr(a))));
+        return ctx.allocate(Value(Literal(rv->substr(a))));
       val.literal()->assign(rv->substr(a));
       return val;
     }
     if (val.lvalue())
-      return ctx.allocate(Value(new Literal()));
+      return ctx.allocate(Value(Literal()));
     val.literal()->clear();
     return val;
   }
@@ -0,0 +1,87 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "builtin_map.h"
+#include <blocc/parse_expression.h>
+#include <blocc/exception_parse.h>
+#include <blocc/context.h>
+#include <blocc/parser.h>
+#include <blocc/hashmap.h>
+#include <blocc/debug.h>
+
+namespace bloc
+{
+
+const Type& MAPExpression::type(Context& ctx) const
+{
+  /* the map of undefined structure when a type is opaque */
+  _type_volatile = HashMap::make_type(_args[0]->type(ctx), _args[1]->type(ctx));
+  return _type_volatile;
+}
+
+Value& MAPExpression::value(Context & ctx) const
+{
+  const Type key_type = _args[0]->value(ctx).type();
+  const Type value_type = _args[1]->value(ctx).type();
+  /* cannot be opaque */
+  if (key_type == Type::NO_TYPE || value_type == Type::NO_TYPE)
+    throw RuntimeError(EXC_RT_COMPOUND_OPAQUE);
+  if (!HashMap::supported_key(key_type) || !HashMap::supported_value(value_type))
+    throw RuntimeError(EXC_RT_FUNC_ARG_TYPE_S, KEYWORDS[FUNC_MAP]);
+  return ctx.allocate(Value(new HashMap(HashMap::make_type(key_type, value_type))));
+}
+
+std::string MAPExpression::typeName(Context& ctx) const
+{
+  return HashMap::mapName(type(ctx));
+}
+
+MAPExpression * MAPExpression::parse(Parser& p, Context& ctx)
+{
+  std::vector<Expression*> args;
+
+  try
+  {
+    TokenPtr t = p.pop();
+    if (t->code != '(')
+      throw ParseError(EXC_PARSE_FUNC_ARG_NUM_S, KEYWORDS[FUNC_MAP], t);
+    args.push_back(ParseExpression::expression(p, ctx));
+    const Type& a_type = args.back()->type(ctx);
+    if (a_type != Type::NO_TYPE && !HashMap::supported_key(a_type))
+      throw ParseError(EXC_PARSE_FUNC_ARG_TYPE_S, KEYWORDS[FUNC_MAP], t);
+    t = p.pop();
+    if (t->code != Parser::Chain)
+      throw ParseError(EXC_PARSE_FUNC_ARG_NUM_S, KEYWORDS[FUNC_MAP], t);
+    args.push_back(ParseExpression::expression(p, ctx));
+    const Type& b_type = args.back()->type(ctx);
+    if (b_type != Type::NO_TYPE && !HashMap::supported_value(b_type))
+      throw ParseError(EXC_PARSE_FUNC_ARG_TYPE_S, KEYWORDS[FUNC_MAP], t);
+    assertClosedFunction(p, ctx, FUNC_MAP);
+    return new MAPExpression(std::move(args));
+  }
+  catch (ParseError& pe)
+  {
+    DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    for (Expression * e : args)
+      delete e;
+    throw;
+  }
+  return nullptr;
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BUILTIN_MAP_H_
+#define BUILTIN_MAP_H_
+
+#include <blocc/expression_builtin.h>
+
+namespace bloc
+{
+
+class Context;
+class Parser;
+
+class MAPExpression : public BuiltinExpression {
+
+  mutable Type _type_volatile;
+
+public:
+
+  virtual ~MAPExpression() { }
+
+  explicit MAPExpression(std::vector<Expression*>&& args) : BuiltinExpression(FUNC_MAP, std::move(args)) { }
+
+  const Type& type(Context& ctx) const override;
+
+  Value& value(Context& ctx) const override;
+
+  std::string typeName(Context& ctx) const override;
+
+  static MAPExpression * parse(Parser& p, Context& ctx);
+};
+
+}
+
+#endif /* BUILTIN_MAP_H_ */
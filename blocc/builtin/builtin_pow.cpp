@@ -91,7 +91,7 @@ Value& POWExpression::value(Context & ctx) const
       if (a2.isNull() || a1.isNull())
         return LVAL2(Value(Value::type_imaginary), a1, a2);
       auto z = std::pow(Numeric(*a1.integer()), IMAGINARY_TO_COMPLEX(*a2.imaginary()));
-      Value val(new Imaginary{z.real(), z.imag()});
+      Value val(Imaginary{z.real(), z.imag()});
       return LVAL2(val, a1, a2);
     }
     default:
@@ -122,7 +122,7 @@ Value& POWExpression::value(Context & ctx) const
       if (a2.isNull() || a1.isNull())
         return LVAL2(Value(Value::type_imaginary), a1, a2);
       auto z = std::pow(*a1.numeric(), IMAGINARY_TO_COMPLEX(*a2.imaginary()));
-      Value val(new Imaginary{z.real(), z.imag()});
+      Value val(Imaginary{z.real(), z.imag()});
       return LVAL2(val, a1, a2);
     }
     default:
@@ -139,7 +139,7 @@ Value& POWExpression::value(Context & ctx) const
       if (a2.isNull() || a1.isNull())
         return LVAL2(Value(Value::type_imaginary), a1, a2);
       auto z = std::pow(IMAGINARY_TO_COMPLEX(*a1.imaginary()), Numeric(*a2.integer()));
-      Value val(new Imaginary{z.real(), z.imag()});
+      Value val(Imaginary{z.real(), z.imag()});
       return LVAL2(val, a1, a2);
     }
     case Type::NUMERIC:
@@ -147,7 +147,7 @@ Value& POWExpression::value(Context & ctx) const
       if (a2.isNull() || a1.isNull())
         return LVAL2(Value(Value::type_imaginary), a1, a2);
       auto z = std::pow(IMAGINARY_TO_COMPLEX(*a1.imaginary()), *a2.numeric());
-      Value val(new Imaginary{z.real(), z.imag()});
+      Value val(Imaginary{z.real(), z.imag()});
       return LVAL2(val, a1, a2);
     }
     case Type::IMAGINARY:
@@ -155,7 +155,7 @@ Value& POWExpression::value(Context & ctx) const
       if (a2.isNull() || a1.isNull())
         return LVAL2(Value(Value::type_imaginary), a1, a2);
       auto z = std::pow(IMAGINARY_TO_COMPLEX(*a1.imaginary()), IMAGINARY_TO_COMPLEX(*a2.imaginary()));
-      Value val(new Imaginary{z.real(), z.imag()});
+      Value val(Imaginary{z.real(), z.imag()});
       return LVAL2(val, a1, a2);
     }
     default:
@@ -29,7 +29,7 @@ namespace bloc
 Value& RANDOMExpression::value(Context & ctx) const
 {
   if (_args.empty())
-    return ctx.allocate(Value(Numeric(Context::random(1.0))));
+    return ctx.allocate(Value(Numeric(ctx.random(1.0))));
   else
   {
     Value& val = _args[0]->value(ctx);
@@ -48,8 +48,8 @@ Value& RANDOMExpression::value(Context & ctx) const
       throw RuntimeError(EXC_RT_FUNC_ARG_TYPE_S, KEYWORDS[oper]);
     }
     if (val.lvalue())
-      return ctx.allocate(Value(Numeric(Context::random(d))));
-    val.swap(Value(Numeric(Context::random(d))));
+      return ctx.allocate(Value(Numeric(ctx.random(d))));
+    val.swap(Value(Numeric(ctx.random(d))));
     return val;
   }
 }
@@ -58,7 +58,7 @@ Value& READExpression::value(Context & ctx) const
       if (a0.type() == Type::TABCHAR)
         a0.swap(Value(new TabChar(buf, buf + n)).to_lvalue(a0.lvalue()));
       else if (a0.type() == Type::LITERAL)
-        a0.swap(Value(new Literal(buf, n)).to_lvalue(a0.lvalue()));
+        a0.swap(Value(Literal(buf, n)).to_lvalue(a0.lvalue()));
       else
       {
         delete [] buf;
@@ -76,7 +76,7 @@ Value& READExpression::value(Context & ctx) const
       if (a0.type() == Type::TABCHAR)
         a0.swap(Value(new TabChar(buf, buf + n)).to_lvalue(a0.lvalue()));
       else if (a0.type() == Type::LITERAL)
-        a0.swap(Value(new Literal(buf, n)).to_lvalue(a0.lvalue()));
+        a0.swap(Value(Literal(buf, n)).to_lvalue(a0.lvalue()));
       else
         throw RuntimeError(EXC_RT_TYPE_MISMATCH_S, Type::STR_LITERAL);
     }
@@ -107,6 +107,7 @@ READExpression * READExpression::parse(Parser& p, Context& ctx)
     /* check constness */
     if (ctx.getSymbol(args.back()->symbolId()).locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, ctx.getSymbol(args.back()->symbolId()).name().c_str(), t);
+    ctx.symbolWritten(args.back()->symbolId());
     if (p.front()->code == Parser::Chain)
     {
       t = p.pop();
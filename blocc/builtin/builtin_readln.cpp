@@ -47,7 +47,7 @@ Value& READLNExpression::value(Context & ctx) const
     if (a0.type() == Type::TABCHAR)
       a0.swap(Value(new TabChar(buf, buf + n)).to_lvalue(a0.lvalue()));
     else if (a0.type() == Type::LITERAL)
-      a0.swap(Value(new Literal(buf, n)).to_lvalue(a0.lvalue()));
+      a0.swap(Value(Literal(buf, n)).to_lvalue(a0.lvalue()));
     else
       throw RuntimeError(EXC_RT_TYPE_MISMATCH_S, Type::STR_LITERAL);
   }
@@ -77,6 +77,7 @@ READLNExpression * READLNExpression::parse(Parser& p, Context& ctx)
     /* check constness */
     if (ctx.getSymbol(args.back()->symbolId()).locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, ctx.getSymbol(args.back()->symbolId()).name().c_str(), t);
+    ctx.symbolWritten(args.back()->symbolId());
     assertClosedFunction(p, ctx, FUNC_READLN);
     return new READLNExpression(std::move(args));
   }
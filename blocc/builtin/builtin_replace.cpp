@@ -60,22 +60,22 @@ Value& REPLACEExpression::value(Context & ctx) const
     default:
       throw RuntimeError(EXC_RT_FUNC_ARG_TYPE_S, KEYWORDS[oper]);
     }
-    Literal * tmp = new Literal();
+    Literal tmp;
     size_t p = 0;
     while (p < val.literal()->size())
     {
       size_t e = val.literal()->find(*a1.literal(), p);
-      tmp->append(*val.literal(), p, e - p);
+      tmp.append(*val.literal(), p, e - p);
       if (e != std::string::npos)
       {
         if (!a2.isNull())
-          tmp->append(*a2.literal());
+          tmp.append(*a2.literal());
         p = e + a1.literal()->size();
       }
       else
         p = e;
     }
-    v = Value(tmp);
+    v = Value(std::move(tmp));
     break;
   }
   default:
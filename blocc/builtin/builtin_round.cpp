@@ -73,7 +73,7 @@ Value& ROUNDExpression::value(Context & ctx) const
       else
       {
         Imaginary z = *val.imaginary();
-        v = Value(new Imaginary{std::floor(z.a * d + 0.5) / d, std::floor(z.b * d + 0.5) / d});
+        v = Value(Imaginary{std::floor(z.a * d + 0.5) / d, std::floor(z.b * d + 0.5) / d});
       }
       break;
     default:
@@ -107,7 +107,7 @@ Value& ROUNDExpression::value(Context & ctx) const
       else
       {
         Imaginary z = *val.imaginary();
-        v = Value(new Imaginary{std::floor(z.a + 0.5), std::floor(z.b + 0.5)});
+        v = Value(Imaginary{std::floor(z.a + 0.5), std::floor(z.b + 0.5)});
       }
       break;
     default:
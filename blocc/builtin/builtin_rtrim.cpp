@@ -48,12 +48,12 @@ Value& RTRIMExpression::value(Context & ctx) const
     if (a >= 0)
     {
       if (val.lvalue())
-        return ctx.allocate(Value(new Literal(rv->substr(0, a + 1))));
+        return ctx.allocate(Value(Literal(rv->substr(0, a + 1))));
       val.literal()->assign(rv->substr(0, a + 1));
       return val;
     }
     if (val.lvalue())
-      return ctx.allocate(Value(new Literal()));
+      return ctx.allocate(Value(Literal()));
     val.literal()->clear();
     return val;
   }
@@ -38,20 +38,20 @@ Value& STRExpression::value(Context & ctx) const
     switch (val.type().major())
     {
     case Type::BOOLEAN:
-      v = Value(new Literal(Value::readableBoolean(*val.boolean())));
+      v = Value(Literal(Value::readableBoolean(*val.boolean())));
       break;
     case Type::INTEGER:
-      v = Value(new Literal(Value::readableInteger(*val.integer())));
+      v = Value(Literal(Value::readableInteger(*val.integer())));
       break;
     case Type::NUMERIC:
-      v = Value(new Literal(Value::readableNumeric(*val.numeric())));
+      v = Value(Literal(Value::readableNumeric(*val.numeric())));
       break;
     case Type::LITERAL:
       if (val.lvalue())
         return ctx.allocate(val.clone());
       return val;
     case Type::TABCHAR:
-      v = Value(new Literal(val.tabchar()->data(), val.tabchar()->size()));
+      v = Value(Literal(val.tabchar()->data(), val.tabchar()->size()));
       break;
     default:
       throw RuntimeError(EXC_RT_FUNC_ARG_TYPE_S, KEYWORDS[FUNC_STR]);
@@ -80,6 +80,7 @@ STRExpression * STRExpression::parse(Parser& p, Context& ctx)
       {
       case Type::COMPLEX:
       case Type::ROWTYPE:
+      case Type::MAPTYPE:
         throw ParseError(EXC_PARSE_FUNC_ARG_TYPE_S, KEYWORDS[FUNC_STR], t);
       default:
         break;
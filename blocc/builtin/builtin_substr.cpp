@@ -91,12 +91,12 @@ Value& SUBSTRExpression::value(Context & ctx) const
     if (a >= 0 && b > 0)
     {
       if (val.lvalue())
-        return ctx.allocate(Value(new Literal(val.literal()->substr(a, b))));
+        return ctx.allocate(Value(Literal(val.literal()->substr(a, b))));
       val.literal()->assign(val.literal()->substr(a, b));
       return val;
     }
     if (val.lvalue())
-      return ctx.allocate(Value(new Literal()));
+      return ctx.allocate(Value(Literal()));
     val.literal()->clear();
     return val;
   }
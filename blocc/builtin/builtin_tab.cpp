@@ -24,6 +24,7 @@
 #include <blocc/plugin_manager.h>
 #include <blocc/collection.h>
 #include <blocc/tuple.h>
+#include <blocc/hashmap.h>
 #include <blocc/debug.h>
 
 namespace bloc
@@ -95,6 +96,8 @@ std::string TABExpression::typeName(Context& ctx) const
     return type(ctx).typeName(PluginManager::instance().plugged(type(ctx).minor()).interface.name);
   case Type::ROWTYPE:
     return type(ctx).typeName(tuple_decl(ctx).tupleName());
+  case Type::MAPTYPE:
+    return type(ctx).typeName(HashMap::mapName(type(ctx)));
   default:
     return type(ctx).typeName();
   }
@@ -130,6 +133,7 @@ TABExpression * TABExpression::parse(Parser& p, Context& ctx)
       case Type::COMPLEX:
       case Type::TABCHAR:
       case Type::ROWTYPE:
+      case Type::MAPTYPE:
         break;
       default:
         throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[FUNC_TAB], t);
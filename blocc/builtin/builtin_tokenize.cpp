@@ -131,7 +131,7 @@ Collection * TOKENIZEExpression::tokenize(const std::string& str, const std::str
       // trim null token
       if (!trimnull || !token.empty())
       {
-        tokens->push_back(Value(new Literal(std::move(token))));
+        tokens->push_back(Value(Literal(std::move(token))));
         token.clear();
       }
       pos += lsep;
@@ -143,7 +143,7 @@ Collection * TOKENIZEExpression::tokenize(const std::string& str, const std::str
     }
   }
   if (!trimnull || !token.empty())
-    tokens->push_back(Value(new Literal(std::move(token))));
+    tokens->push_back(Value(Literal(std::move(token))));
   return tokens;
 }
 
@@ -50,11 +50,11 @@ Value& TRIMExpression::value(Context & ctx) const
       b = rv->size() - 1;
       while (b >= 0 && rv->at(b) == ' ') --b;
       if (b < 0)
-        return ctx.allocate(Value(new Literal()));
+        return ctx.allocate(Value(Literal()));
       c = rv->size();
       a = 0;
       while (a < c && rv->at(a) == ' ') ++a;
-      return ctx.allocate(Value(new Literal(rv->substr(a, b - a + 1))));
+      return ctx.allocate(Value(Literal(rv->substr(a, b - a + 1))));
     }
     else
     {
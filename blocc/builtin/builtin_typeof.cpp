@@ -33,14 +33,14 @@ Value& TYPEOFExpression::value(Context & ctx) const
   if (val.lvalue())
   {
     if (type.level() > 0)
-      return ctx.allocate(Value(new Literal("TABLE")));
+      return ctx.allocate(Value(Literal("TABLE")));
     else
-      return ctx.allocate(Value(new Literal(Type::typeName(type.major()))));
+      return ctx.allocate(Value(Literal(Type::typeName(type.major()))));
   }
   if (type.level() > 0)
-    val.swap(Value(new Literal("TABLE")));
+    val.swap(Value(Literal("TABLE")));
   else
-    val.swap(Value(new Literal(Type::typeName(type.major()))));
+    val.swap(Value(Literal(Type::typeName(type.major()))));
   return val;
 }
 
@@ -44,9 +44,10 @@ Value& UPPERExpression::value(Context & ctx) const
       return val;
     if (val.lvalue())
     {
-      Literal * tmp = new Literal(*val.literal());
-      std::transform(tmp->begin(), tmp->end(), tmp->begin(), ::toupper);
-      return ctx.allocate(Value(tmp));
+      Value tmp(*val.literal());
+      Literal * str = tmp.literal();
+      std::transform(str->begin(), str->end(), str->begin(), ::toupper);
+      return ctx.allocate(std::move(tmp));
     }
     std::transform(val.literal()->begin(), val.literal()->end(), val.literal()->begin(), ::toupper);
     return val;
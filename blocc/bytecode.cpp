@@ -0,0 +1,499 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "bytecode.h"
+#include "context.h"
+#include "expression.h"
+#include "expression_operator.h"
+#include "expression_variable.h"
+#include "exception_runtime.h"
+
+#include <cmath>
+
+namespace bloc
+{
+
+unsigned Bytecode::push(uint8_t code, unsigned r0, unsigned r1, unsigned r2, unsigned arg)
+{
+  Instruction i;
+  i.code = code;
+  i.r0 = (uint8_t) r0;
+  i.r1 = (uint8_t) r1;
+  i.r2 = (uint8_t) r2;
+  i.arg = arg;
+  _code.push_back(i);
+  return (unsigned) (_code.size() - 1);
+}
+
+bool Bytecode::emit(Context& ctx, const Expression * exp, unsigned r)
+{
+  if (r >= max_registers)
+    return false;
+  if (r >= _nreg)
+    _nreg = r + 1;
+
+  /* constant */
+  if (exp->isConst())
+  {
+    Value& v = exp->value(ctx);
+    if (v.isNull() || v.type().level() != 0)
+      return false;
+    Register k;
+    k.type = v.type().major();
+    switch (k.type)
+    {
+    case Type::BOOLEAN:
+      k.v.b = *v.boolean();
+      break;
+    case Type::INTEGER:
+      k.v.i = *v.integer();
+      break;
+    case Type::NUMERIC:
+      k.v.d = *v.numeric();
+      break;
+    default:
+      return false;
+    }
+    push(BC_LOADK, r, 0, 0, (unsigned) _consts.size());
+    _consts.push_back(k);
+    return true;
+  }
+
+  /* variable */
+  const VariableExpression * var = dynamic_cast<const VariableExpression*>(exp);
+  if (var)
+  {
+    push(BC_LOADV, r, 0, 0, var->symbolId());
+    return true;
+  }
+
+  /* operator */
+  const OperatorExpression * op = dynamic_cast<const OperatorExpression*>(exp);
+  if (op == nullptr)
+    return false;
+
+  uint8_t code;
+  switch (op->oper())
+  {
+  case Operator::OP_ADD: code = BC_ADD; break;
+  case Operator::OP_SUB: code = BC_SUB; break;
+  case Operator::OP_MUL: code = BC_MUL; break;
+  case Operator::OP_DIV: code = BC_DIV; break;
+  case Operator::OP_MOD: code = BC_MOD; break;
+  case Operator::OP_EXP: code = BC_EXP; break;
+  case Operator::OP_AND: code = BC_AND; break;
+  case Operator::OP_IOR: code = BC_IOR; break;
+  case Operator::OP_XOR: code = BC_XOR; break;
+  case Operator::OP_POP: code = BC_POP; break;
+  case Operator::OP_PUS: code = BC_PUS; break;
+  case Operator::OP_EQ: code = BC_EQ; break;
+  case Operator::OP_NE: code = BC_NE; break;
+  case Operator::OP_LT: code = BC_LT; break;
+  case Operator::OP_LE: code = BC_LE; break;
+  case Operator::OP_GT: code = BC_GT; break;
+  case Operator::OP_GE: code = BC_GE; break;
+  case Operator::OP_BXOR: code = BC_BXOR; break;
+
+  /* unary */
+  case Operator::OP_NEG:
+  case Operator::OP_POS:
+  case Operator::OP_NOT:
+  case Operator::OP_BNOT:
+    if (!emit(ctx, op->operand1(), r))
+      return false;
+    switch (op->oper())
+    {
+    case Operator::OP_NEG: code = BC_NEG; break;
+    case Operator::OP_POS: code = BC_POS; break;
+    case Operator::OP_NOT: code = BC_NOT; break;
+    default: code = BC_BNOT; break;
+    }
+    push(code, r, r, 0);
+    return true;
+
+  /* short-circuit */
+  case Operator::OP_BAND:
+  case Operator::OP_BIOR:
+  {
+    if (!emit(ctx, op->operand1(), r))
+      return false;
+    unsigned j = push((op->oper() == Operator::OP_BAND ? BC_JMPF : BC_JMPT), 0, r, 0);
+    if (!emit(ctx, op->operand2(), r + 1))
+      return false;
+    push(BC_MOVB, r, r + 1, 0);
+    _code[j].arg = (unsigned) _code.size();
+    return true;
+  }
+
+  default:
+    return false;
+  }
+
+  /* binary */
+  if (!emit(ctx, op->operand1(), r) || !emit(ctx, op->operand2(), r + 1))
+    return false;
+  push(code, r, r, r + 1);
+  return true;
+}
+
+Bytecode * Bytecode::compile(Context& ctx, const Expression * exp)
+{
+  Bytecode * bc = new Bytecode();
+  if (!bc->emit(ctx, exp, 0))
+  {
+    delete bc;
+    return nullptr;
+  }
+  bc->push(BC_RET, 0, 0, 0);
+  return bc;
+}
+
+#define IS_NUM(R)   ((R).type == Type::INTEGER || (R).type == Type::NUMERIC)
+#define TO_NUM(R)   ((R).type == Type::INTEGER ? Numeric((R).v.i) : (R).v.d)
+
+/*
+ * The dispatch uses a table of labels when the compiler supports it, else a
+ * switch in a loop. Leaving the fast path simply returns null.
+ */
+#if defined(__GNUC__)
+#define VM_BEGIN()    goto *dispatch[pc->code];
+#define VM_CASE(x)    L_##x:
+#define VM_NEXT()     { ++pc; goto *dispatch[pc->code]; }
+#define VM_JUMP(n)    { pc = base + (n); goto *dispatch[pc->code]; }
+#define VM_END()
+#else
+#define VM_BEGIN()    for (;;) switch (pc->code) {
+#define VM_CASE(x)    case BC_##x:
+#define VM_NEXT()     { ++pc; continue; }
+#define VM_JUMP(n)    { pc = base + (n); continue; }
+#define VM_END()      default: return nullptr; }
+#endif
+
+#define VM_ARITH(OP)                                                    \
+  {                                                                     \
+    const Register& a = reg[pc->r1];                                    \
+    const Register& b = reg[pc->r2];                                    \
+    Register& d = reg[pc->r0];                                          \
+    if (a.type == Type::INTEGER && b.type == Type::INTEGER)             \
+    {                                                                   \
+      d.v.i = a.v.i OP b.v.i;                                           \
+      d.type = Type::INTEGER;                                           \
+    }                                                                   \
+    else if (IS_NUM(a) && IS_NUM(b))                                    \
+    {                                                                   \
+      d.v.d = TO_NUM(a) OP TO_NUM(b);                                   \
+      d.type = Type::NUMERIC;                                           \
+    }                                                                   \
+    else                                                                \
+      return nullptr;                                                   \
+  }
+
+#define VM_BITWISE(OP)                                                  \
+  {                                                                     \
+    const Register& a = reg[pc->r1];                                    \
+    const Register& b = reg[pc->r2];                                    \
+    if (a.type != Type::INTEGER || b.type != Type::INTEGER)             \
+      return nullptr;                                                   \
+    reg[pc->r0].v.i = a.v.i OP b.v.i;                                   \
+    reg[pc->r0].type = Type::INTEGER;                                   \
+  }
+
+#define VM_COMPARE(OP)                                                  \
+  {                                                                     \
+    const Register& a = reg[pc->r1];                                    \
+    const Register& b = reg[pc->r2];                                    \
+    Bool r;                                                             \
+    if (a.type == Type::INTEGER && b.type == Type::INTEGER)             \
+      r = (a.v.i OP b.v.i);                                             \
+    else if (IS_NUM(a) && IS_NUM(b))                                    \
+      r = (TO_NUM(a) OP TO_NUM(b));                                     \
+    else                                                                \
+      return nullptr;                                                   \
+    reg[pc->r0].v.b = r;                                                \
+    reg[pc->r0].type = Type::BOOLEAN;                                   \
+  }
+
+#define VM_EQUALITY(OP, MISMATCH)                                       \
+  {                                                                     \
+    const Register& a = reg[pc->r1];                                    \
+    const Register& b = reg[pc->r2];                                    \
+    Bool r;                                                             \
+    if (a.type == Type::BOOLEAN || b.type == Type::BOOLEAN)             \
+      r = (a.type == b.type ? (a.v.b OP b.v.b) : MISMATCH);             \
+    else if (a.type == Type::INTEGER && b.type == Type::INTEGER)        \
+      r = (a.v.i OP b.v.i);                                             \
+    else                                                                \
+      r = (TO_NUM(a) OP TO_NUM(b));                                     \
+    reg[pc->r0].v.b = r;                                                \
+    reg[pc->r0].type = Type::BOOLEAN;                                   \
+  }
+
+Value * Bytecode::execute(Context& ctx) const
+{
+  Register reg[max_registers];
+  const Instruction * base = _code.data();
+  const Instruction * pc = base;
+
+#if defined(__GNUC__)
+  /* must follow the order of enum OPCODE */
+  static const void * dispatch[] = {
+    &&L_LOADK, &&L_LOADV, &&L_ADD, &&L_SUB, &&L_MUL, &&L_DIV, &&L_MOD,
+    &&L_EXP, &&L_NEG, &&L_POS, &&L_NOT, &&L_AND, &&L_IOR, &&L_XOR,
+    &&L_POP, &&L_PUS, &&L_EQ, &&L_NE, &&L_LT, &&L_LE, &&L_GT, &&L_GE,
+    &&L_BNOT, &&L_BXOR, &&L_JMPF, &&L_JMPT, &&L_MOVB, &&L_RET,
+  };
+#endif
+
+  VM_BEGIN()
+
+  VM_CASE(LOADK)
+  {
+    reg[pc->r0] = _consts[pc->arg];
+    VM_NEXT();
+  }
+  VM_CASE(LOADV)
+  {
+    Value& val = ctx.loadVariable(pc->arg).deref_value();
+    if (val.isNull() || val.type().level() != 0)
+      return nullptr;
+    Register& d = reg[pc->r0];
+    switch (val.type().major())
+    {
+    case Type::BOOLEAN:
+      d.v.b = *val.boolean();
+      break;
+    case Type::INTEGER:
+      d.v.i = *val.integer();
+      break;
+    case Type::NUMERIC:
+      d.v.d = *val.numeric();
+      break;
+    default:
+      return nullptr;
+    }
+    d.type = val.type().major();
+    VM_NEXT();
+  }
+  VM_CASE(ADD)
+  {
+    VM_ARITH(+);
+    VM_NEXT();
+  }
+  VM_CASE(SUB)
+  {
+    VM_ARITH(-);
+    VM_NEXT();
+  }
+  VM_CASE(MUL)
+  {
+    VM_ARITH(*);
+    VM_NEXT();
+  }
+  VM_CASE(DIV)
+  {
+    const Register& a = reg[pc->r1];
+    const Register& b = reg[pc->r2];
+    if (!IS_NUM(a) || !IS_NUM(b))
+      return nullptr;
+    if ((b.type == Type::INTEGER && b.v.i == 0) || (b.type == Type::NUMERIC && b.v.d == 0.0))
+      throw RuntimeError(EXC_RT_DIVIDE_BY_ZERO);
+    VM_ARITH(/);
+    VM_NEXT();
+  }
+  VM_CASE(MOD)
+  {
+    const Register& a = reg[pc->r1];
+    const Register& b = reg[pc->r2];
+    Register& d = reg[pc->r0];
+    if (!IS_NUM(a) || !IS_NUM(b))
+      return nullptr;
+    if ((b.type == Type::INTEGER && b.v.i == 0) || (b.type == Type::NUMERIC && b.v.d == 0.0))
+      throw RuntimeError(EXC_RT_DIVIDE_BY_ZERO);
+    if (a.type == Type::INTEGER && b.type == Type::INTEGER)
+    {
+      d.v.i = a.v.i % b.v.i;
+      d.type = Type::INTEGER;
+    }
+    else
+    {
+      d.v.d = std::fmod(TO_NUM(a), TO_NUM(b));
+      d.type = Type::NUMERIC;
+    }
+    VM_NEXT();
+  }
+  VM_CASE(EXP)
+  {
+    const Register& a = reg[pc->r1];
+    const Register& b = reg[pc->r2];
+    Register& d = reg[pc->r0];
+    if (a.type == Type::INTEGER && b.type == Type::INTEGER)
+    {
+      d.v.i = Integer(std::pow(a.v.i, b.v.i));
+      d.type = Type::INTEGER;
+    }
+    else if (IS_NUM(a) && IS_NUM(b))
+    {
+      d.v.d = std::pow(TO_NUM(a), TO_NUM(b));
+      d.type = Type::NUMERIC;
+    }
+    else
+      return nullptr;
+    VM_NEXT();
+  }
+  VM_CASE(NEG)
+  {
+    Register& d = reg[pc->r0];
+    const Register& a = reg[pc->r1];
+    if (a.type == Type::INTEGER)
+      d.v.i = 0 - a.v.i;
+    else if (a.type == Type::NUMERIC)
+      d.v.d = 0.0 - a.v.d;
+    else
+      return nullptr;
+    d.type = a.type;
+    VM_NEXT();
+  }
+  VM_CASE(POS)
+  {
+    if (!IS_NUM(reg[pc->r1]))
+      return nullptr;
+    reg[pc->r0] = reg[pc->r1];
+    VM_NEXT();
+  }
+  VM_CASE(NOT)
+  {
+    if (reg[pc->r1].type != Type::INTEGER)
+      return nullptr;
+    reg[pc->r0].v.i = ~ reg[pc->r1].v.i;
+    reg[pc->r0].type = Type::INTEGER;
+    VM_NEXT();
+  }
+  VM_CASE(AND)
+  {
+    VM_BITWISE(&);
+    VM_NEXT();
+  }
+  VM_CASE(IOR)
+  {
+    VM_BITWISE(|);
+    VM_NEXT();
+  }
+  VM_CASE(XOR)
+  {
+    VM_BITWISE(^);
+    VM_NEXT();
+  }
+  VM_CASE(POP)
+  {
+    VM_BITWISE(<<);
+    VM_NEXT();
+  }
+  VM_CASE(PUS)
+  {
+    VM_BITWISE(>>);
+    VM_NEXT();
+  }
+  VM_CASE(EQ)
+  {
+    VM_EQUALITY(==, false);
+    VM_NEXT();
+  }
+  VM_CASE(NE)
+  {
+    VM_EQUALITY(!=, true);
+    VM_NEXT();
+  }
+  VM_CASE(LT)
+  {
+    VM_COMPARE(<);
+    VM_NEXT();
+  }
+  VM_CASE(LE)
+  {
+    VM_COMPARE(<=);
+    VM_NEXT();
+  }
+  VM_CASE(GT)
+  {
+    VM_COMPARE(>);
+    VM_NEXT();
+  }
+  VM_CASE(GE)
+  {
+    VM_COMPARE(>=);
+    VM_NEXT();
+  }
+  VM_CASE(BNOT)
+  {
+    if (reg[pc->r1].type != Type::BOOLEAN)
+      return nullptr;
+    reg[pc->r0].v.b = !reg[pc->r1].v.b;
+    reg[pc->r0].type = Type::BOOLEAN;
+    VM_NEXT();
+  }
+  VM_CASE(BXOR)
+  {
+    const Register& a = reg[pc->r1];
+    const Register& b = reg[pc->r2];
+    if (a.type != Type::BOOLEAN || b.type != Type::BOOLEAN)
+      return nullptr;
+    reg[pc->r0].v.b = a.v.b ^ b.v.b;
+    reg[pc->r0].type = Type::BOOLEAN;
+    VM_NEXT();
+  }
+  VM_CASE(JMPF)
+  {
+    if (reg[pc->r1].type != Type::BOOLEAN)
+      return nullptr;
+    if (!reg[pc->r1].v.b)
+      VM_JUMP(pc->arg);
+    VM_NEXT();
+  }
+  VM_CASE(JMPT)
+  {
+    if (reg[pc->r1].type != Type::BOOLEAN)
+      return nullptr;
+    if (reg[pc->r1].v.b)
+      VM_JUMP(pc->arg);
+    VM_NEXT();
+  }
+  VM_CASE(MOVB)
+  {
+    if (reg[pc->r1].type != Type::BOOLEAN)
+      return nullptr;
+    reg[pc->r0] = reg[pc->r1];
+    VM_NEXT();
+  }
+  VM_CASE(RET)
+  {
+    const Register& a = reg[pc->r0];
+    switch (a.type)
+    {
+    case Type::BOOLEAN:
+      return &ctx.allocate(Value(a.v.b));
+    case Type::INTEGER:
+      return &ctx.allocate(Value(a.v.i));
+    default:
+      return &ctx.allocate(Value(a.v.d));
+    }
+  }
+
+  VM_END()
+  return nullptr;
+}
+
+}
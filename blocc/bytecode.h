@@ -0,0 +1,130 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef BYTECODE_H_
+#define BYTECODE_H_
+
+#include "intrinsic_type.h"
+#include "value.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace bloc
+{
+
+class Context;
+class Expression;
+
+/**
+ * This class implements a compact register bytecode for the scalar subset
+ * of the expressions, i.e operators on boolean, integer and numeric operands,
+ * constants and variables.
+ *
+ * A program is compiled from the parse tree of an expression. It runs in a
+ * tight dispatch loop (computed goto when the compiler supports it), without
+ * any temporary allocation. The compiled subset has no side effect, so when
+ * an operand is out of the fast path at runtime (null, table, or other type),
+ * the execution stops and the caller falls back to the tree walker, which
+ * then produces the exact same result or error.
+ */
+class Bytecode
+{
+public:
+
+  enum OPCODE
+  {
+    BC_LOADK  = 0,
+    BC_LOADV,
+    BC_ADD,
+    BC_SUB,
+    BC_MUL,
+    BC_DIV,
+    BC_MOD,
+    BC_EXP,
+    BC_NEG,
+    BC_POS,
+    BC_NOT,
+    BC_AND,
+    BC_IOR,
+    BC_XOR,
+    BC_POP,
+    BC_PUS,
+    BC_EQ,
+    BC_NE,
+    BC_LT,
+    BC_LE,
+    BC_GT,
+    BC_GE,
+    BC_BNOT,
+    BC_BXOR,
+    BC_JMPF,    /* jump if false, the register must be boolean */
+    BC_JMPT,    /* jump if true, the register must be boolean */
+    BC_MOVB,    /* move a boolean register */
+    BC_RET,
+  };
+
+  struct Instruction
+  {
+    uint8_t code;
+    uint8_t r0;     /* destination register */
+    uint8_t r1;     /* first source register */
+    uint8_t r2;     /* second source register */
+    unsigned arg;   /* constant index, symbol id or jump target */
+  };
+
+  static constexpr unsigned max_registers = 32;
+
+  /**
+   * Compile the given expression. The parse tree is not owned.
+   * @param ctx         the parsing context
+   * @param exp         the expression to lower
+   * @return a new program, or null if the expression is not eligible
+   */
+  static Bytecode * compile(Context& ctx, const Expression * exp);
+
+  /**
+   * Run the program.
+   * @param ctx         the runtime context
+   * @return the pointer to the temporary value allocated for the result,
+   *         or null if the fast path has been left and the tree walker
+   *         must be used instead
+   */
+  Value * execute(Context& ctx) const;
+
+  unsigned size() const { return (unsigned) _code.size(); }
+
+private:
+  Bytecode() { }
+
+  struct Register
+  {
+    Type::TypeMajor type;
+    union { Bool b; Integer i; Numeric d; } v;
+  };
+
+  std::vector<Instruction> _code;
+  std::vector<Register> _consts;
+  unsigned _nreg = 0;
+
+  bool emit(Context& ctx, const Expression * exp, unsigned r);
+  unsigned push(uint8_t code, unsigned r0, unsigned r1, unsigned r2, unsigned arg = 0);
+};
+
+}
+
+#endif /* BYTECODE_H_ */
@@ -17,8 +17,15 @@
  */
 
 #include "collection.h"
+#include "tuple.h"
+#include "parallel_executor.h"
 
 #include <cassert>
+#include <cmath>
+#include <algorithm>
+
+/* the minimum count of keys sorted by a worker */
+#define PARALLEL_SORT_GRAIN 65536
 
 namespace bloc
 {
@@ -26,10 +33,18 @@ namespace bloc
 Collection::Collection(const Collection& t) noexcept
 : v(), _decl(t._decl), _type(t._type)
 {
+  if (t._cols)
+  {
+    _cols = new Columns(*t._cols);
+    /* the bound view holds the content of its row */
+    if (t._view)
+      store_view(t._viewed, *t._view);
+    return;
+  }
   /* clone elements */
   v.reserve(t.size());
-  for (const Value& e : t.v)
-    v.push_back(e.clone());
+  for (size_t i = t._head; i < t.v.size(); ++i)
+    v.push_back(t.v[i].clone());
 }
 
 void Collection::swap(Collection& t) noexcept
@@ -39,34 +54,516 @@ void Collection::swap(Collection& t) noexcept
   _type = t._type;
   _decl = t._decl;
   v.swap(t.v);
+  std::swap(_head, t._head);
   t._type = tmp_t;
   t._decl = tmp_d;
+  std::swap(_cols, t._cols);
+  std::swap(_view, t._view);
+  std::swap(_viewed, t._viewed);
 }
 
 void Collection::copy(Collection& t) noexcept
 {
   v.clear();
-  /* clone elements */
-  v.reserve(t.size());
+  _head = 0;
+  delete _cols;
+  _cols = nullptr;
+  _view = nullptr;
   _type = t._type;
   _decl = t._decl;
-  for (const Value& e : t)
-    v.push_back(e.clone());
+  if (t._cols)
+  {
+    _cols = new Columns(*t._cols);
+    if (t._view)
+      store_view(t._viewed, *t._view);
+    return;
+  }
+  /* clone elements */
+  v.reserve(t.size());
+  for (size_t i = t._head; i < t.v.size(); ++i)
+    v.push_back(t.v[i].clone());
 }
 
 void Collection::clear() noexcept
 {
   v.clear();
+  _head = 0;
+  if (_cols)
+    _cols->clear();
+}
+
+void Collection::pack()
+{
+  if (_head == 0)
+    return;
+  v.erase(v.begin(), v.begin() + _head);
+  _head = 0;
+}
+
+Collection::iterator Collection::open(const_iterator pos, size_t n)
+{
+  /* shift the tail once, leaving n null elements at pos */
+  size_t p = pos - v.begin();
+  size_t sz = v.size();
+  v.resize(sz + n);
+  std::move_backward(v.begin() + p, v.begin() + sz, v.end());
+  return v.begin() + p;
+}
+
+Collection::iterator Collection::insert(const_iterator pos, Value&& e)
+{
+  container_t& r = rows();
+  if (_head > 0 && pos == r.begin() + _head)
+  {
+    /* fill the gap at the head */
+    r[--_head] = std::move(e);
+    return r.begin() + _head;
+  }
+  return r.insert(pos, std::move(e));
+}
+
+Collection::iterator Collection::insert(const_iterator pos, const Collection& t)
+{
+  if (&t == this)
+  {
+    Collection c(t);
+    return insert(pos, std::move(c));
+  }
+  rows();
+  iterator it = open(pos, t.size());
+  for (size_t i = 0; i < t.size(); ++i)
+    *(it + i) = t.row(i);
+  return it;
+}
+
+Collection::iterator Collection::insert(const_iterator pos, Collection&& t)
+{
+  rows();
+  container_t& r = t.rows();
+  iterator it = open(pos, t.size());
+  std::move(r.begin() + t._head, r.end(), it);
+  t.clear();
+  return it;
 }
 
 Collection::iterator Collection::erase(const_iterator pos)
 {
-  return v.erase(pos);
+  return erase(pos, pos + 1);
 }
 
 Collection::iterator Collection::erase(const_iterator first, const_iterator last)
 {
-  return v.erase(first, last);
+  container_t& r = rows();
+  if (first != r.begin() + _head)
+    return r.erase(first, last);
+  /* widen the gap at the head, releasing the elements */
+  for (size_t n = last - first; n > 0; --n)
+    r[_head++] = Value();
+  if (_head == r.size())
+    clear();
+  else if (_head > r.size() - _head)
+    pack();
+  return r.begin() + _head;
+}
+
+bool Collection::make_columnar()
+{
+  if (_cols)
+    return true;
+  if (size() > 0 || _type != Type::ROWTYPE || _type.level() != 1 ||
+          !Columns::supported(_decl))
+    return false;
+  clear();
+  _cols = new Columns(_decl);
+  return true;
+}
+
+void Collection::materialize()
+{
+  if (_cols == nullptr)
+    return;
+  v.reserve(_cols->size());
+  for (size_t i = 0; i < _cols->size(); ++i)
+    v.push_back(Value(_cols->make_tuple(i)));
+  delete _cols;
+  _cols = nullptr;
+  if (_view)
+  {
+    /* the row takes the content of the view, which points to it now */
+    v[_viewed].swap(*_view);
+    *_view = Value(&(v[_viewed].to_lvalue(true)));
+    _view = nullptr;
+  }
+}
+
+void Collection::push_row(container_t& row)
+{
+  if (_cols == nullptr || !_cols->push_back(row))
+    rows().push_back(Value(new Tuple(std::move(row))));
+  row.clear();
+}
+
+bool Collection::push_columns(Value& e)
+{
+  /* a tuple of the declared type is stored into the columns */
+  if (e.isNull() || e.type() != Type::ROWTYPE || e.type().level() != 0)
+    return false;
+  return _cols->push_back(*e.tuple());
+}
+
+Value Collection::row(unsigned pos) const
+{
+  if (_cols == nullptr)
+    return v[_head + pos].clone();
+  if (_view && pos == _viewed)
+    return _view->clone();
+  return Value(_cols->make_tuple(pos));
+}
+
+bool Collection::bind_view(unsigned pos, Value& view)
+{
+  if (_cols == nullptr || _view != nullptr)
+    return false;
+  if (!view.isNull() && view.type() == Type::ROWTYPE && view.type().level() == 0 &&
+          !view.tuple()->shared() && view.tuple()->tuple_decl() == _decl)
+    _cols->load(pos, *view.tuple());
+  else
+    view = Value(_cols->make_tuple(pos));
+  view.to_lvalue(true);
+  _view = &view;
+  _viewed = pos;
+  return true;
+}
+
+void Collection::release_view(Value& view, bool store)
+{
+  if (_view != &view)
+    return;
+  _view = nullptr;
+  if (store && _viewed < size())
+    store_view(_viewed, view);
+}
+
+void Collection::store_view(unsigned pos, Value& view)
+{
+  if (_cols && !view.isNull() && view.type() == Type::ROWTYPE &&
+          view.type().level() == 0 && view.tuple()->tuple_decl() == _decl)
+    _cols->store(pos, *view.tuple());
+  else
+  {
+    /* the content does not fit the columns */
+    materialize();
+    v[_head + pos] = view.clone();
+  }
+}
+
+bool Collection::sortable(const Type& type)
+{
+  if (type.level() != 0)
+    return false;
+  switch (type.major())
+  {
+  case Type::BOOLEAN:
+  case Type::INTEGER:
+  case Type::NUMERIC:
+  case Type::LITERAL:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/* the key of the element, and its position in the table */
+template<typename K>
+struct SortKey
+{
+  K key;
+  uint32_t pos;
+};
+
+static inline bool key_less(Integer a, Integer b)
+{
+  return a < b;
+}
+
+static inline bool key_less(Numeric a, Numeric b)
+{
+  /* NaN is greater than any number */
+  return !std::isnan(a) && (std::isnan(b) || a < b);
+}
+
+static inline bool key_less(const Literal * a, const Literal * b)
+{
+  return a->compare(*b) < 0;
+}
+
+template<typename K>
+struct SortOrder
+{
+  bool desc;
+  bool operator()(const SortKey<K>& a, const SortKey<K>& b) const
+  {
+    if (desc ? key_less(b.key, a.key) : key_less(a.key, b.key))
+      return true;
+    if (desc ? key_less(a.key, b.key) : key_less(b.key, a.key))
+      return false;
+    /* equal keys keep their order */
+    return a.pos < b.pos;
+  }
+};
+
+static inline const Value& element(const Value& e, int field)
+{
+  if (field < 0 || e.isNull())
+    return e;
+  return const_cast<Value&>(e).tuple()->at(field);
+}
+
+static bool load_key(const Value& e, Integer& k)
+{
+  if (e.isNull())
+    return false;
+  if (e.type() == Type::BOOLEAN)
+    k = (*const_cast<Value&>(e).boolean() ? 1 : 0);
+  else
+    k = *const_cast<Value&>(e).integer();
+  return true;
+}
+
+static bool load_key(const Value& e, Numeric& k)
+{
+  if (e.isNull())
+    return false;
+  k = *const_cast<Value&>(e).numeric();
+  return true;
+}
+
+static bool load_key(const Value& e, const Literal *& k)
+{
+  if (e.isNull())
+    return false;
+  k = const_cast<Value&>(e).literal();
+  return true;
+}
+
+static bool load_key(const Columns& c, size_t pos, unsigned f, Type::TypeMajor major, Integer& k)
+{
+  if (c.null(pos, f))
+    return false;
+  k = (major == Type::BOOLEAN ? (c.boolean(pos, f) ? 1 : 0) : c.integer(pos, f));
+  return true;
+}
+
+static bool load_key(const Columns& c, size_t pos, unsigned f, Type::TypeMajor major, Numeric& k)
+{
+  if (c.null(pos, f))
+    return false;
+  k = c.numeric(pos, f);
+  return true;
+}
+
+static bool load_key(const Columns& c, size_t pos, unsigned f, Type::TypeMajor major, const Literal *& k)
+{
+  if (c.null(pos, f))
+    return false;
+  k = &c.literal(pos, f);
+  return true;
+}
+
+template<typename K>
+static void sort_keys(std::vector<SortKey<K> >& keys, bool desc, unsigned workers)
+{
+  SortOrder<K> cmp{desc};
+  size_t n = keys.size();
+  if (workers != 1 && n >= 2 * PARALLEL_SORT_GRAIN)
+  {
+    ParallelExecutor executor(workers);
+    size_t k = executor.workers(n / PARALLEL_SORT_GRAIN);
+    if (k > 1)
+    {
+      /* sort the runs, then merge them by pairs */
+      std::vector<size_t> bounds(k + 1);
+      for (size_t i = 0; i <= k; ++i)
+        bounds[i] = n * i / k;
+      executor.run(k, [&keys, &bounds, &cmp](unsigned, size_t begin, size_t end)
+      {
+        for (size_t i = begin; i < end; ++i)
+          std::sort(keys.begin() + bounds[i], keys.begin() + bounds[i + 1], cmp);
+      });
+      for (size_t w = 1; w < k; w *= 2)
+      {
+        executor.run((k + 2 * w - 1) / (2 * w), [&keys, &bounds, &cmp, w, k](unsigned, size_t begin, size_t end)
+        {
+          for (size_t i = begin; i < end; ++i)
+          {
+            size_t lo = i * 2 * w;
+            size_t mid = std::min(lo + w, k);
+            size_t hi = std::min(lo + 2 * w, k);
+            if (mid < hi)
+              std::inplace_merge(keys.begin() + bounds[lo], keys.begin() + bounds[mid],
+                                 keys.begin() + bounds[hi], cmp);
+          }
+        });
+      }
+      return;
+    }
+  }
+  std::sort(keys.begin(), keys.end(), cmp);
+}
+
+template<typename K>
+static void make_order(const Collection::container_t& v, const Columns * cols, int field,
+                       Type::TypeMajor major, bool desc, size_t top, unsigned workers,
+                       std::vector<uint32_t>& order)
+{
+  size_t n = (cols ? cols->size() : v.size());
+  std::vector<SortKey<K> > keys;
+  std::vector<uint32_t> nulls;
+  keys.reserve(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    K k;
+    bool notnull = (cols ? load_key(*cols, i, (unsigned) field, major, k)
+                         : load_key(element(v[i], field), k));
+    if (notnull)
+      keys.push_back(SortKey<K>{k, (uint32_t) i});
+    else
+      nulls.push_back((uint32_t) i);
+  }
+  order.reserve(n);
+  /* the null keys come first in ascending order */
+  if (!desc)
+    order.insert(order.end(), nulls.begin(), nulls.end());
+  if (top < n)
+  {
+    size_t m = (desc ? top : (top > nulls.size() ? top - nulls.size() : 0));
+    m = std::min(m, keys.size());
+    std::partial_sort(keys.begin(), keys.begin() + m, keys.end(), SortOrder<K>{desc});
+  }
+  else
+    sort_keys(keys, desc, workers);
+  for (const SortKey<K>& k : keys)
+    order.push_back(k.pos);
+  if (desc)
+    order.insert(order.end(), nulls.begin(), nulls.end());
+}
+
+Type::TypeMajor Collection::key_major(int field) const
+{
+  if (field < 0)
+    return _type.major();
+  return _decl[field].major();
+}
+
+void Collection::order(bool desc, int field, size_t top, unsigned workers, std::vector<uint32_t>& order) const
+{
+  assert(field >= 0 || _cols == nullptr);
+  switch (key_major(field))
+  {
+  case Type::BOOLEAN:
+  case Type::INTEGER:
+    make_order<Integer>(v, _cols, field, key_major(field), desc, top, workers, order);
+    break;
+  case Type::NUMERIC:
+    make_order<Numeric>(v, _cols, field, key_major(field), desc, top, workers, order);
+    break;
+  case Type::LITERAL:
+    make_order<const Literal*>(v, _cols, field, key_major(field), desc, top, workers, order);
+    break;
+  default:
+    assert(false);
+  }
+}
+
+void Collection::permute(const std::vector<uint32_t>& order)
+{
+  /* the table cannot be viewed during the sort */
+  assert(_view == nullptr);
+  if (_cols)
+  {
+    _cols->permute(order);
+    return;
+  }
+  container_t sorted;
+  sorted.reserve(v.size());
+  for (uint32_t pos : order)
+    sorted.push_back(std::move(v[pos]));
+  v.swap(sorted);
+}
+
+void Collection::sort(bool desc, int field /*= -1*/, unsigned workers /*= 1*/)
+{
+  std::vector<uint32_t> order;
+  pack();
+  this->order(desc, field, size(), workers, order);
+  permute(order);
+}
+
+void Collection::topk(size_t n, bool desc, int field /*= -1*/)
+{
+  std::vector<uint32_t> order;
+  pack();
+  this->order(desc, field, n, 1, order);
+  permute(order);
+}
+
+static int compare_key(const Value& a, const Value& b)
+{
+  if (a.isNull())
+    return (b.isNull() ? 0 : -1);
+  if (b.isNull())
+    return 1;
+  Value& x = const_cast<Value&>(a);
+  Value& y = const_cast<Value&>(b);
+  switch (a.type().major())
+  {
+  case Type::LITERAL:
+    return x.literal()->compare(*y.literal());
+  case Type::BOOLEAN:
+    return (*x.boolean() == *y.boolean() ? 0 : (*x.boolean() ? 1 : -1));
+  default:
+    break;
+  }
+  if (a.type() == Type::INTEGER && b.type() == Type::INTEGER)
+    return (*x.integer() < *y.integer() ? -1 : (*y.integer() < *x.integer() ? 1 : 0));
+  /* type mixing */
+  Numeric n = (a.type() == Type::INTEGER ? Numeric(*x.integer()) : *x.numeric());
+  Numeric m = (b.type() == Type::INTEGER ? Numeric(*y.integer()) : *y.numeric());
+  return (key_less(n, m) ? -1 : (key_less(m, n) ? 1 : 0));
+}
+
+bool Collection::bsearch(const Value& key, bool desc, int field, size_t& pos) const
+{
+  assert(field >= 0 || _cols == nullptr);
+  Value tmp;
+  size_t lo = 0;
+  size_t hi = size();
+  /* search the lower bound */
+  while (lo < hi)
+  {
+    size_t mid = lo + (hi - lo) / 2;
+    const Value * e = &tmp;
+    if (_cols)
+      _cols->get(mid, (unsigned) field, tmp);
+    else
+      e = &element(v[_head + mid], field);
+    int c = compare_key(*e, key);
+    if (desc ? c > 0 : c < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo == size())
+    return false;
+  const Value * e = &tmp;
+  if (_cols)
+    _cols->get(lo, (unsigned) field, tmp);
+  else
+    e = &element(v[_head + lo], field);
+  if (compare_key(*e, key) != 0)
+    return false;
+  pos = lo;
+  return true;
 }
 
 }
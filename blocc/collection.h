@@ -22,13 +22,24 @@
 #include "intrinsic_type.h"
 #include "value.h"
 #include "tuple_decl.h"
+#include "shared_payload.h"
+#include "columns.h"
 
+#include <cstdint>
 #include <vector>
 
 namespace bloc
 {
 
-class Collection
+/**
+ * The table. A table of tuples made of scalar fields can be stored by column
+ * (see make_columnar()): then its rows are made on demand, and any access to
+ * a row by reference converts the table back to rows.
+ * The rows removed at the head of the table leave a gap, which is reused by
+ * the next insertion at the head, or reclaimed once it outweighs the rows.
+ * So the table can be used as a queue without shifting its rows.
+ */
+class Collection : public SharedPayload
 {
 public:
   typedef std::vector<Value> container_t;
@@ -37,7 +48,7 @@ public:
   typedef Value& reference;
   typedef const Value& const_reference;
 
-  virtual ~Collection() { this->clear(); }
+  virtual ~Collection() { this->clear(); delete _cols; }
   explicit Collection(const Type& type) : v(), _type(type) { }
   explicit Collection(const TupleDecl::Decl& decl, Type::TypeLevel level)
   : v(), _decl(decl) { _type = _decl.make_type(level); }
@@ -48,7 +59,8 @@ public:
 
   Collection(const Collection& t) noexcept;
   Collection(Collection&& t) noexcept
-  : v(std::move(t.v)), _decl(std::move(t._decl)), _type(t._type) { }
+  : v(std::move(t.v)), _decl(std::move(t._decl)), _type(t._type), _cols(t._cols), _head(t._head)
+  { t._cols = nullptr; t._head = 0; }
 
   const Type& table_type() const { return _type; }
   const TupleDecl::Decl& table_decl() const { return _decl; }
@@ -56,24 +68,125 @@ public:
   void swap(Collection& t) noexcept;
   void copy(Collection& t) noexcept;
   void clear() noexcept;
-  void reserve(unsigned n) { v.reserve(n) ; }
-
-  reference operator[](unsigned pos) { return v[pos]; }
-  reference at(unsigned pos) { return v.at(pos); }
-  const_reference operator[](unsigned pos) const { return const_cast<const_reference>(v[pos]); }
-  const_reference at(unsigned pos) const { return const_cast<const_reference>(v.at(pos)); }
-  size_t size() const { return v.size(); }
-  iterator begin() { return v.begin(); }
-  iterator end() { return v.end(); }
-  void push_back(Value&& e) { v.push_back(std::move(e)); }
-  iterator insert(const_iterator pos, Value&& e) { return v.insert(pos, std::move(e)); }
+  void reserve(unsigned n) { if (_cols) _cols->reserve(n); else v.reserve(_head + n); }
+
+  reference operator[](unsigned pos) { return rows()[_head + pos]; }
+  reference at(unsigned pos) { return rows().at(_head + pos); }
+  const_reference operator[](unsigned pos) const { return const_cast<Collection*>(this)->rows()[_head + pos]; }
+  const_reference at(unsigned pos) const { return const_cast<Collection*>(this)->rows().at(_head + pos); }
+  size_t size() const { return (_cols ? _cols->size() : v.size() - _head); }
+  iterator begin() { return rows().begin() + _head; }
+  iterator end() { return rows().end(); }
+  void push_back(Value&& e)
+  {
+    if (_cols == nullptr || !push_columns(e))
+      rows().push_back(std::move(e));
+  }
+  iterator insert(const_iterator pos, Value&& e);
+
+  /**
+   * Insert clones of the elements of the table t, shifting the following
+   * elements once.
+   */
+  iterator insert(const_iterator pos, const Collection& t);
+
+  /**
+   * Insert the elements of the table t, moving them out of t.
+   */
+  iterator insert(const_iterator pos, Collection&& t);
+
   iterator erase(const_iterator pos);
   iterator erase(const_iterator first, const_iterator last);
 
+  /**
+   * Switch the empty table to the columnar storage. It requires a table of
+   * tuples, made of scalar fields only.
+   * @return true if the table is columnar
+   */
+  bool make_columnar();
+  bool columnar() const { return _cols != nullptr; }
+  Columns * columns() { return _cols; }
+
+  /**
+   * Convert the columnar table to rows.
+   */
+  void materialize();
+
+  /**
+   * Append a row to the table of tuples from its fields. The columnar
+   * storage takes the fields, else a new tuple is made from them. The row
+   * is left empty.
+   */
+  void push_row(container_t& row);
+
+  /**
+   * Return a copy of the element, without converting the columnar table.
+   */
+  Value row(unsigned pos) const;
+
+  /**
+   * Bind the view to the row of the columnar table: the row is loaded into
+   * the view, reusing its tuple when it is not shared. Until the view is
+   * released, it holds the content of the row, and converting the table
+   * to rows turns the view into a pointer to the row.
+   * @return false if the table is not columnar, or another view is bound
+   */
+  bool bind_view(unsigned pos, Value& view);
+
+  /**
+   * Unbind the view, if it is bound.
+   * @param view
+   * @param store true to store the view into its row
+   */
+  void release_view(Value& view, bool store);
+
+  /**
+   * Check the values of the type can be ordered: boolean, integer, decimal
+   * or string.
+   */
+  static bool sortable(const Type& type);
+
+  /**
+   * Sort the table in place, by the element, or by the field of the tuples.
+   * The sort is stable; the null keys come first in ascending order, and
+   * last in descending order. A large table is sorted by the given number
+   * of workers, 0 for the hardware concurrency.
+   * @param desc true for the descending order
+   * @param field the rank of the field from 0, or -1 to sort by element
+   * @param workers
+   */
+  void sort(bool desc, int field = -1, unsigned workers = 1);
+
+  /**
+   * Sort the first n elements in place, leaving the others in unspecified
+   * order.
+   */
+  void topk(size_t n, bool desc, int field = -1);
+
+  /**
+   * Search the first element equal to the key, in the table sorted in the
+   * given order.
+   * @return true if found, and pos is set to its position
+   */
+  bool bsearch(const Value& key, bool desc, int field, size_t& pos) const;
+
 private:
   container_t v;
   TupleDecl::Decl _decl;
   Type _type;
+  Columns * _cols = nullptr;
+  Value * _view = nullptr;
+  unsigned _viewed = 0;
+  size_t _head = 0; /* the gap of erased rows at the head of v */
+
+  container_t& rows() { if (_cols) materialize(); return v; }
+  void pack();
+  iterator open(const_iterator pos, size_t n);
+  Type::TypeMajor key_major(int field) const;
+  void order(bool desc, int field, size_t top, unsigned workers, std::vector<uint32_t>& order) const;
+  void permute(const std::vector<uint32_t>& order);
+  bool push_columns(Value& e);
+  void store_view(unsigned pos, Value& view);
 };
 
 }
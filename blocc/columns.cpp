@@ -0,0 +1,329 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "columns.h"
+#include "tuple.h"
+
+#include <cassert>
+
+namespace bloc
+{
+
+Columns::Columns(const TupleDecl::Decl& decl)
+: _cols(decl.size())
+{
+  for (size_t f = 0; f < decl.size(); ++f)
+    _cols[f].major = decl[f].major();
+}
+
+bool Columns::supported(const TupleDecl::Decl& decl)
+{
+  if (decl.empty())
+    return false;
+  for (const Type& t : decl)
+  {
+    if (t.level() != 0)
+      return false;
+    switch (t.major())
+    {
+    case Type::BOOLEAN:
+    case Type::INTEGER:
+    case Type::NUMERIC:
+    case Type::IMAGINARY:
+    case Type::LITERAL:
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
+void Columns::reserve(size_t n)
+{
+  for (Column& c : _cols)
+  {
+    c.nulls.reserve(n);
+    switch (c.major)
+    {
+    case Type::BOOLEAN:
+      c.b.reserve(n);
+      break;
+    case Type::INTEGER:
+      c.i.reserve(n);
+      break;
+    case Type::NUMERIC:
+      c.d.reserve(n);
+      break;
+    case Type::IMAGINARY:
+      c.z.reserve(n);
+      break;
+    default:
+      c.s.reserve(n);
+    }
+  }
+}
+
+void Columns::clear()
+{
+  for (Column& c : _cols)
+  {
+    c.nulls.clear();
+    c.b.clear();
+    c.i.clear();
+    c.d.clear();
+    c.z.clear();
+    c.s.clear();
+  }
+  _size = 0;
+}
+
+bool Columns::match(row_t::iterator first, row_t::iterator last) const
+{
+  if (size_t(last - first) != _cols.size())
+    return false;
+  for (const Column& c : _cols)
+  {
+    const Type& t = first->type();
+    if (t.level() != 0 || t.major() != c.major)
+      return false;
+    ++first;
+  }
+  return true;
+}
+
+bool Columns::push_back(row_t& row)
+{
+  if (!match(row.begin(), row.end()))
+    return false;
+  append();
+  unsigned f = 0;
+  for (Column& c : _cols)
+    set(c, _size - 1, row[f++], true);
+  return true;
+}
+
+bool Columns::push_back(Tuple& t)
+{
+  if (!match(t.begin(), t.end()))
+    return false;
+  row_t row;
+  row.reserve(t.size());
+  for (Value& v : t)
+    row.push_back(v.clone());
+  return push_back(row);
+}
+
+void Columns::append()
+{
+  for (Column& c : _cols)
+  {
+    c.nulls.push_back(true);
+    switch (c.major)
+    {
+    case Type::BOOLEAN:
+      c.b.push_back(false);
+      break;
+    case Type::INTEGER:
+      c.i.push_back(0);
+      break;
+    case Type::NUMERIC:
+      c.d.push_back(0.0);
+      break;
+    case Type::IMAGINARY:
+      c.z.push_back(Imaginary{0.0, 0.0});
+      break;
+    default:
+      c.s.push_back(Literal());
+    }
+  }
+  ++_size;
+}
+
+void Columns::erase(size_t pos)
+{
+  assert(pos < _size);
+  size_t last = _size - 1;
+  for (Column& c : _cols)
+  {
+    c.nulls[pos] = c.nulls[last];
+    c.nulls.pop_back();
+    switch (c.major)
+    {
+    case Type::BOOLEAN:
+      c.b[pos] = c.b[last];
+      c.b.pop_back();
+      break;
+    case Type::INTEGER:
+      c.i[pos] = c.i[last];
+      c.i.pop_back();
+      break;
+    case Type::NUMERIC:
+      c.d[pos] = c.d[last];
+      c.d.pop_back();
+      break;
+    case Type::IMAGINARY:
+      c.z[pos] = c.z[last];
+      c.z.pop_back();
+      break;
+    default:
+      if (pos != last)
+        c.s[pos].swap(c.s[last]);
+      c.s.pop_back();
+    }
+  }
+  _size = last;
+}
+
+template<typename T>
+static void permute_vector(std::vector<T>& a, const std::vector<uint32_t>& order)
+{
+  std::vector<T> b;
+  b.reserve(a.size());
+  for (uint32_t pos : order)
+    b.push_back(std::move(a[pos]));
+  a.swap(b);
+}
+
+void Columns::permute(const std::vector<uint32_t>& order)
+{
+  assert(order.size() == _size);
+  for (Column& c : _cols)
+  {
+    permute_vector(c.nulls, order);
+    switch (c.major)
+    {
+    case Type::BOOLEAN:
+      permute_vector(c.b, order);
+      break;
+    case Type::INTEGER:
+      permute_vector(c.i, order);
+      break;
+    case Type::NUMERIC:
+      permute_vector(c.d, order);
+      break;
+    case Type::IMAGINARY:
+      permute_vector(c.z, order);
+      break;
+    default:
+      permute_vector(c.s, order);
+    }
+  }
+}
+
+void Columns::set(Column& c, size_t pos, Value& v, bool take)
+{
+  if (v.isNull())
+  {
+    c.nulls[pos] = true;
+    return;
+  }
+  c.nulls[pos] = false;
+  switch (c.major)
+  {
+  case Type::BOOLEAN:
+    c.b[pos] = *v.boolean();
+    break;
+  case Type::INTEGER:
+    c.i[pos] = *v.integer();
+    break;
+  case Type::NUMERIC:
+    c.d[pos] = *v.numeric();
+    break;
+  case Type::IMAGINARY:
+    c.z[pos] = *v.imaginary();
+    break;
+  default:
+    if (take)
+      c.s[pos].swap(*v.literal());
+    else
+      c.s[pos].assign(*v.literal());
+  }
+}
+
+void Columns::get(const Column& c, size_t pos, Value& v)
+{
+  /* reuse the storage of the value when possible */
+  bool same = (!v.isNull() && v.type() == Type(c.major));
+  if (c.nulls[pos])
+  {
+    if (!v.isNull() || v.type() != Type(c.major))
+      v = Value(Type(c.major));
+    return;
+  }
+  switch (c.major)
+  {
+  case Type::BOOLEAN:
+    if (same)
+      *v.boolean() = c.b[pos];
+    else
+      v = Value(Bool(c.b[pos]));
+    break;
+  case Type::INTEGER:
+    if (same)
+      *v.integer() = c.i[pos];
+    else
+      v = Value(c.i[pos]);
+    break;
+  case Type::NUMERIC:
+    if (same)
+      *v.numeric() = c.d[pos];
+    else
+      v = Value(c.d[pos]);
+    break;
+  case Type::IMAGINARY:
+    if (same)
+      *v.imaginary() = c.z[pos];
+    else
+      v = Value(c.z[pos]);
+    break;
+  default:
+    if (same)
+      v.literal()->assign(c.s[pos]);
+    else
+      v = Value(c.s[pos]);
+  }
+}
+
+Tuple * Columns::make_tuple(size_t pos) const
+{
+  assert(pos < _size);
+  row_t row(_cols.size());
+  unsigned f = 0;
+  for (const Column& c : _cols)
+    get(c, pos, row[f++]);
+  return new Tuple(std::move(row));
+}
+
+void Columns::load(size_t pos, Tuple& t) const
+{
+  assert(pos < _size && t.size() == _cols.size());
+  unsigned f = 0;
+  for (const Column& c : _cols)
+    get(c, pos, t[f++]);
+}
+
+void Columns::store(size_t pos, Tuple& t)
+{
+  assert(pos < _size && t.size() == _cols.size());
+  unsigned f = 0;
+  for (Column& c : _cols)
+    set(c, pos, t[f++], false);
+}
+
+}
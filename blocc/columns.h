@@ -0,0 +1,148 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COLUMNS_H_
+#define COLUMNS_H_
+
+#include "intrinsic_type.h"
+#include "value.h"
+#include "tuple_decl.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace bloc
+{
+
+class Tuple;
+
+/**
+ * The columnar storage of a table of tuples, whose fields are all scalar:
+ * boolean, integer, decimal, imaginary or string. Each field is stored in
+ * one contiguous array, and the nulls are marked in a bitmap by field.
+ * The rows are made on demand, see Collection.
+ */
+class Columns
+{
+public:
+  typedef std::vector<Value> row_t;
+
+  explicit Columns(const TupleDecl::Decl& decl);
+
+  /**
+   * Check the tuples of the declaration can be stored by column.
+   * @param decl
+   * @return true if all fields are scalar
+   */
+  static bool supported(const TupleDecl::Decl& decl);
+
+  size_t size() const { return _size; }
+  unsigned width() const { return (unsigned) _cols.size(); }
+  void reserve(size_t n);
+  void clear();
+
+  /**
+   * Append a row. The strings are moved out of the row.
+   * @param row the fields, of the declared types
+   * @return false if the row does not match the declaration, and nothing
+   *         was appended
+   */
+  bool push_back(row_t& row);
+
+  /**
+   * Append the fields of the tuple.
+   * @return false if the tuple does not match the declaration
+   */
+  bool push_back(Tuple& t);
+
+  /**
+   * Make a new tuple from the row.
+   */
+  Tuple * make_tuple(size_t pos) const;
+
+  /**
+   * Load the row into the tuple, reusing its values. The tuple must be of
+   * the declared type.
+   */
+  void load(size_t pos, Tuple& t) const;
+
+  /**
+   * Store the tuple into the row. The tuple must be of the declared type.
+   */
+  void store(size_t pos, Tuple& t);
+
+  /**
+   * Append a row of null fields.
+   */
+  void append();
+
+  /**
+   * Load the field of the row into the value, reusing its storage.
+   */
+  void get(size_t pos, unsigned f, Value& v) const { get(_cols[f], pos, v); }
+
+  /**
+   * Store the value into the field of the row. The value must be of the
+   * declared type, or null.
+   */
+  void set(size_t pos, unsigned f, Value& v) { set(_cols[f], pos, v, false); }
+
+  /**
+   * Erase the row. The last row is moved into its place, so the order of
+   * the rows is not preserved.
+   */
+  void erase(size_t pos);
+
+  /**
+   * Reorder the rows: the row at position order[i] is moved to position i.
+   * The order must be a permutation of the rows.
+   */
+  void permute(const std::vector<uint32_t>& order);
+
+  /**
+   * Direct access to the field of the row, which must be of the given type.
+   */
+  bool null(size_t pos, unsigned f) const { return _cols[f].nulls[pos]; }
+  Bool boolean(size_t pos, unsigned f) const { return _cols[f].b[pos]; }
+  Integer integer(size_t pos, unsigned f) const { return _cols[f].i[pos]; }
+  Numeric numeric(size_t pos, unsigned f) const { return _cols[f].d[pos]; }
+  const Literal& literal(size_t pos, unsigned f) const { return _cols[f].s[pos]; }
+
+private:
+  struct Column
+  {
+    Type::TypeMajor major;
+    std::vector<bool> nulls;
+    std::vector<Bool> b;
+    std::vector<Integer> i;
+    std::vector<Numeric> d;
+    std::vector<Imaginary> z;
+    std::vector<Literal> s;
+  };
+
+  std::vector<Column> _cols;
+  size_t _size = 0;
+
+  bool match(row_t::iterator first, row_t::iterator last) const;
+  void set(Column& c, size_t pos, Value& v, bool take);
+  static void get(const Column& c, size_t pos, Value& v);
+};
+
+}
+
+#endif /* COLUMNS_H_ */
@@ -60,6 +60,14 @@ Complex * Complex::newInstance(
   return nullptr;
 }
 
+Complex * Complex::newInstance(Type::TypeMinor type_id, void * handle)
+{
+#ifdef DEBUG_COMPLEX
+  DBG(DBG_DEBUG, "%s line %d\n", __PRETTY_FUNCTION__, __LINE__);
+#endif
+  return new Complex(type_id, handle);
+}
+
 Complex::~Complex()
 {
 #ifdef DEBUG_COMPLEX
@@ -54,6 +54,15 @@ public:
           Context& ctx,
           const std::vector<Expression*>& args);
 
+  /**
+   * The complex factory for an instance created by the module itself, i.e
+   * an object returned by a method.
+   * @param type_id
+   * @param handle the instance, destroyed by the module with the complex
+   * @return the complex
+   */
+  static Complex * newInstance(Type::TypeMinor type_id, void * handle);
+
   bool operator==(const Complex& c) const { return (_refcount && this->_instance == c._instance); }
   bool operator!=(const Complex& c) const { return !(*this == c); }
 
@@ -20,6 +20,8 @@
 #include "statement.h"
 #include "functor_manager.h"
 #include "plugin_manager.h"
+#include "regex_cache.h"
+#include "profiler.h"
 #include "exception_parse.h"
 #include "collection.h"
 #include "tuple.h"
@@ -28,6 +30,7 @@
 #include <cstdio>
 #include <cstring>
 #include <random>
+#include <atomic>
 #include <cassert>
 
 #if defined(LIBBLOC_MSWIN)
@@ -80,9 +83,8 @@ Context::Context(int fd_out, int fd_err)
 
 Context::~Context()
 {
-  if (_returned)
-    delete _returned;
   _returned = nullptr;
+  _returned_slot = Value();
 
   if (_fctm->getRoot() == this)
     delete _fctm;
@@ -92,9 +94,17 @@ Context::~Context()
   _storage_pool.clear();
   _backed_symbols.clear();
 
+  if (_regex_cache)
+    delete _regex_cache;
+  _regex_cache = nullptr;
+
+  if (_profiler)
+    delete _profiler;
+  _profiler = nullptr;
+
   /* only the root context own file descriptors,
-   * therefore a child should not close any of them */
-  if (_root == this)
+   * therefore a child or a worker should not close any of them */
+  if (_root == this && !_worker)
   {
     if (_serr && _serr != _sout)
       ::fclose(_serr);
@@ -108,10 +118,14 @@ Context * Context::clone() const
   Context * other = new Context(::fileno(_sout), ::fileno(_serr));
   /* copy flags */
   other->_flags = _flags;
+  other->_optimization = _optimization;
+  other->_parallelism = _parallelism;
+  other->_stack_budget = _stack_budget;
   /* clone table of symbols */
   other->_storage_pool.reserve(_storage_pool.size());
   for (const MemorySlot& e : _storage_pool)
     other->_storage_pool.push_back(e);
+  other->_symbol_index = _symbol_index;
   /* clone functor declarations */
   other->_fctm->reset(*_fctm);
   return other;
@@ -122,21 +136,55 @@ Context * Context::clone(int fd_out, int fd_err) const
   Context * other = new Context(fd_out, fd_err);
   /* copy flags */
   other->_flags = _flags;
+  other->_optimization = _optimization;
+  other->_parallelism = _parallelism;
+  other->_stack_budget = _stack_budget;
   /* clone table of symbols */
   other->_storage_pool.reserve(_storage_pool.size());
   for (const MemorySlot& e : _storage_pool)
     other->_storage_pool.push_back(e);
+  other->_symbol_index = _symbol_index;
   /* clone functor declarations */
   other->_fctm->reset(*_fctm);
   return other;
 }
 
+Context * Context::createWorker(unsigned shared)
+{
+  Context * worker = new Context(*this);
+  /* the worker is the root of the functions it calls */
+  worker->_root = worker;
+  worker->_worker = true;
+  worker->_recursion = _recursion;
+  worker->_trace = _trace;
+  worker->_fctm = new FunctorManager(*worker);
+  worker->_fctm->reset(*_fctm);
+  /* copy table of symbols, pointing to the values of the shared symbols */
+  worker->_storage_pool.reserve(_storage_pool.size());
+  for (MemorySlot& e : _storage_pool)
+  {
+    worker->_storage_pool.push_back(MemorySlot(*(e.symbol)));
+    if (e.symbol->id() < shared)
+    {
+      /* the rows of a shared table are read concurrently, so a columnar
+       * table cannot make them on demand */
+      Value& sv = e.value.deref_value();
+      if (!sv.isNull() && sv.type().level() > 0)
+        sv.collection()->materialize();
+      Value& v = worker->_storage_pool.back().value;
+      v = Value(&e.value);
+      v.to_lvalue(true);
+    }
+  }
+  worker->_symbol_index = _symbol_index;
+  return worker;
+}
+
 void Context::purge()
 {
   returnCondition(false);
-  if (_returned)
-    delete _returned;
   _returned = nullptr;
+  _returned_slot = Value();
 
   /* reset the root manager */
   if (_fctm->getRoot() == this)
@@ -148,17 +196,38 @@ void Context::purge()
   /* clear temporary pool */
   _temporary_storage.purge();
 
+  /* release interned literals */
+  _literals.clear();
+
+  /* release compiled regular expressions */
+  if (_regex_cache)
+    delete _regex_cache;
+  _regex_cache = nullptr;
+
   /* clear storage pool */
   _storage_pool.clear();
+  _symbol_index.clear();
 
   /* reset trace mode */
   _trace = false;
 
+  /* disable the profiler */
+  if (_profiler)
+    delete _profiler;
+  _profiler = nullptr;
+
   /* reset parsing state */
   _parsing = false;
   _backed_symbols.clear();
 }
 
+void Context::profile(bool b)
+{
+  if (_root->_profiler)
+    delete _root->_profiler;
+  _root->_profiler = (b ? new Profiler() : nullptr);
+}
+
 /**************************************************************************/
 /* Symbol and pointer                                                     */
 /**************************************************************************/
@@ -193,15 +262,18 @@ Symbol& Context::registerSymbol(const std::string& name, const Type& type)
     unsigned nxt_id = _storage_pool.size();
     _storage_pool.push_back(MemorySlot(Symbol(nxt_id, name, type)));
     Symbol * sym = _storage_pool.back().symbol;
+    _symbol_index.emplace(name, nxt_id);
 
     /* implement safety qualifier */
     if (name.front() == Symbol::SAFETY_QUALIFIER)
       sym->safety(true);
 
+    symbolWritten(nxt_id);
     return *sym;
   }
   if (s->locked())
     throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s->name().c_str());
+  symbolWritten(s->id());
   if (type == *s)
     return *s;
   if (s->safety())
@@ -233,15 +305,18 @@ Symbol& Context::registerSymbol(const std::string& name, const TupleDecl::Decl&
     unsigned nxt_id = _storage_pool.size();
     _storage_pool.push_back(MemorySlot(Symbol(nxt_id, name, decl, level)));
     Symbol * sym = _storage_pool.back().symbol;
+    _symbol_index.emplace(name, nxt_id);
 
     /* implement safety qualifier */
     if (name.front() == Symbol::SAFETY_QUALIFIER)
       sym->safety(true);
 
+    symbolWritten(nxt_id);
     return *sym;
   }
   if (s->locked())
     throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s->name().c_str());
+  symbolWritten(s->id());
   Type type = decl.make_type(level);
   if (type == *s)
     return *s;
@@ -368,7 +443,16 @@ void Context::describeSymbol(unsigned id)
 void Context::dumpVariables()
 {
   for (MemorySlot& e : _storage_pool)
-    describeSymbol(e.symbol->id());
+  {
+    if (e.symbol->name().front() != Symbol::HIDDEN_QUALIFIER)
+      describeSymbol(e.symbol->id());
+  }
+}
+
+void Context::symbolWritten(unsigned id)
+{
+  if (_loop)
+    _loop->written.insert(id);
 }
 
 void Context::dumpFunctors()
@@ -427,24 +511,34 @@ void Context::unstackControl()
 
 void Context::saveReturned(Value& ret)
 {
-  if (_returned)
-    delete _returned;
+  /* the value is kept in place, so a call returns it without allocation */
   if (ret.lvalue())
-    _returned = new Value(ret.clone());
+    _returned_slot = ret.clone();
   else
-  {
-    _returned = new Value();
-    _returned->swap(ret);
-  }
+    _returned_slot.swap(ret);
+  _returned = &_returned_slot;
 }
 
 Value * Context::dropReturned()
 {
-  Value * ret = _returned;
+  if (_returned == nullptr)
+    return nullptr;
+  Value * ret = new Value();
+  ret->swap(_returned_slot);
   _returned = nullptr;
   return ret;
 }
 
+bool Context::moveReturned(Value& val)
+{
+  if (_returned == nullptr)
+    return false;
+  val.swap(_returned_slot);
+  _returned_slot = Value();
+  _returned = nullptr;
+  return true;
+}
+
 /**************************************************************************/
 /* Events                                                                 */
 /**************************************************************************/
@@ -452,12 +546,41 @@ Value * Context::dropReturned()
 void Context::onRuntimeError()
 {
   /* purge control stack */
-  while (!_controlstack.empty() && _controlstack.top().stmt->level() >= execLevel())
+  while (!_controlstack.empty() && _controlstack.top().level >= execLevel())
     unstackControl();
   /* purge temporary allocations */
   purgeWorkingMemory();
 }
 
+/**************************************************************************/
+/* Temporary storage management                                           */
+/**************************************************************************/
+
+RegexCache& Context::regexCache()
+{
+  if (_root->_regex_cache == nullptr)
+    _root->_regex_cache = new RegexCache();
+  return *_root->_regex_cache;
+}
+
+std::shared_ptr<Value> Context::internLiteral(Value&& v)
+{
+  std::shared_ptr<Value> sv;
+  if (v.isNull())
+  {
+    sv = std::make_shared<Value>(std::move(v));
+    sv->to_lvalue(true);
+    return sv;
+  }
+  auto it = _root->_literals.find(*v.literal());
+  if (it != _root->_literals.end())
+    return it->second;
+  sv = std::make_shared<Value>(std::move(v));
+  sv->to_lvalue(true);
+  _root->_literals.emplace(*sv->literal(), sv);
+  return sv;
+}
+
 /**************************************************************************/
 /* Environment                                                            */
 /**************************************************************************/
@@ -491,12 +614,13 @@ const char * Context::language()
 
 double Context::random(double max)
 {
-  static std::minstd_rand r;
-  static bool seeded = false;
-  if (!seeded)
+  /* each instance has its own sequence */
+  static std::atomic<unsigned> instances(0);
+  std::minstd_rand& r = _root->_rng;
+  if (!_root->_rng_seeded)
   {
-    seeded = true;
-    r.seed((unsigned) ::getpid());
+    _root->_rng_seeded = true;
+    r.seed((unsigned) ::getpid() + instances.fetch_add(1));
     (void)r();
   }
   return (double)r() / std::minstd_rand::max() * max;
@@ -510,6 +634,14 @@ void Context::trusted(bool b)
     _flags &= ~(FLAG_TRUSTED);
 }
 
+void Context::bytecode(bool b)
+{
+  if (b)
+    _flags |= FLAG_BYTECODE;
+  else
+    _flags &= ~(FLAG_BYTECODE);
+}
+
 /**
  * Make an empty shell of context.
  * @param ctx the parent context
@@ -520,6 +652,9 @@ Context::Context(const Context& ctx)
 , _sout(ctx._sout)
 , _serr(ctx._serr)
 , _flags(ctx._flags)
+, _optimization(ctx._optimization)
+, _parallelism(ctx._parallelism)
+, _stack_budget(ctx._stack_budget)
 {
 }
 
@@ -540,16 +675,18 @@ Context * Context::createChildShell(Context& root) const
  * @param root        the instance root
  * @param recursion   level of recursion (>=1)
  */
-Context * Context::createChildRuntime(Context& root, uint8_t recursion) const
+Context * Context::createChildRuntime(Context& root, unsigned recursion) const
 {
   assert(recursion > 0);
   Context * runtime = new Context(*this);
+  runtime->_root = &root;
   runtime->_fctm = root._fctm;
   runtime->_recursion = recursion;
   /* copy table of symbols with new empty values */
   runtime->_storage_pool.reserve(_storage_pool.size());
   for (const MemorySlot& e : _storage_pool)
     runtime->_storage_pool.push_back(MemorySlot(*(e.symbol)));
+  runtime->_symbol_index = _symbol_index;
   return runtime;
 }
 
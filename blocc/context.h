@@ -23,11 +23,25 @@
 #include "template_stack.h"
 #include "exception_runtime.h"
 #include "value.h"
+#include "optimizer.h"
 
 #include <string>
 #include <forward_list>
 #include <algorithm>
 #include <chrono>
+#include <memory>
+#include <unordered_map>
+#include <random>
+#include <cstdint>
+
+/* the default size of the native stack the calls can use, in bytes: a level
+ * of recursion uses less than 1KB, the main thread has 1MB on Windows, and
+ * the other threads have 512KB on macOS */
+#if defined(_WIN32) || defined(__APPLE__)
+#define STACK_BUDGET 0x60000
+#else
+#define STACK_BUDGET 0x400000
+#endif
 
 namespace bloc
 {
@@ -35,6 +49,8 @@ namespace bloc
 class Statement;
 class Controller;
 class FunctorManager;
+class Profiler;
+class RegexCache;
 
 class Context
 {
@@ -49,6 +65,16 @@ public:
 
   Context * clone(int fd_out, int fd_err) const;
 
+  /**
+   * Make a context to run a job of a parallel loop in a worker thread. The
+   * symbols below the given id are bound to the values of this context, and
+   * the others are empty. The worker owns its functor manager, its random
+   * generator and its temporary storage, but it shares the streams of this.
+   * The worker must be freed before this context.
+   * @param shared      the count of symbols bound to this context
+   */
+  Context * createWorker(unsigned shared);
+
   /**
    * Purge the context including all symbols and storage pool.
    * Any executables previously built with the context will no longer work.
@@ -67,11 +93,9 @@ public:
    */
   Symbol * findSymbol(const std::string& name)
   {
-    for (MemorySlot& e : _storage_pool)
-    {
-      if (e.symbol->name() == name)
-        return e.symbol;
-    }
+    auto it = _symbol_index.find(name);
+    if (it != _symbol_index.end())
+      return _storage_pool[it->second].symbol;
     return nullptr;
   }
 
@@ -80,6 +104,14 @@ public:
     return *_storage_pool[id].symbol;
   }
 
+  /**
+   * Returns the count of registered symbols, that is the next symbol id.
+   */
+  unsigned symbolCount() const
+  {
+    return (unsigned) _storage_pool.size();
+  }
+
   void parsingBegin();
 
   void parsingEnd();
@@ -166,7 +198,7 @@ public:
 
   void stackControl(const Controller * stmt, void * data)
   {
-    _controlstack.stack({stmt, data});
+    _controlstack.stack({stmt, data, execLevel()});
   }
 
   /**
@@ -191,6 +223,8 @@ public:
 
   const Statement * execStatement() const { return _execstack.top(); }
 
+  const Statement * execStatement(size_t level) const { return _execstack.at(level); }
+
   void execBegin(const Statement * s) { _execstack.stack(s); }
 
   void execEnd() { _execstack.unstack(); }
@@ -222,11 +256,23 @@ public:
    */
   Value * dropReturned();
 
+  /**
+   * Move the value returned by the last RUN into the given value, without
+   * allocation. The given value is unchanged if none was returned.
+   * @param val         the value to fill
+   * @return            true if a value was returned
+   */
+  bool moveReturned(Value& val);
+
   /*========================================================================*/
   /* Events                                                                 */
   /*========================================================================*/
 
-  void onStatementEnd(const Statement * s) { _temporary_storage.clear(); }
+  void onStatementEnd(const Statement * s)
+  {
+    if (_temporary_storage.count())
+      _temporary_storage.clear();
+  }
 
   void onRuntimeError();
 
@@ -252,9 +298,42 @@ public:
 
   bool trace() const { return _trace; }
 
-  void recursion(uint8_t r) { _recursion = r; }
+  /**
+   * Enable or disable the profiler of the instance. Enabling it again
+   * discards the collected data.
+   */
+  void profile(bool b);
+
+  bool profile() const { return _root->_profiler != nullptr; }
+
+  /**
+   * Returns the profiler of the instance, or null if disabled.
+   * A worker of parallel loop has none.
+   */
+  Profiler * profiler() const { return _root->_profiler; }
+
+  void recursion(unsigned r) { _recursion = r; }
+
+  unsigned recursion() const { return _recursion; }
+
+  /**
+   * Set the size of the native stack the nested calls of functions can
+   * use, in bytes. A call beyond the budget fails with the error
+   * EXC_RT_RECURSION_LIMIT, before the stack of the thread overflows.
+   * The calls in tail position do not use more stack.
+   * @param bytes the budget, STACK_BUDGET by default
+   */
+  void stackBudget(size_t bytes) { _stack_budget = bytes; }
+
+  size_t stackBudget() const { return _stack_budget; }
+
+  /**
+   * Set the maximum number of workers running a parallel loop.
+   * @param n the number of workers, 0 for the hardware concurrency
+   */
+  void parallelism(unsigned n) { _parallelism = n; }
 
-  uint8_t recursion() const { return _recursion; }
+  unsigned parallelism() const { return _parallelism; }
 
   /*========================================================================*/
   /* Temporary storage management                                           */
@@ -264,6 +343,12 @@ public:
 
   size_t allocationCount() const { return _temporary_storage.count(); }
 
+  /**
+   * Returns the count of temporary values allocated since the creation of
+   * this context. Unlike the working memory count, it is never reset.
+   */
+  size_t allocationTotal() const { return _temporary_storage.allocated(); }
+
   /**
    * Purge temporary storage allocated by a standalone expression or statement.
    * Unlike running Executable where purging is performed after completion or
@@ -303,6 +388,23 @@ public:
    */
   void purgeWorkingMemory() { _temporary_storage.purge(); }
 
+  /**
+   * Intern a constant literal of the parsed source. Equal constants share the
+   * same value, that is an lvalue, so that any operation writes into a copy.
+   * The table belongs to the instance root.
+   * @param v     the constant literal
+   * @return      the shared value
+   */
+  std::shared_ptr<Value> internLiteral(Value&& v);
+
+  /**
+   * Returns the cache of the regular expressions compiled at runtime.
+   * The cache belongs to the instance root.
+   */
+  RegexCache& regexCache();
+
+  bool regexCached() const { return _root->_regex_cache != nullptr; }
+
   /*========================================================================*/
   /* Environment                                                            */
   /*========================================================================*/
@@ -323,7 +425,12 @@ public:
 
   static const char * language();
 
-  static double random(double max);
+  /**
+   * Returns a pseudo random number between 0 and max. The generator is
+   * owned by the instance root, so that independent contexts can run in
+   * separate threads.
+   */
+  double random(double max);
 
   /**
    * Set context as trusted to allow use of restricted plugins
@@ -333,6 +440,31 @@ public:
 
   bool trusted() { return (_flags & FLAG_TRUSTED) != 0; }
 
+  /**
+   * Enable lowering of the parsed expressions to bytecode
+   * @param b enable or disable the bytecode
+   */
+  void bytecode(bool b);
+
+  bool bytecode() { return (_flags & FLAG_BYTECODE) != 0; }
+
+  /**
+   * Set the level of the parse time optimizer, 0 to disable it (default).
+   * The level 1 folds the constant expressions, drops the unreachable
+   * branches, and inlines the calls of the small functions.
+   * @param level the level of optimization
+   */
+  void optimization(unsigned level) { _optimization = (uint8_t) level; }
+
+  unsigned optimization() const { return _optimization; }
+
+  /**
+   * Notify the optimizer that the symbol is assigned, or updated in place,
+   * by the statement being parsed.
+   * @param id the symbol id
+   */
+  void symbolWritten(unsigned id);
+
 private:
   Context * _root;
   FunctorManager * _fctm = nullptr;
@@ -355,13 +487,15 @@ private:
     : value(s)
     , symbol(new Symbol(std::move(s))) { }
 
+    /* the copy does not share any payload, so that both can run in
+     * separate threads */
     explicit MemorySlot(const MemorySlot& m)
-    : value(std::move(m.value.clone().to_lvalue(true)))
+    : value(std::move(m.value.deep_clone().to_lvalue(true)))
     , symbol(new Symbol(*m.symbol)) { }
 
     MemorySlot& operator=(const MemorySlot& m)
     {
-      value = std::move(m.value.clone().to_lvalue(true));
+      value = std::move(m.value.deep_clone().to_lvalue(true));
       symbol = new Symbol(*m.symbol);
       return *this;
     }
@@ -383,6 +517,9 @@ private:
 
   std::vector<MemorySlot> _storage_pool;
 
+  /* index of symbols by name */
+  std::unordered_map<std::string, unsigned> _symbol_index;
+
   /* stack of looping statement */
   struct Control
   {
@@ -390,6 +527,8 @@ private:
     const Controller * stmt;
     /* the opaque data held by the statement */
     void * data;
+    /* the execution level of the statement */
+    size_t level;
   };
 
   Stack<Control> _controlstack;
@@ -401,6 +540,7 @@ private:
   class Pool
   {
     unsigned wm = 0;
+    size_t total = 0; /* count of values kept since creation */
     std::vector<Value*> pool;
   public:
     Pool() { }
@@ -413,6 +553,7 @@ private:
     }
     Value& keep(Value&& v)
     {
+      ++total;
       if (wm < pool.size())
         pool[wm]->swap(std::move(v));
       else
@@ -430,11 +571,28 @@ private:
         v->swap(Value());
     }
     size_t count() const { return wm; }
+    size_t allocated() const { return total; }
     size_t reserved() const { return pool.size(); }
   };
 
   Pool _temporary_storage;
 
+  /* generator of pseudo random numbers */
+  std::minstd_rand _rng;
+  bool _rng_seeded = false;
+
+  /* interned constant literals */
+  std::unordered_map<Literal, std::shared_ptr<Value> > _literals;
+
+  /* compiled regular expressions */
+  RegexCache * _regex_cache = nullptr;
+
+  /* counting profiler */
+  Profiler * _profiler = nullptr;
+
+  /* the innermost loop being parsed, for the optimizer */
+  Optimizer::Loop * _loop = nullptr;
+
   std::vector<Symbol> _backed_symbols;
 
   RuntimeError _last_error;
@@ -444,21 +602,32 @@ private:
   bool _continueCondition = false;
   bool _returnCondition = false;
 
+  /* points to the slot of the returned value, when one is returned */
   Value * _returned = nullptr;
+  Value _returned_slot;
 
   FILE * _sout = nullptr; // stream for output
   FILE * _serr = nullptr; // stream for errors
 
   bool _trace = false;
 
-  enum Flag { FLAG_TRUSTED = 0x01 };
+  /* a worker does not own the streams */
+  bool _worker = false;
+
+  enum Flag { FLAG_TRUSTED = 0x01, FLAG_BYTECODE = 0x02 };
   uint8_t _flags = 0;
 
-  uint8_t _recursion = 0;
+  unsigned _recursion = 0;
+  uint8_t _optimization = 0;
+  unsigned _parallelism = 0;
+  size_t _stack_budget = STACK_BUDGET;
+  /* the native stack address of the outermost call in the thread */
+  uintptr_t _stack_base = 0;
   friend class FunctorManager;
+  friend class Optimizer;
   explicit Context(const Context& ctx);
   Context * createChildShell(Context& root) const;
-  Context * createChildRuntime(Context& root, uint8_t recursion) const;
+  Context * createChildRuntime(Context& root, unsigned recursion) const;
 };
 
 }
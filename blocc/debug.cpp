@@ -26,6 +26,7 @@
 #include <cstdio>
 #include <cstring>
 #include <ctype.h>
+#include <atomic>
 
 #if defined(_MSC_VER) && _MSC_VER < 1900
 #define snprintf _snprintf
@@ -34,14 +35,16 @@
 namespace bloc
 {
 
+/* the debug context is shared by all threads, so the level and the callback
+ * are atomic to be changed at any time */
 typedef struct
 {
   const char* name;
-  int cur_level;
-  void (*msg_callback)(int level, char* msg);
+  std::atomic<int> cur_level;
+  std::atomic<void (*)(int level, char* msg)> msg_callback;
 } debug_ctx_t;
 
-static debug_ctx_t debug_ctx = {LIBTAG, DBG_NONE, nullptr};
+static debug_ctx_t debug_ctx = {LIBTAG, {DBG_NONE}, {nullptr}};
 
 /**
  * Set the debug level to be used for the subsystem
@@ -53,7 +56,7 @@ static inline void __dbg_setlevel(debug_ctx_t* ctx, int level)
 {
   if (ctx != nullptr)
   {
-    ctx->cur_level = level;
+    ctx->cur_level.store(level, std::memory_order_relaxed);
   }
 }
 /**
@@ -70,9 +73,10 @@ static inline void __dbg(const debug_ctx_t* ctx, int level, const char* fmt, va_
     char msg[4096];
     int len = snprintf(msg, sizeof (msg), "(%s)", ctx->name);
     vsnprintf(msg + len, sizeof (msg) - len, fmt, ap);
-    if (ctx->msg_callback)
+    void (*msg_callback)(int level, char* msg) = ctx->msg_callback.load();
+    if (msg_callback)
     {
-      ctx->msg_callback(level, msg);
+      msg_callback(level, msg);
     }
     else
     {
@@ -98,7 +102,7 @@ void DBGNone()
 
 void DBG(int level, const char* fmt, ...)
 {
-  if (level > debug_ctx.cur_level)
+  if (level > debug_ctx.cur_level.load(std::memory_order_relaxed))
     return;
   va_list ap;
   va_start(ap, fmt);
@@ -108,7 +112,7 @@ void DBG(int level, const char* fmt, ...)
 
 void SetDBGMsgCallback(void (*msgcb)(int level, char*))
 {
-  debug_ctx.msg_callback = msgcb;
+  debug_ctx.msg_callback.store(msgcb);
 }
 
 }
@@ -60,6 +60,7 @@ const char * RuntimeError::RUNTIME_ERROR[] =
   "The recursion limit has been reached.",
   "All items of table must be uniform.",
   "Variable '%s' is read-only.",
+  "Invalid or non map expression.",
 };
 
 RuntimeError::THROWABLE RuntimeError::THROWABLES[] =
@@ -63,6 +63,7 @@ enum EXC_RT
   EXC_RT_RECURSION_LIMIT,
   EXC_RT_VARYING_COLLECTION,
   EXC_RT_CONST_VIOLATION_S,
+  EXC_RT_NOT_MAPTYPE,
 };
 
 class RuntimeError : public Error
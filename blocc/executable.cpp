@@ -30,7 +30,7 @@ Executable::~Executable()
   _statements.clear();
 }
 
-int Executable::run(Context& ctx, const std::list<const Statement*>& statements)
+int Executable::run(Context& ctx, const std::vector<const Statement*>& statements)
 {
   try
   {
@@ -40,12 +40,24 @@ int Executable::run(Context& ctx, const std::list<const Statement*>& statements)
       DBG(DBG_DEBUG, "%s stopped ahead because return is requested\n", __FUNCTION__);
       return 0;
     }
+    /* the profiler cannot be enabled while running, so the check is hoisted
+     * out of the statement loop. Without trace, the statement runs straight */
+    bool profiled = (ctx.profiler() != nullptr);
     /* the statement loop */
     for (auto s : statements)
     {
       /* the statement chain */
       while (s != nullptr)
-        s = s->execute(ctx);
+      {
+        if (profiled || ctx.trace())
+          s = s->execute(ctx);
+        else
+        {
+          const Statement * next = s->doit(ctx);
+          ctx.onStatementEnd(s);
+          s = next;
+        }
+      }
       /* a stop condition breaks the loop */
       if (ctx.stopCondition())
         break;
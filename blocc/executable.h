@@ -22,7 +22,7 @@
 #include "context.h"
 #include "statement.h"
 
-#include <list>
+#include <vector>
 
 namespace bloc
 {
@@ -34,16 +34,16 @@ class Executable {
 public:
   virtual ~Executable();
 
-  Executable(Context& ctx, const std::list<const Statement*>& statements)
+  Executable(Context& ctx, const std::vector<const Statement*>& statements)
   : _context(ctx)
   , _statements(statements)
   { }
 
-  static int run(Context& ctx, const std::list<const Statement*>& statements);
+  static int run(Context& ctx, const std::vector<const Statement*>& statements);
 
   int run() { return run(_context, _statements); }
 
-  std::list<const Statement*>& statements() { return _statements; }
+  std::vector<const Statement*>& statements() { return _statements; }
 
   Context& context() { return _context; }
 
@@ -51,7 +51,7 @@ public:
 
 private:
   Context& _context;
-  std::list<const Statement*> _statements;
+  std::vector<const Statement*> _statements;
 };
 
 }
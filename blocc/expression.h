@@ -81,6 +81,12 @@ public:
    */
   virtual unsigned symbolId() const { return nid; }
 
+  /**
+   * Flags the expression as the target of an update in place. An accessor
+   * of element must then detach the shared payload of its container.
+   */
+  virtual void setMutable() { }
+
   virtual const TupleDecl::Decl& tuple_decl(Context& ctx) const
   {
     return TupleDecl::no_decl;
@@ -86,6 +86,7 @@
 #include "builtin/builtin_b64enc.h"
 #include "builtin/builtin_b64dec.h"
 #include "builtin/builtin_typeof.h"
+#include "builtin/builtin_map.h"
 
 #include "exception_parse.h"
 #include "context.h"
@@ -112,7 +113,7 @@ const char * BuiltinExpression::KEYWORDS[] = {
     "ltrim",      "rtrim",      "trim",       "upper",      "lower",
     "strpos",     "replace",    "subraw",     "hash",       "imag",
     "iphase",     "iconj",      "tokenize",   "b64enc",     "b64dec",
-    "typeof",
+    "typeof",     "map",
 };
 
 BuiltinExpression::~BuiltinExpression()
@@ -319,6 +320,8 @@ BuiltinExpression * BuiltinExpression::parse(Parser& p, Context& ctx)
     return B64DECExpression::parse(p, ctx);
   case FUNC_TYPEOF:
     return TYPEOFExpression::parse(p, ctx);
+  case FUNC_MAP:
+    return MAPExpression::parse(p, ctx);
 
   default:
     throw ParseError(EXC_PARSE_NOT_A_FUNCTION, t);
@@ -125,6 +125,7 @@ public:
     FUNC_B64ENC = 68, // b64enc(x)
     FUNC_B64DEC = 69, // b64dec(x)
     FUNC_TYPEOF = 70, // typeof(x)
+    FUNC_MAP    = 71, // map(x,y)
   };
 
   std::string unparse(Context& ctx) const override;
@@ -149,6 +150,9 @@ protected:
   explicit BuiltinExpression(FUNCTION fc) : oper(fc) { }
   BuiltinExpression(FUNCTION fc, std::vector<Expression*>&& args) : oper(fc), _args(std::move(args)) { }
   static void assertClosedFunction(Parser& p, Context& ctx, FUNCTION fc);
+
+  /* the optimizer inspects and replaces the arguments */
+  friend class Optimizer;
 };
 
 }
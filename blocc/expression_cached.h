@@ -0,0 +1,116 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef EXPRESSION_CACHED_H_
+#define EXPRESSION_CACHED_H_
+
+#include "expression.h"
+#include "context.h"
+
+#include <vector>
+#include <memory>
+
+namespace bloc
+{
+
+class CachedExpression;
+
+/**
+ * The hidden variable holding the value of a pure expression. It is shared
+ * by the occurrences of a common subexpression.
+ */
+struct Temporary
+{
+  /* the symbol of the hidden variable, else the value is not kept */
+  unsigned id = Expression::nid;
+  /* the value is released by the loop it is hoisted to, on entry or on
+   * iteration */
+  bool hoisted = false;
+  /* parse time: the temporaries of the loop the value will be hoisted to */
+  std::vector<unsigned> * loop = nullptr;
+  /* parse time: the expression to analyse, or null when deleted */
+  CachedExpression * node = nullptr;
+};
+
+/**
+ * This class implements a pure expression, whose value is kept in a hidden
+ * variable until it is released. The value of a loop invariant is released
+ * when the loop is entered, the value shared by the body of a loop is
+ * released on each iteration, and the values of the common subexpressions
+ * are released before each evaluation of the enclosing expression. Without
+ * variable, the expression is evaluated as is.
+ */
+class CachedExpression : public Expression
+{
+  Expression * _exp;
+  std::shared_ptr<Temporary> _tmp;
+  /* the common subexpressions to release before evaluation */
+  std::vector<std::shared_ptr<Temporary> > _common;
+
+  friend class Optimizer;
+
+public:
+  virtual ~CachedExpression();
+
+  CachedExpression(Expression * exp, const std::shared_ptr<Temporary>& tmp)
+  : Expression(), _exp(exp), _tmp(tmp) { }
+
+  const Type& type(Context& ctx) const override { return _exp->type(ctx); }
+
+  Value& value(Context& ctx) const override
+  {
+    if (_tmp->id == nid)
+    {
+      release(ctx);
+      return _exp->value(ctx);
+    }
+    Value& v = ctx.loadVariable(_tmp->id);
+    if (!v.isNull())
+      return v;
+    release(ctx);
+    return ctx.storeVariable(_tmp->id, std::move(_exp->value(ctx)));
+  }
+
+  std::string unparse(Context& ctx) const override { return _exp->unparse(ctx); }
+
+  bool enclosed() const override { return _exp->enclosed(); }
+
+  bool isConst() const override { return _exp->isConst(); }
+
+  const TupleDecl::Decl& tuple_decl(Context& ctx) const override
+  {
+    return _exp->tuple_decl(ctx);
+  }
+
+  std::string toString(Context& ctx) const override { return _exp->toString(ctx); }
+
+  std::string typeName(Context& ctx) const override { return _exp->typeName(ctx); }
+
+private:
+  void release(Context& ctx) const
+  {
+    for (const std::shared_ptr<Temporary>& t : _common)
+    {
+      if (!t->hoisted)
+        ctx.clearVariable(t->id);
+    }
+  }
+};
+
+}
+
+#endif /* EXPRESSION_CACHED_H_ */
@@ -0,0 +1,43 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "expression_compiled.h"
+#include "expression_operator.h"
+
+namespace bloc
+{
+
+CompiledExpression::~CompiledExpression()
+{
+  if (_code)
+    delete _code;
+  if (_exp)
+    delete _exp;
+}
+
+Expression * CompiledExpression::compile(Context& ctx, Expression * exp)
+{
+  /* only operations are worth lowering */
+  if (dynamic_cast<OperatorExpression*>(exp) == nullptr)
+    return exp;
+  Bytecode * code = Bytecode::compile(ctx, exp);
+  if (code == nullptr)
+    return exp;
+  return new CompiledExpression(exp, code);
+}
+
+}
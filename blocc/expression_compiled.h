@@ -0,0 +1,82 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef EXPRESSION_COMPILED_H_
+#define EXPRESSION_COMPILED_H_
+
+#include "expression.h"
+#include "bytecode.h"
+
+namespace bloc
+{
+
+/**
+ * This class implements an expression lowered to bytecode. It owns the
+ * original parse tree, which is used for the static properties, and as the
+ * fallback when the bytecode leaves the fast path at runtime.
+ */
+class CompiledExpression : public Expression
+{
+  Expression * _exp;
+  Bytecode * _code;
+
+  /* the optimizer inspects the original parse tree */
+  friend class Optimizer;
+
+public:
+  virtual ~CompiledExpression();
+
+  CompiledExpression(Expression * exp, Bytecode * code)
+  : Expression(), _exp(exp), _code(code) { }
+
+  const Type& type(Context& ctx) const override { return _exp->type(ctx); }
+
+  Value& value(Context& ctx) const override
+  {
+    Value * v = _code->execute(ctx);
+    if (v)
+      return *v;
+    return _exp->value(ctx);
+  }
+
+  std::string unparse(Context& ctx) const override { return _exp->unparse(ctx); }
+
+  bool enclosed() const override { return _exp->enclosed(); }
+
+  bool isConst() const override { return _exp->isConst(); }
+
+  const TupleDecl::Decl& tuple_decl(Context& ctx) const override
+  {
+    return _exp->tuple_decl(ctx);
+  }
+
+  std::string toString(Context& ctx) const override { return _exp->toString(ctx); }
+
+  std::string typeName(Context& ctx) const override { return _exp->typeName(ctx); }
+
+  /**
+   * Lower the given operator expression to bytecode if eligible.
+   * @param ctx         the parsing context
+   * @param exp         the expression to lower
+   * @return the new compiled expression owning exp, else exp
+   */
+  static Expression * compile(Context& ctx, Expression * exp);
+};
+
+}
+
+#endif /* EXPRESSION_COMPILED_H_ */
@@ -17,11 +17,13 @@
  */
 
 #include "expression_functor.h"
+#include "expression_inline.h"
 #include "parse_expression.h"
 #include "exception_parse.h"
 #include "parser.h"
 #include "debug.h"
 #include "exception_runtime.h"
+#include "profiler.h"
 
 #include <memory>
 
@@ -43,16 +45,26 @@ const Type& FunctorExpression::type(Context& ctx) const
 Value& FunctorExpression::value(Context& ctx) const
 {
   auto env = ctx.functorManager().createEnv(ctx, _id, _args);
-  env.functor().body->doit(env.context());
-  Value * ret = env.context().dropReturned();
-  if (ret != nullptr)
+  Profiler * profiler = ctx.profiler();
+  /* a call in tail position replaces the frame, then runs the body again */
+  do
   {
-    Value& val = ctx.allocate(std::move(*ret));
-    delete ret;
-    return val;
-  }
-  /* do not throw EXC_RT_NO_RETURN_VALUE */
-  return ctx.allocate(Value());
+    if (profiler)
+      profiler->call(env.context(), env.functor());
+    else
+      env.functor().body->doit(env.context());
+  } while (env.tailCall());
+  /* the returned value is moved into the working memory of the caller,
+   * else it is null: do not throw EXC_RT_NO_RETURN_VALUE */
+  Value& val = ctx.allocate(Value());
+  env.context().moveReturned(val);
+  return val;
+}
+
+bool FunctorExpression::recursive(Context& ctx) const
+{
+  const Functor * functor = ctx.functorManager().getDeclaration(_id).functor.get();
+  return (functor && functor->ctx == &ctx);
 }
 
 std::string FunctorExpression::unparse(Context& ctx) const
@@ -68,7 +80,7 @@ std::string FunctorExpression::unparse(Context& ctx) const
   return sb;
 }
 
-FunctorExpression * FunctorExpression::parse(Parser& p, Context& ctx, TokenPtr& token)
+Expression * FunctorExpression::parse(Parser& p, Context& ctx, TokenPtr& token)
 {
   std::vector<Expression*> args;
   /* all names are declared in upper case, so now transform the keyword */
@@ -101,7 +113,13 @@ FunctorExpression * FunctorExpression::parse(Parser& p, Context& ctx, TokenPtr&
 
     unsigned id = ctx.functorManager().findDeclaration(name, args.size());
     if (id != FunctorManager::nid)
+    {
+      /* the optimizer inlines the small functors, but in their own body */
+      const Functor& functor = *(ctx.functorManager().getDeclaration(id).functor);
+      if (ctx.optimization() > 0 && !functor.inlined.empty() && functor.ctx != &ctx)
+        return InlineExpression::parse(ctx, id, std::move(args));
       return new FunctorExpression(id, std::move(args));
+    }
     if (ctx.functorManager().nameExists(name))
       throw ParseError(EXC_PARSE_FUNC_ARG_NUM_S, name.c_str(), token);
     throw ParseError(EXC_PARSE_UNDEFINED_SYMBOL_S, name.c_str(), token);
@@ -37,7 +37,7 @@ class Parser;
  */
 class FunctorExpression : public Expression
 {
-private:
+protected:
   unsigned _id;
   std::vector<Expression*> _args;
 
@@ -54,12 +54,31 @@ public:
 
   std::string unparse(Context& ctx) const override;
 
+  /**
+   * Returns true if the call is made in the body of the same functor,
+   * being parsed with the given context.
+   */
+  bool recursive(Context& ctx) const;
+
+  /**
+   * Make the call in tail position from the body of the same functor: the
+   * parameters are bound to the next frame, which will replace the caller.
+   */
+  void tailCall(Context& ctx) const
+  {
+    ctx.functorManager().bindTailCall(ctx, _id, _args);
+  }
+
   std::string toString(Context& ctx) const override
   {
     return "functor";
   }
 
-  static FunctorExpression * parse(Parser& p, Context& ctx, TokenPtr& token);
+  /**
+   * Parse the call of functor. The call of a small functor could be
+   * inlined, see InlineExpression.
+   */
+  static Expression * parse(Parser& p, Context& ctx, TokenPtr& token);
 
 };
 
@@ -0,0 +1,101 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "expression_inline.h"
+#include "exception_parse.h"
+#include "parser.h"
+#include "debug.h"
+
+#include <algorithm>
+
+namespace bloc
+{
+
+InlineExpression::~InlineExpression()
+{
+  if (_exp)
+    delete _exp;
+}
+
+Value& InlineExpression::value(Context& ctx) const
+{
+  /* the functor could be replaced in an interactive session */
+  if (ctx.profiler() || ctx.functorManager().getDeclaration(_id).functor != _functor)
+    return FunctorExpression::value(ctx);
+  for (size_t i = 0; i < _params.size(); ++i)
+    ctx.storeVariable(_params[i], std::move(_args[i]->value(ctx)));
+  /* the value is moved into the working memory, as the returned value */
+  return ctx.allocate(std::move(_exp->value(ctx)));
+}
+
+FunctorExpression * InlineExpression::parse(Context& ctx, unsigned id, std::vector<Expression*>&& args)
+{
+  const FunctorPtr& functor = ctx.functorManager().getDeclaration(id).functor;
+  const std::vector<TokenPtr>& tokens = functor->inlined;
+
+  /* register the hidden variables of the parameters */
+  std::vector<unsigned> params;
+  std::vector<std::string> names;
+  for (const Symbol& param : functor->params)
+  {
+    /* the qualifier cannot begin a symbol of the language */
+    std::string name(1, Symbol::HIDDEN_QUALIFIER);
+    name.append(std::to_string(ctx.symbolCount()));
+    params.push_back(ctx.registerSymbol(name, param).id());
+    names.push_back(name);
+  }
+
+  /* replace the names of the parameters, but the names of member and of
+   * function */
+  TokenImage image;
+  for (size_t n = 0; n < tokens.size(); ++n)
+  {
+    const TokenPtr& t = tokens[n];
+    if (t->code == TOKEN_KEYWORD && (n == 0 || tokens[n - 1]->code != '.') &&
+            (n + 1 == tokens.size() || tokens[n + 1]->code != '('))
+    {
+      std::string name(t->text);
+      std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+      size_t i = 0;
+      while (i < functor->params.size() && functor->params[i].name() != name)
+        ++i;
+      if (i < functor->params.size())
+      {
+        image.push(TokenPtr(new Token(t->code, names[i], t->line, t->column)));
+        continue;
+      }
+    }
+    image.push(t);
+  }
+  image.push(TokenPtr(new Token(Parser::Separator, ";", 0, 0)));
+
+  Expression * exp = nullptr;
+  try
+  {
+    exp = Parser::parseExpression(ctx, image);
+  }
+  catch (ParseError& pe)
+  {
+    /* make the call as usual */
+    DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    return new FunctorExpression(id, std::move(args));
+  }
+  return new InlineExpression(id, std::move(args), functor, std::move(params), exp);
+}
+
+}
@@ -0,0 +1,70 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef EXPRESSION_INLINE_H_
+#define EXPRESSION_INLINE_H_
+
+#include "expression_functor.h"
+
+#include <vector>
+
+namespace bloc
+{
+
+/**
+ * This class implements the call of a small functor, whose body is a single
+ * RETURN statement. The returned expression is parsed again in the context
+ * of the caller, where the parameters are hidden variables holding the
+ * values of the arguments, so that each argument is evaluated once. The call
+ * is made as usual when the functor has been replaced since the parse, or
+ * when the profiler is enabled.
+ */
+class InlineExpression : public FunctorExpression
+{
+private:
+  /* the inlined functor */
+  FunctorPtr _functor;
+  /* the hidden variables of the parameters */
+  std::vector<unsigned> _params;
+  /* the returned expression */
+  Expression * _exp = nullptr;
+
+public:
+  virtual ~InlineExpression();
+
+  InlineExpression(unsigned id, std::vector<Expression*>&& args, const FunctorPtr& functor,
+                   std::vector<unsigned>&& params, Expression * exp)
+  : FunctorExpression(id, std::move(args)), _functor(functor), _params(std::move(params))
+  , _exp(exp) { }
+
+  Value& value(Context& ctx) const override;
+
+  /**
+   * Parse the returned expression of the functor, replacing its parameters.
+   * On failure the call is not inlined.
+   * @param ctx   the context of the caller
+   * @param id    the entry id of the functor
+   * @param args  the arguments of the call
+   * @return      the new expression
+   */
+  static FunctorExpression * parse(Context& ctx, unsigned id, std::vector<Expression*>&& args);
+};
+
+}
+
+#endif /* EXPRESSION_INLINE_H_ */
@@ -48,7 +48,11 @@ Value& ItemExpression::value(Context& ctx) const
 {
   Value& val = _exp->value(ctx);
   if (!val.isNull() && val.tuple()->tuple_decl().size() > _index)
-    return val.tuple()->at(_index).to_lvalue(val.lvalue());
+  {
+    /* the item of a shared tuple must be copied by the consumer */
+    Tuple * rv = (_mutable ? val.detach().tuple() : val.tuple());
+    return rv->at(_index).to_lvalue(val.lvalue() || rv->shared());
+  }
   throw RuntimeError(EXC_RT_INDEX_RANGE_S, std::to_string(_index + 1).c_str());
 }
 
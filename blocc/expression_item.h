@@ -34,6 +34,7 @@ class ItemExpression : public Expression
 
   Expression * _exp = nullptr;
   unsigned _index = 0;
+  bool _mutable = false;
   static Type _opaque;
 
 public:
@@ -54,6 +55,8 @@ public:
   /* it could relate an accessor */
   unsigned symbolId() const override { return _exp->symbolId(); }
 
+  void setMutable() override { _mutable = true; _exp->setMutable(); }
+
   std::string toString(Context& ctx) const override
   {
     return std::string(_exp->typeName(ctx))
@@ -23,14 +23,12 @@ namespace bloc
 
 std::string LiteralExpression::unparse(Context& ctx) const
 {
-  return Value::readableLiteral(*v.literal());
+  return Value::readableLiteral(*v->literal());
 }
 
 LiteralExpression * LiteralExpression::parse(const std::string& text)
 {
-  LiteralExpression * exp = new LiteralExpression();
-  exp->v.swap(Value::parseLiteral(text));
-  return exp;
+  return new LiteralExpression(Value::parseLiteral(text));
 }
 
 }
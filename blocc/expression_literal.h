@@ -21,6 +21,8 @@
 
 #include "expression.h"
 
+#include <memory>
+
 namespace bloc
 {
 
@@ -31,24 +33,26 @@ class LiteralExpression : public Expression
 {
 private:
 
-  mutable Value v;
+  /* the value could be shared by equal constants (see Context::internLiteral) */
+  std::shared_ptr<Value> v;
 
 public:
 
   virtual ~LiteralExpression() { }
 
-  LiteralExpression() { }
-  explicit LiteralExpression(const Literal& a) : v(new Literal(a)) { v.to_lvalue(true); }
-  explicit LiteralExpression(Value&& _v) : v(std::move(_v)) { v.to_lvalue(true); }
+  LiteralExpression() : v(std::make_shared<Value>(Value::type_literal)) { }
+  explicit LiteralExpression(const Literal& a) : v(std::make_shared<Value>(a)) { v->to_lvalue(true); }
+  explicit LiteralExpression(Value&& _v) : v(std::make_shared<Value>(std::move(_v))) { v->to_lvalue(true); }
+  explicit LiteralExpression(const std::shared_ptr<Value>& _v) : v(_v) { }
 
   const Type& type(Context& ctx) const override
   {
-    return v.type();
+    return v->type();
   }
 
   Value& value(Context& ctx) const override
   {
-    return v;
+    return *v;
   }
 
   bool isConst() const override { return true; }
@@ -57,7 +61,7 @@ public:
 
   std::string toString(Context& ctx) const override
   {
-    return v.toString();
+    return v->toString();
   }
 
   LiteralExpression * parse(const std::string& text);
@@ -24,6 +24,10 @@
 #include "member/member_delete.h"
 #include "member/member_insert.h"
 #include "member/member_set.h"
+#include "member/member_contains.h"
+#include "member/member_sort.h"
+#include "member/member_bsearch.h"
+#include "member/member_topk.h"
 #include "member/member_complex.h"
 
 #include "exception_parse.h"
@@ -42,7 +46,8 @@ namespace bloc
 
 const char * MemberExpression::KEYWORDS[] = {
   "",         "concat",     "at",       "put",      "count",
-  "delete",   "insert",     "set",
+  "delete",   "insert",     "set",      "contains", "sort",
+  "bsearch",  "topk",
 };
 
 MemberExpression::~MemberExpression()
@@ -102,6 +107,7 @@ MemberExpression * MemberExpression::parse(Parser& p, Context& ctx, Expression *
       case Type::LITERAL:
       case Type::TABCHAR:
       case Type::ROWTYPE:
+      case Type::MAPTYPE:
       case Type::NO_TYPE: /* opaque */
         return parse_builtin(p, ctx, exp);
       default:
@@ -146,6 +152,14 @@ MemberExpression * MemberExpression::parse_builtin(Parser& p, Context& ctx, Expr
     return MemberINSERTExpression::parse(p, ctx, exp);
   case BTM_SET:
     return MemberSETExpression::parse(p, ctx, exp);
+  case BTM_CONTAINS:
+    return MemberCONTAINSExpression::parse(p, ctx, exp);
+  case BTM_SORT:
+    return MemberSORTExpression::parse(p, ctx, exp);
+  case BTM_BSEARCH:
+    return MemberBSEARCHExpression::parse(p, ctx, exp);
+  case BTM_TOPK:
+    return MemberTOPKExpression::parse(p, ctx, exp);
   default:
     throw ParseError(EXC_PARSE_MEMB_NOT_IMPL_S, KEYWORDS[mc], t);
   }
@@ -54,6 +54,10 @@ public:
     BTM_DELETE    = 5,
     BTM_INSERT    = 6,
     BTM_SET       = 7,
+    BTM_CONTAINS  = 8,
+    BTM_SORT      = 9,
+    BTM_BSEARCH   = 10,
+    BTM_TOPK      = 11,
   };
 
   virtual ~MemberExpression();
@@ -80,6 +84,9 @@ public:
 protected:
   static void assertClosedMember(Parser& p, Context& ctx, const char * member);
 
+  /* the optimizer inspects the accessed expression */
+  friend class Optimizer;
+
 private:
   static MemberExpression * parse_builtin(Parser&p, Context& ctx, Expression * exp);
 };
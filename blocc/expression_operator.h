@@ -0,0 +1,69 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef EXPRESSION_OPERATOR_H_
+#define EXPRESSION_OPERATOR_H_
+
+#include "operator.h"
+#include "expression.h"
+
+namespace bloc
+{
+
+/**
+ * This is the base class for the operator expressions.
+ *
+ * It holds the operator code and the operands, so that the parse tree
+ * can be inspected and lowered, i.e by the bytecode compiler. The unary
+ * operators have only the first operand, the second is null.
+ * The operands are owned and freed by the subclasses.
+ */
+class OperatorExpression : public Expression
+{
+protected:
+  Operator::OP _op;
+  Expression * arg1 = nullptr;
+  Expression * arg2 = nullptr;
+  bool enc = false;
+
+  OperatorExpression(Operator::OP op, Expression * a, Expression * b = nullptr)
+  : _op(op), arg1(a), arg2(b) { }
+
+  /* the optimizer replaces the operands */
+  friend class Optimizer;
+
+public:
+
+  virtual ~OperatorExpression() { }
+
+  Operator::OP oper() const { return _op; }
+
+  const Expression * operand1() const { return arg1; }
+  const Expression * operand2() const { return arg2; }
+
+  bool enclosed() const override { return enc; }
+  void enclosed(bool yesno) override { enc = yesno; }
+
+  std::string toString(Context& ctx) const override
+  {
+    return Operator::OPVALS[_op];
+  }
+};
+
+}
+
+#endif /* EXPRESSION_OPERATOR_H_ */
@@ -23,6 +23,7 @@
 #include "complex.h"
 #include "collection.h"
 #include "tuple.h"
+#include "hashmap.h"
 
 namespace bloc
 {
@@ -76,6 +77,8 @@ std::string VariableExpression::typeName(Context& ctx) const
     return t.typeName(PluginManager::instance().plugged(t.minor()).interface.name);
   case Type::ROWTYPE:
     return t.typeName(tuple_decl(ctx).tupleName());
+  case Type::MAPTYPE:
+    return t.typeName(HashMap::mapName(t));
   default:
     return t.typeName();
   }
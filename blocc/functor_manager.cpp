@@ -19,7 +19,6 @@
 #include "functor_manager.h"
 #include "context.h"
 #include "statement.h"
-#include "expression_variable.h"
 #include "debug.h"
 
 #include <cassert>
@@ -45,45 +44,37 @@ void FunctorManager::reset(const FunctorManager& fm)
     return;
   _backed.reset();
   _declarations.clear();
-  // don't copy the cache of context
+  // don't copy the frames
   for (const Entry& e : fm._declarations)
     _declarations.emplace_back(Entry(e.functor));
+  _index = fm._index;
 }
 
 unsigned FunctorManager::findDeclaration(const std::string& name, unsigned param_count)
 {
-  unsigned id = 0;
-  for (const Entry& e : _declarations)
+  auto it = _index.find(name);
+  if (it == _index.end())
+    return nid;
+  for (unsigned id : it->second)
   {
-    if (e.functor->name == name && e.functor->params.size() == param_count)
+    if (_declarations[id].functor->params.size() == param_count)
       return id;
-    ++id;
   }
   return nid;
 }
 
-bool FunctorManager::nameExists(const std::string& name) const
-{
-  for (const Entry& e : _declarations)
-  {
-    if (e.functor->name == name)
-      return true;
-  }
-  return false;
-}
-
 FunctorManager::Entry& FunctorManager::createOrReplace(const std::string& name, const std::vector<Symbol>& params)
 {
   _backed.reset();
-  for (Entry& e : _declarations)
+  unsigned id = findDeclaration(name, params.size());
+  if (id != nid)
   {
-    if (e.functor->name == name && e.functor->params.size() == params.size())
-    {
-      /* back up current declaration */
-      _backed.swap(e.functor);
-      return e;
-    }
+    /* back up current declaration */
+    Entry& e = _declarations[id];
+    _backed.swap(e.functor);
+    return e;
   }
+  _index[name].push_back(_declarations.size());
   _declarations.emplace_back(Entry(FunctorPtr(new Functor())));
   return _declarations.back();
 }
@@ -95,51 +86,87 @@ void FunctorManager::rollback()
   if (_backed)
   {
     /* revert last change, restoring the backed up */
-    if (_declarations.back().functor->name == _backed->name &&
-            _declarations.back().functor->params.size() == _backed->params.size())
-    {
-      _declarations.back().functor.swap(_backed);
-      return;
-    }
+    unsigned id = findDeclaration(_backed->name, _backed->params.size());
+    if (id != nid)
+      _declarations[id].functor.swap(_backed);
   }
   else
   {
-    /* remove last created */
+    /* remove last created, and unindex it */
+    auto it = _index.find(_declarations.back().functor->name);
+    if (it != _index.end())
+    {
+      it->second.pop_back();
+      if (it->second.empty())
+        _index.erase(it);
+    }
     _declarations.pop_back();
   }
 }
 
 FunctorManager::Env FunctorManager::createEnv(Context& caller, unsigned id, const std::vector<Expression*>& pvals)
 {
-  uint8_t r = caller.recursion();
-  if (r == RECURSION_LIMIT)
+  /* the nested calls are limited by the budget of the native stack, from
+   * the outermost call in the thread */
+  char top;
+  uintptr_t sp = reinterpret_cast<uintptr_t>(&top);
+  uintptr_t base = (caller._stack_base ? caller._stack_base : sp);
+  if ((base > sp ? base - sp : sp - base) > _root.stackBudget())
     throw RuntimeError(EXC_RT_RECURSION_LIMIT);
 
   Entry& entry = getDeclaration(id);
+  Context * _ctx = frame(entry, caller.recursion() + 1);
+  _ctx->_stack_base = base;
+  _ctx->trace(caller.trace());
+
+  /* the frame is pushed before binding, as an argument could call the
+   * functor again */
+  Env env(entry, _ctx);
+  bind(*_ctx, caller, *entry.functor, pvals);
+  return env;
+}
+
+void FunctorManager::bindTailCall(Context& caller, unsigned id, const std::vector<Expression*>& pvals)
+{
+  Entry& entry = getDeclaration(id);
+  /* the next frame replaces the caller, at the same level */
+  Context * _ctx = frame(entry, caller.recursion());
+  _ctx->_stack_base = caller._stack_base;
+  _ctx->trace(caller.trace());
+  {
+    /* the frame is held while binding, as an argument could call the
+     * functor again */
+    Env env(entry, _ctx);
+    bind(*_ctx, caller, *entry.functor, pvals);
+  }
+  entry.tail = true;
+}
 
+Context * FunctorManager::frame(Entry& entry, unsigned recursion)
+{
   Context * _ctx;
-  if (entry.ctx_cache.empty())
+  if (entry.depth < entry.frames.size())
   {
-    _ctx = entry.functor->ctx->createChildRuntime(_root, r + 1);
-    _ctx->trace(caller.trace());
+    _ctx = entry.frames[entry.depth];
+    _ctx->recursion(recursion);
+    _ctx->returnCondition(false);
   }
   else
   {
-    _ctx = entry.ctx_cache.front();
-    entry.ctx_cache.pop_front();
-    _ctx->recursion(r + 1);
-    _ctx->trace(caller.trace());
-    _ctx->returnCondition(false);
+    _ctx = entry.functor->ctx->createChildRuntime(_root, recursion);
+    entry.frames.push_back(_ctx);
   }
+  return _ctx;
+}
 
-  assert(entry.functor->params.size() == pvals.size());
-
-  /* bind parameter values ​​to variables for all symbols */
-  unsigned i = 0;
-  for (const Symbol& symbol : entry.functor->params)
-    VariableExpression(symbol).store(*_ctx, caller, pvals[i++]);
+void FunctorManager::bind(Context& frame, Context& caller, const Functor& functor,
+                          const std::vector<Expression*>& pvals)
+{
+  assert(functor.params.size() == pvals.size());
 
-  return Env(entry, _ctx);
+  /* bind parameter values to the slots of the parameters */
+  for (unsigned i = 0; i < functor.params.size(); ++i)
+    frame.storeVariable(functor.params[i].id(), std::move(pvals[i]->value(caller)));
 }
 
 }
@@ -21,13 +21,17 @@
 
 #include "expression.h"
 #include "context.h"
+#include "token.h"
 
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
-#include <forward_list>
+#include <unordered_map>
 
-#define RECURSION_LIMIT 0xff
+/* the maximum count of tokens of the returned expression of an inlined
+ * functor */
+#define INLINE_THRESHOLD 32
 
 namespace bloc
 {
@@ -42,6 +46,8 @@ struct Functor
   Type returns;                       /* Type returned */
   Context * ctx = nullptr;            /* required parse context */
   const Statement * body = nullptr;   /* statement (begin ... end) */
+  std::vector<TokenPtr> inlined;      /* tokens of the returned expression,
+                                         when the body can be inlined */
 
   Functor() { }
   ~Functor();
@@ -68,8 +74,12 @@ public:
   {
     /* the shareable functor */
     FunctorPtr functor;
-    /* the context cache */
-    std::forward_list<Context*> ctx_cache;
+    /* the stack of frames, one by depth of recursion */
+    std::vector<Context*> frames;
+    /* the count of frames in use */
+    unsigned depth = 0;
+    /* the next frame is bound by a call in tail position */
+    bool tail = false;
 
     explicit Entry(const FunctorPtr& _functor) : functor(_functor) { }
 
@@ -78,17 +88,19 @@ public:
 
     ~Entry() { clearCache(); }
 
-    Entry(Entry&& e) noexcept
+    Entry(Entry&& e) noexcept : depth(e.depth), tail(e.tail)
     {
       functor.swap(e.functor);
-      ctx_cache.swap(e.ctx_cache);
+      frames.swap(e.frames);
+      e.depth = 0;
     }
 
+    /* release the frames not in use */
     void clearCache()
     {
-      for (Context*c : ctx_cache)
-        delete c;
-      ctx_cache.clear();
+      for (size_t i = depth; i < frames.size(); ++i)
+        delete frames[i];
+      frames.resize(depth);
     }
   };
 
@@ -105,7 +117,10 @@ public:
    * @param name The name of the declaration
    * @return true if the given name exists, else false
    */
-  bool nameExists(const std::string& name) const;
+  bool nameExists(const std::string& name) const
+  {
+    return _index.find(name) != _index.end();
+  }
 
   typedef std::vector<Entry> container;
 
@@ -123,10 +138,12 @@ public:
     return _declarations[id];
   }
 
-  /* A runtime context is cached after use. It will be reused for the
-   * next call, thus avoiding a new cloning of the prestine context.
-   * The env factory reuses cached contexts or creates a new one.
-   * The env destructor returns its context to the cache.
+  /* The runtime contexts of a functor are the frames of a stack, one by
+   * depth of recursion, which are kept after use. The frame of a depth will
+   * be reused for the next call at this depth, thus avoiding a new cloning
+   * of the prestine context. The env factory pushes the frame, creating it
+   * when the depth is reached for the first time. The env destructor pops
+   * the frame.
    */
   class Env
   {
@@ -136,22 +153,37 @@ public:
   public:
 
     Env(FunctorManager::Entry& entry, Context * ctx)
-    : _entry(entry), _ctx(ctx) { }
+    : _entry(entry), _ctx(ctx) { ++_entry.depth; }
 
     Env(const Env& e) = delete;
     Env& operator=(const Env& e) = delete;
 
     ~Env()
     {
-      // recycle the context
+      // pop the frame
       if (_ctx)
-        _entry.ctx_cache.push_front(_ctx);
+        --_entry.depth;
     }
 
     Env(Env&& e) noexcept : _entry(e._entry), _ctx(e._ctx) { e._ctx = nullptr; }
 
     Functor& functor() { return *_entry.functor; }
     Context& context() { return *_ctx; }
+
+    /**
+     * Replace the frame by the next one, when it has been bound by a call
+     * in tail position. The body must be run again with the new frame.
+     * @return true if the frame has been replaced
+     */
+    bool tailCall()
+    {
+      if (!_entry.tail)
+        return false;
+      _entry.tail = false;
+      std::swap(_entry.frames[_entry.depth - 1], _entry.frames[_entry.depth]);
+      _ctx = _entry.frames[_entry.depth - 1];
+      return true;
+    }
   };
 
   /**
@@ -165,6 +197,17 @@ public:
    */
   Env createEnv(Context& caller, unsigned id, const std::vector<Expression*>& pvals);
 
+  /**
+   * Bind the parameters of a call in tail position to the next frame of the
+   * functor. The caller must be the frame on top, running the body of the
+   * same functor. The call is completed by the Env of the caller, which
+   * replaces its frame by the next one.
+   * @param caller the frame in which the call is made
+   * @param id the entry id
+   * @param pvals the list of expressions passed as parameters
+   */
+  void bindTailCall(Context& caller, unsigned id, const std::vector<Expression*>& pvals);
+
   Context * getRoot() { return &_root; }
 
   Context * createChildShell(Context& ctx)
@@ -175,7 +218,14 @@ public:
 private:
   Context& _root;
   container _declarations;
+
+  Context * frame(Entry& entry, unsigned recursion);
+  static void bind(Context& frame, Context& caller, const Functor& functor,
+                   const std::vector<Expression*>& pvals);
   FunctorPtr _backed;
+
+  /* index of declarations by name, listing the ids of each overload */
+  std::unordered_map<std::string, std::vector<unsigned> > _index;
 };
 
 }
@@ -0,0 +1,332 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "hashmap.h"
+#include "tuple.h"
+
+#include <cassert>
+
+/* the maximum load of the index, as a power of 2 */
+#define HASHMAP_LOAD_SHIFT  1
+
+namespace bloc
+{
+
+const size_t HashMap::npos = (size_t)(-1);
+
+static TupleDecl::Decl value_decl(const Type& type)
+{
+  return TupleDecl::Decl(1, HashMap::value_type(type));
+}
+
+HashMap::HashMap(const Type& type)
+: _type(type), _decl(entry_decl(type)), _values(value_decl(type))
+{
+  assert(supported_key(key_type()) && supported_value(value_type()));
+}
+
+HashMap::HashMap(const HashMap& m) noexcept
+: TupleDecl(), SharedPayload()
+, _type(m._type), _decl(m._decl), _shift(m._shift)
+, _slots(m._slots), _hashes(m._hashes), _ikeys(m._ikeys), _skeys(m._skeys)
+, _values(m._values)
+{
+}
+
+void HashMap::reserve(size_t n)
+{
+  size_t capacity = 8;
+  while ((capacity >> HASHMAP_LOAD_SHIFT) < n)
+    capacity <<= 1;
+  if (capacity > _slots.size())
+    rehash(capacity);
+  _hashes.reserve(n);
+  if (key_type() == Type::INTEGER)
+    _ikeys.reserve(n);
+  else
+    _skeys.reserve(n);
+  _values.reserve(n);
+}
+
+void HashMap::clear()
+{
+  _slots.clear();
+  _shift = 32;
+  _hashes.clear();
+  _ikeys.clear();
+  _skeys.clear();
+  _values.clear();
+}
+
+uint32_t HashMap::hash(const Value& key) const
+{
+  if (key.isNull() || key.type() != key_type())
+    throw RuntimeError(EXC_RT_TYPE_MISMATCH_S, key_type().typeName().c_str());
+  if (key_type() == Type::INTEGER)
+  {
+    uint64_t k = (uint64_t)*const_cast<Value&>(key).integer();
+    return (uint32_t)(k ^ (k >> 32));
+  }
+  /*
+   * DJB Hash Function
+   */
+  const Literal& s = *const_cast<Value&>(key).literal();
+  uint32_t h = 5381;
+  for (char c : s)
+    h = ((h << 5) + h) + (unsigned char)c;
+  return h;
+}
+
+bool HashMap::equal(size_t pos, const Value& key) const
+{
+  if (key_type() == Type::INTEGER)
+    return _ikeys[pos] == *const_cast<Value&>(key).integer();
+  return _skeys[pos] == *const_cast<Value&>(key).literal();
+}
+
+size_t HashMap::find(const Value& key) const
+{
+  uint32_t h = hash(key);
+  if (_values.size() == 0)
+    return npos;
+  size_t mask = _slots.size() - 1;
+  for (size_t i = home(h); _slots[i] != 0; i = (i + 1) & mask)
+  {
+    size_t pos = _slots[i] - 1;
+    if (_hashes[pos] == h && equal(pos, key))
+      return pos;
+  }
+  return npos;
+}
+
+size_t HashMap::insert(const Value& key)
+{
+  uint32_t h = hash(key);
+  if (((_values.size() + 1) << HASHMAP_LOAD_SHIFT) > _slots.size())
+    rehash(_slots.empty() ? 8 : _slots.size() << 1);
+  size_t mask = _slots.size() - 1;
+  size_t i = home(h);
+  for (; _slots[i] != 0; i = (i + 1) & mask)
+  {
+    size_t pos = _slots[i] - 1;
+    if (_hashes[pos] == h && equal(pos, key))
+      return pos;
+  }
+  /* append the new entry */
+  size_t pos = _values.size();
+  _slots[i] = (uint32_t)(pos + 1);
+  _hashes.push_back(h);
+  if (key_type() == Type::INTEGER)
+    _ikeys.push_back(*const_cast<Value&>(key).integer());
+  else
+    _skeys.push_back(*const_cast<Value&>(key).literal());
+  _values.append();
+  return pos;
+}
+
+size_t HashMap::slot_of(size_t pos) const
+{
+  size_t mask = _slots.size() - 1;
+  size_t i = home(_hashes[pos]);
+  while (_slots[i] != pos + 1)
+    i = (i + 1) & mask;
+  return i;
+}
+
+bool HashMap::erase(const Value& key)
+{
+  size_t pos = find(key);
+  if (pos == npos)
+    return false;
+  /* clear the slot, then shift back the following entries of the cluster,
+   * which are not at their home */
+  size_t mask = _slots.size() - 1;
+  size_t i = slot_of(pos);
+  size_t j = i;
+  for (;;)
+  {
+    j = (j + 1) & mask;
+    if (_slots[j] == 0)
+      break;
+    size_t k = home(_hashes[_slots[j] - 1]);
+    if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j)))
+    {
+      _slots[i] = _slots[j];
+      i = j;
+    }
+  }
+  _slots[i] = 0;
+  /* move the last entry into the place of the deleted one */
+  size_t last = _values.size() - 1;
+  if (pos != last)
+  {
+    _slots[slot_of(last)] = (uint32_t)(pos + 1);
+    _hashes[pos] = _hashes[last];
+    if (key_type() == Type::INTEGER)
+      _ikeys[pos] = _ikeys[last];
+    else
+      _skeys[pos].swap(_skeys[last]);
+  }
+  _hashes.pop_back();
+  if (key_type() == Type::INTEGER)
+    _ikeys.pop_back();
+  else
+    _skeys.pop_back();
+  _values.erase(pos);
+  return true;
+}
+
+void HashMap::rehash(size_t capacity)
+{
+  unsigned shift = 32;
+  for (size_t n = capacity; n > 1; n >>= 1)
+    --shift;
+  _shift = shift;
+  _slots.assign(capacity, 0);
+  size_t mask = capacity - 1;
+  for (size_t pos = 0; pos < _hashes.size(); ++pos)
+  {
+    size_t i = home(_hashes[pos]);
+    while (_slots[i] != 0)
+      i = (i + 1) & mask;
+    _slots[i] = (uint32_t)(pos + 1);
+  }
+}
+
+void HashMap::load_view(size_t pos, Value& view) const
+{
+  if (view.isNull() || view.type() != Type::ROWTYPE || view.type().level() != 0 ||
+          view.tuple()->shared() || view.tuple()->tuple_decl() != _decl)
+  {
+    Tuple::container_t items(2);
+    items[0] = Value(key_type());
+    items[1] = Value(value_type());
+    view = Value(new Tuple(std::move(items)));
+  }
+  Tuple& t = *view.tuple();
+  if (key_type() == Type::INTEGER)
+  {
+    if (t[0].isNull())
+      t[0] = Value(_ikeys[pos]);
+    else
+      *t[0].integer() = _ikeys[pos];
+  }
+  else
+  {
+    if (t[0].isNull())
+      t[0] = Value(_skeys[pos]);
+    else
+      t[0].literal()->assign(_skeys[pos]);
+  }
+  _values.get(pos, 0, t[1]);
+  view.to_lvalue(true);
+}
+
+void HashMap::store_view(size_t pos, Value& view)
+{
+  if (view.isNull() || view.type() != Type::ROWTYPE || view.type().level() != 0 ||
+          view.tuple()->tuple_decl() != _decl)
+    throw RuntimeError(EXC_RT_TYPE_MISMATCH_S, mapName(_type).c_str());
+  _values.set(pos, 0, (*view.tuple())[1]);
+}
+
+Type HashMap::make_type(const Type& key_type, const Type& value_type)
+{
+  if (!supported_key(key_type) || !supported_value(value_type))
+    return Type(Type::MAPTYPE);
+  return Type(Type::MAPTYPE, (Type::TypeMinor) (key_type.major() | (value_type.major() << 4)));
+}
+
+TupleDecl::Decl HashMap::entry_decl(const Type& map_type)
+{
+  TupleDecl::Decl decl;
+  decl.push_back(key_type(map_type));
+  decl.push_back(value_type(map_type));
+  return decl;
+}
+
+Type HashMap::key_type(const Type& map_type)
+{
+  return Type((Type::TypeMajor) (map_type.minor() & 0xf));
+}
+
+Type HashMap::value_type(const Type& map_type)
+{
+  return Type((Type::TypeMajor) ((map_type.minor() >> 4) & 0xf));
+}
+
+bool HashMap::supported_key(const Type& type)
+{
+  return (type.level() == 0 &&
+          (type.major() == Type::INTEGER || type.major() == Type::LITERAL));
+}
+
+bool HashMap::supported_value(const Type& type)
+{
+  if (type.level() != 0)
+    return false;
+  switch (type.major())
+  {
+  case Type::BOOLEAN:
+  case Type::INTEGER:
+  case Type::NUMERIC:
+  case Type::IMAGINARY:
+  case Type::LITERAL:
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool HashMap::key_checking(const Type& type, const Type& map_type)
+{
+  if (type == Type::NO_TYPE)
+    return true;
+  return (supported_key(type) &&
+          (map_type.minor() == 0 || type.major() == key_type(map_type).major()));
+}
+
+bool HashMap::value_checking(const Type& type, const Type& map_type)
+{
+  if (type == Type::NO_TYPE)
+    return true;
+  if (!supported_value(type))
+    return false;
+  if (map_type.minor() == 0)
+    return true;
+  const Type value = value_type(map_type);
+  /* type mixing */
+  return (type.major() == value.major() ||
+          (type == Type::INTEGER && value == Type::NUMERIC) ||
+          (type == Type::NUMERIC && value == Type::INTEGER));
+}
+
+std::string HashMap::mapName(const Type& map_type)
+{
+  std::string sb(Type::typeName(Type::MAPTYPE));
+  if (map_type.minor() == 0)
+    return sb;
+  sb.append("{ ")
+    .append(Type::typeName(key_type(map_type).major()))
+    .append(", ")
+    .append(Type::typeName(value_type(map_type).major()))
+    .append(" }");
+  return sb;
+}
+
+}
@@ -0,0 +1,139 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef HASHMAP_H_
+#define HASHMAP_H_
+
+#include "declspec.h"
+#include "intrinsic_type.h"
+#include "value.h"
+#include "tuple_decl.h"
+#include "shared_payload.h"
+#include "columns.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace bloc
+{
+
+/**
+ * The map associates keys of type integer or string, to values of a scalar
+ * type: boolean, integer, decimal, complex or string.
+ * The entries are stored densely, the keys apart from the values, and they
+ * are indexed by an open addressing table with linear probing. The entries
+ * are kept in order of insertion, until one is deleted: then the last entry
+ * takes its place.
+ * The types of the key and the value are coded in the minor of the map type,
+ * so the minor of a map of undefined structure is zero.
+ */
+class HashMap : public TupleDecl, public SharedPayload
+{
+public:
+  LIBBLOC_API static const size_t npos;
+
+  virtual ~HashMap() { }
+  explicit HashMap(const Type& type);
+  HashMap(const HashMap& m) noexcept;
+  HashMap& operator=(const HashMap& m) = delete;
+
+  const Type& map_type() const { return _type; }
+  const Type& key_type() const { return _decl[0]; }
+  const Type& value_type() const { return _decl[1]; }
+
+  /* the structure of the entry: the key, then the value */
+  const Decl& tuple_decl() const override { return _decl; }
+
+  size_t size() const { return _values.size(); }
+  void reserve(size_t n);
+  void clear();
+
+  /**
+   * Find the entry of the key.
+   * @return the position of the entry, or npos
+   */
+  size_t find(const Value& key) const;
+
+  /**
+   * Find the entry of the key, or append a new one with a null value.
+   * @return the position of the entry
+   */
+  size_t insert(const Value& key);
+
+  /**
+   * Delete the entry of the key.
+   * @return false if the key was not found
+   */
+  bool erase(const Value& key);
+
+  /**
+   * Load the value of the entry, reusing the storage of v.
+   */
+  void value(size_t pos, Value& v) const { _values.get(pos, 0, v); }
+
+  /**
+   * Store the value into the entry. It must be of the declared type, or null.
+   */
+  void store(size_t pos, Value& v) { _values.set(pos, 0, v); }
+
+  /**
+   * Load the entry into the tuple of the view, reusing it when it is not
+   * shared, else into a new tuple.
+   */
+  void load_view(size_t pos, Value& view) const;
+
+  /**
+   * Store the value from the tuple of the view. The key is read-only.
+   */
+  void store_view(size_t pos, Value& view);
+
+  /**
+   * Make the type of map.
+   * @return the map of undefined structure if a type is not supported
+   */
+  static Type make_type(const Type& key_type, const Type& value_type);
+  static Decl entry_decl(const Type& map_type);
+  static Type key_type(const Type& map_type);
+  static Type value_type(const Type& map_type);
+  static bool supported_key(const Type& type);
+  static bool supported_value(const Type& type);
+  /* the key or the value could be opaque, as the map */
+  static bool key_checking(const Type& type, const Type& map_type);
+  static bool value_checking(const Type& type, const Type& map_type);
+  static std::string mapName(const Type& map_type);
+
+private:
+  Type _type;
+  Decl _decl;
+  unsigned _shift = 32;
+  std::vector<uint32_t> _slots;   ///< position of the entry + 1, else 0
+  std::vector<uint32_t> _hashes;  ///< hash of the key, by entry
+  std::vector<Integer> _ikeys;    ///< integer keys, by entry
+  std::vector<Literal> _skeys;    ///< string keys, by entry
+  Columns _values;                ///< values, by entry
+
+  uint32_t hash(const Value& key) const;
+  bool equal(size_t pos, const Value& key) const;
+  size_t home(uint32_t h) const { return (size_t)((uint32_t)(h * 2654435769U) >> _shift); }
+  size_t slot_of(size_t pos) const;
+  void rehash(size_t capacity);
+};
+
+}
+
+#endif /* HASHMAP_H_ */
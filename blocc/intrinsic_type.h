@@ -49,6 +49,7 @@ public:
     ROWTYPE,
     POINTER,
     IMAGINARY,
+    MAPTYPE,
   };
 
   virtual ~Type() { }
@@ -101,6 +102,7 @@ public:
   constexpr static const char * STR_ROWTYPE = "tuple";
   constexpr static const char * STR_POINTER = "pointer";
   constexpr static const char * STR_IMAGINARY = "complex";
+  constexpr static const char * STR_MAPTYPE = "map";
 
   static const char * typeName(TypeMajor type)
   {
@@ -126,6 +128,8 @@ public:
       return STR_ROWTYPE;
     case POINTER:
       return STR_POINTER;
+    case MAPTYPE:
+      return STR_MAPTYPE;
     }
     return "?";
   }
@@ -150,11 +154,13 @@ public:
       return Type::ROWTYPE;
     if (text == STR_POINTER)
       return Type::POINTER;
+    if (text == STR_MAPTYPE)
+      return Type::MAPTYPE;
     return Type::NO_TYPE;
   }
 
 protected:
-  TypeMinor _minor = 0; ///< id of the extended type of COMPLEX or ROWTYPE
+  TypeMinor _minor = 0; ///< id of the extended type of COMPLEX, ROWTYPE or MAPTYPE
   TypeLevel _level = 0; ///< nb of dimension, zero for the base type
   TypeMajor _major;     ///< the base type
 };
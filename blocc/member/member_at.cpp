@@ -21,6 +21,7 @@
 #include <blocc/exception_parse.h>
 #include <blocc/collection.h>
 #include <blocc/tuple.h>
+#include <blocc/hashmap.h>
 #include <blocc/context.h>
 #include <blocc/parser.h>
 #include <blocc/debug.h>
@@ -43,6 +44,10 @@ const Type& MemberATExpression::type(Context& ctx) const
       return Value::type_integer;
     case Type::NO_TYPE: /* opaque */
       return exp_type;
+    case Type::MAPTYPE:
+      /* opaque when the map is of undefined structure */
+      _type_volatile = HashMap::value_type(exp_type);
+      return _type_volatile;
     default:
       return Value::type_no_type;
     }
@@ -65,15 +70,31 @@ Value& MemberATExpression::value(Context& ctx) const
   /* collection */
   if (val.type().level() > 0)
   {
-    Collection * rv = val.collection();
+    /* the element of a shared table must be copied by the consumer */
+    Collection * rv = (_mutable ? val.detach().collection() : val.collection());
     Integer p = *a0.integer();
     if (p >= 0 && size_t(p) < rv->size())
-      return rv->at((unsigned)p).to_lvalue(val.lvalue());
+    {
+      /* the row of a columnar table is made on demand */
+      if (!_mutable && rv->columnar())
+        return ctx.allocate(rv->row((unsigned)p));
+      return rv->at((unsigned)p).to_lvalue(val.lvalue() || rv->shared());
+    }
     throw RuntimeError(EXC_RT_INDEX_RANGE_S, a0.toString().c_str());
   }
 
   switch (val.type().major())
   {
+  case Type::MAPTYPE:
+  {
+    HashMap * rv = val.map();
+    /* the value of a missing key is null */
+    Value& v = ctx.allocate(Value(rv->value_type()));
+    size_t pos = rv->find(a0);
+    if (pos != HashMap::npos)
+      rv->value(pos, v);
+    return v;
+  }
   case Type::LITERAL:
   {
     Literal * rv = val.literal();
@@ -111,16 +132,24 @@ MemberATExpression * MemberATExpression::parse(Parser& p, Context& ctx, Expressi
   try
   {
     args.push_back(ParseExpression::expression(p, ctx));
-    if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx))
+
+    const Type exp_type = exp->type(ctx);
+    if (exp_type.level() == 0 && exp_type == Type::MAPTYPE)
+    {
+      if (!HashMap::key_checking(args.back()->type(ctx), exp_type))
+        throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_AT], t);
+    }
+    else if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx) &&
+        (exp_type != Type::NO_TYPE || args.back()->type(ctx) != Type::LITERAL))
       throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_AT], t);
 
-    const Type& exp_type = exp->type(ctx);
-    /* supported type: collection, literal, tabchar */
+    /* supported type: collection, literal, tabchar, map */
     if (exp_type.level() == 0)
     {
       switch (exp_type.major())
       {
       case Type::NO_TYPE: /* opaque */
+      case Type::MAPTYPE:
       case Type::LITERAL:
       case Type::TABCHAR:
         break;
@@ -30,6 +30,7 @@ class Parser;
 class MemberATExpression : public MemberExpression
 {
   mutable Type _type_volatile;
+  bool _mutable = false;
 
 public:
 
@@ -47,6 +48,8 @@ public:
 
   const TupleDecl::Decl& tuple_decl(Context& ctx) const override;
 
+  void setMutable() override { _mutable = true; _exp->setMutable(); }
+
   static MemberATExpression * parse(Parser& p, Context& ctx, Expression * exp);
 };
 
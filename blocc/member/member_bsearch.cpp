@@ -0,0 +1,109 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "member_bsearch.h"
+#include "member_sort.h"
+#include <blocc/parse_expression.h>
+#include <blocc/exception_parse.h>
+#include <blocc/collection.h>
+#include <blocc/context.h>
+#include <blocc/parser.h>
+#include <blocc/debug.h>
+
+namespace bloc
+{
+
+Value& MemberBSEARCHExpression::value(Context& ctx) const
+{
+  Value& val = _exp->value(ctx);
+  Value * a0 = (_args.size() > 1 ? &(_args[0]->value(ctx)) : nullptr);
+  Value& key = _args.back()->value(ctx);
+  if (val.type().level() == 0)
+    throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[_builtin]);
+  if (val.isNull())
+    return ctx.allocate(Value(Value::type_integer));
+  Collection * rv = val.collection();
+  int field = MemberSORTExpression::sortField(rv, a0, _builtin);
+  /* the key must be comparable with the elements */
+  const Type& rv_type = (field < 0 ? rv->table_type().levelDown() : rv->table_decl()[field]);
+  const Type& key_type = key.type();
+  if (key_type != Type::NO_TYPE && key_type.major() != rv_type.major() &&
+          (key_type.level() != 0 ||
+          (key_type != Type::INTEGER && key_type != Type::NUMERIC) ||
+          (rv_type != Type::INTEGER && rv_type != Type::NUMERIC)))
+    throw RuntimeError(EXC_RT_TYPE_MISMATCH_S, rv_type.typeName().c_str());
+  size_t pos;
+  if (rv->bsearch(key, _desc, field, pos))
+    return ctx.allocate(Value(Integer(pos)));
+  return ctx.allocate(Value(Value::type_integer));
+}
+
+std::string MemberBSEARCHExpression::unparse(Context& ctx) const
+{
+  std::string sb(_exp->unparse(ctx).append(1, OPERATOR));
+  sb.append(KEYWORDS[_builtin]).append(1, '(');
+  for (const Expression * e : _args)
+    sb.append(e->unparse(ctx)).append(1, Parser::Chain).append(1, ' ');
+  sb.append(MemberSORTExpression::unparseOrder(_desc, false)).append(1, ')');
+  return sb;
+}
+
+MemberBSEARCHExpression * MemberBSEARCHExpression::parse(Parser& p, Context& ctx, Expression * exp)
+{
+  std::vector<Expression*> args;
+  TokenPtr t = p.pop();
+
+  if (t->code != '(')
+    throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_BSEARCH], t);
+  try
+  {
+    bool desc = false;
+    /* [column ,] value */
+    for (;;)
+    {
+      args.push_back(ParseExpression::expression(p, ctx));
+      if (p.front()->code != Parser::Chain)
+        break;
+      p.pop();
+      if (MemberSORTExpression::parseOrder(p, desc, nullptr))
+        break;
+      if (args.size() == 2)
+        throw ParseError(EXC_PARSE_MEMB_ARG_NUM_S, KEYWORDS[BTM_BSEARCH], p.front());
+    }
+    if (args.size() > 1 && !ParseExpression::typeChecking(args.front(), Type::INTEGER, p, ctx))
+      throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_BSEARCH], t);
+    MemberSORTExpression::assertSortable(p, ctx, exp, args.size() > 1, BTM_BSEARCH);
+    /* the value of a table of known type */
+    const Type& exp_type = exp->type(ctx);
+    if (args.size() == 1 && exp_type.level() == 1 && exp_type != Type::NO_TYPE &&
+            !ParseExpression::typeChecking(args.back(), exp_type.levelDown(), p, ctx))
+      throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_BSEARCH], t);
+    assertClosedMember(p, ctx, KEYWORDS[BTM_BSEARCH]);
+    return new MemberBSEARCHExpression(exp, std::move(args), desc);
+  }
+  catch (ParseError& pe)
+  {
+    DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    for (Expression * e : args)
+      delete e;
+    throw;
+  }
+  return nullptr;
+}
+
+}
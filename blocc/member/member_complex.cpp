@@ -59,27 +59,12 @@ Value& MemberMETHODExpression::value(Context& ctx) const
   if (val.type().minor() != _method_type_id)
     throw RuntimeError(EXC_RT_BAD_COMPLEX_S, plug.interface.name);
 
-  Value * ret = plug.instance->executeMethod(
-          *val.complex(), _method->id, ctx, _args);
+  /* the result is stored in a slot of the temporary storage */
+  Value * ret = plug.instance->invokeMethod(
+          val, _method->id, ctx, _args, ctx.allocate(Value()));
   if (ret == nullptr)
     throw RuntimeError(EXC_RT_MEMB_FAILED_S, _method->name);
-  if (ret->lvalue())
-  {
-    return *ret;
-  }
-  else if (ret->type() == Type::COMPLEX && !ret->isNull() &&
-          ret->complex()->operator==(*val.complex()))
-  {
-    /* do not allocate for a copy */
-    delete ret;
-    return val;
-  }
-  else
-  {
-    Value& v = ctx.allocate(std::move(*ret));
-    delete ret;
-    return v;
-  }
+  return *ret;
 }
 
 std::string MemberMETHODExpression::typeName(Context& ctx) const
@@ -187,6 +172,8 @@ MemberMETHODExpression * MemberMETHODExpression::parse(Parser& p, Context& ctx,
             {
               found = true;
               score += 2;
+              /* the variable could be written by the method */
+              ctx.symbolWritten(args[a]->symbolId());
             }
             break;
           }
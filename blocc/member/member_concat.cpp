@@ -92,8 +92,9 @@ Value& MemberCONCATExpression::value(Context& ctx) const
       return val;
     }
 
-    /* when expression isn't null, then process concatenation */
-    Collection * rv = val.collection();
+    /* when expression isn't null, then process concatenation; the shared
+     * table is copied before update */
+    Collection * rv = val.detach().collection();
     const Type& rv_type = rv->table_type();
     const Type& a0_type = a0.type();
     /* collection */
@@ -116,7 +117,7 @@ Value& MemberCONCATExpression::value(Context& ctx) const
         }
         else
         {
-          if (a0.lvalue())
+          if (a0.lvalue() || a->shared())
           {
             /* inline clone */
             for (const Value& e : *a)
@@ -241,7 +242,7 @@ Value& MemberCONCATExpression::value(Context& ctx) const
           ctx.getSymbol(_exp->symbolId()).upgrade(val.type());
         return val;
       }
-      val.swap(Value(new Literal(1, (char)c)).to_lvalue(val.lvalue()));
+      val.swap(Value(Literal(1, (char)c)).to_lvalue(val.lvalue()));
       /* a symbol must be upgraded */
       if (_exp->isVarName())
         ctx.getSymbol(_exp->symbolId()).upgrade(val.type());
@@ -259,8 +260,8 @@ Value& MemberCONCATExpression::value(Context& ctx) const
       if (_exp->isConst())
       {
         if (val.isNull())
-          return ctx.allocate(std::move(Value(new Literal(*a0.literal()))));
-        Value v(new Literal(*val.literal()));
+          return ctx.allocate(std::move(Value(Literal(*a0.literal()))));
+        Value v(*val.literal());
         v.literal()->append(*a0.literal());
         return ctx.allocate(std::move(v));
       }
@@ -283,13 +284,13 @@ Value& MemberCONCATExpression::value(Context& ctx) const
       if (_exp->isConst())
       {
         if (val.isNull())
-          return ctx.allocate(Value(new Literal(1, (char)c)));
-        Value v(new Literal(*val.literal()));
+          return ctx.allocate(Value(Literal(1, (char)c)));
+        Value v(*val.literal());
         v.literal()->append(1, (char)c);
         return ctx.allocate(std::move(v));
       }
       if (val.isNull())
-       val.swap(Value(new Literal(1, (char)c)).to_lvalue(val.lvalue()));
+       val.swap(Value(Literal(1, (char)c)).to_lvalue(val.lvalue()));
       else
         val.literal()->append(1, (char)c);
       return val;
@@ -376,7 +377,10 @@ MemberCONCATExpression * MemberCONCATExpression::parse(Parser& p, Context& ctx,
     const Symbol& s = ctx.getSymbol(exp->symbolId());
     if (s.locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s.name().c_str(), t);
+    ctx.symbolWritten(s.id());
   }
+  /* the accessed container will be updated in place */
+  exp->setMutable();
 
   if (t->code != '(')
     throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_CONCAT], t);
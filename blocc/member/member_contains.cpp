@@ -0,0 +1,73 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "member_contains.h"
+#include <blocc/parse_expression.h>
+#include <blocc/exception_parse.h>
+#include <blocc/hashmap.h>
+#include <blocc/context.h>
+#include <blocc/parser.h>
+#include <blocc/debug.h>
+
+namespace bloc
+{
+
+Value& MemberCONTAINSExpression::value(Context& ctx) const
+{
+  Value& val = _exp->value(ctx);
+  Value& a0 = _args[0]->value(ctx);
+  if (val.isNull() || a0.isNull())
+    return ctx.allocate(Value(Bool(false)));
+
+  if (val.type().level() == 0 && val.type() == Type::MAPTYPE)
+    return ctx.allocate(Value(Bool(val.map()->find(a0) != HashMap::npos)));
+  throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[_builtin]);
+}
+
+MemberCONTAINSExpression * MemberCONTAINSExpression::parse(Parser& p, Context& ctx, Expression * exp)
+{
+  std::vector<Expression*> args;
+  TokenPtr t = p.pop();
+
+  if (t->code != '(')
+    throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_CONTAINS], t);
+  try
+  {
+    const Type exp_type = exp->type(ctx);
+    /* supported type: map */
+    if (exp_type.level() != 0 ||
+        (exp_type != Type::MAPTYPE && exp_type != Type::NO_TYPE))
+      throw ParseError(EXC_PARSE_MEMB_NOT_IMPL_S, KEYWORDS[BTM_CONTAINS], t);
+
+    args.push_back(ParseExpression::expression(p, ctx));
+    if (!HashMap::key_checking(args.back()->type(ctx), exp_type))
+      throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_CONTAINS], t);
+    assertClosedMember(p, ctx, KEYWORDS[BTM_CONTAINS]);
+    return new MemberCONTAINSExpression(exp, std::move(args));
+  }
+  catch (ParseError& pe)
+  {
+    DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    for (Expression * e : args)
+      delete e;
+    throw;
+  }
+  return nullptr;
+}
+
+}
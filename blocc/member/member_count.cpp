@@ -22,6 +22,7 @@
 #include <blocc/exception_parse.h>
 #include <blocc/collection.h>
 #include <blocc/context.h>
+#include <blocc/hashmap.h>
 #include <blocc/parser.h>
 #include <blocc/debug.h>
 
@@ -52,6 +53,9 @@ Value& MemberCOUNTExpression::value(Context& ctx) const
       case Type::ROWTYPE:
         v = Value(Integer(val.tuple()->size()));
         break;
+      case Type::MAPTYPE:
+        v = Value(Integer(val.map()->size()));
+        break;
       default:
         throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[_builtin]);
       }
@@ -76,7 +80,7 @@ MemberCOUNTExpression * MemberCOUNTExpression::parse(Parser& p, Context& ctx, Ex
   try
   {
     const Type& exp_type = exp->type(ctx);
-    /* supported type: collection, literal, tabchar */
+    /* supported type: collection, literal, tabchar, tuple, map */
     if (exp_type.level() == 0)
     {
       switch (exp_type.major())
@@ -84,6 +88,7 @@ MemberCOUNTExpression * MemberCOUNTExpression::parse(Parser& p, Context& ctx, Ex
       case Type::LITERAL:
       case Type::TABCHAR:
       case Type::ROWTYPE:
+      case Type::MAPTYPE:
       case Type::NO_TYPE: /* opaque */
         break;
       default:
@@ -22,12 +22,14 @@
 #include <blocc/parse_expression.h>
 #include <blocc/exception_parse.h>
 #include <blocc/collection.h>
+#include <blocc/hashmap.h>
 #include <blocc/context.h>
 #include <blocc/parser.h>
 #include <blocc/debug.h>
 
 #include <cstring>
 #include <cassert>
+#include <algorithm>
 
 namespace bloc
 {
@@ -38,20 +40,37 @@ Value& MemberDELETEExpression::value(Context& ctx) const
   Value& a0 = _args[0]->value(ctx);
   if (val.isNull() || a0.isNull())
     throw RuntimeError(EXC_RT_INDEX_RANGE_S, a0.toString().c_str());
+  /* the count of elements to delete, up to the end */
+  Integer n = 1;
+  if (_args.size() > 1)
+  {
+    Value& a1 = _args[1]->value(ctx);
+    if (a1.isNull() || *a1.integer() < 0)
+      throw RuntimeError(EXC_RT_OUT_OF_RANGE);
+    n = *a1.integer();
+  }
 
   if (val.type().level() > 0)
   {
-    /* collection */
-    Collection * rv = val.collection();
+    /* collection: the shared table is copied before update */
+    Collection * rv = val.detach().collection();
     Integer p = *a0.integer();
     if (p < 0 || size_t(p) >= rv->size())
       throw RuntimeError(EXC_RT_INDEX_RANGE_S, a0.toString().c_str());
-    rv->erase(rv->begin() + p);
+    n = std::min<Integer>(n, rv->size() - p);
+    rv->erase(rv->begin() + p, rv->begin() + p + n);
     return val;
   }
 
   switch (val.type().major())
   {
+    /* map: the shared map is copied before update */
+  case Type::MAPTYPE:
+    if (_args.size() > 1)
+      throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[BTM_DELETE]);
+    if (val.map()->find(a0) != HashMap::npos)
+      val.detach().map()->erase(a0);
+    return val;
     /* literal */
   case Type::LITERAL:
   {
@@ -61,12 +80,11 @@ Value& MemberDELETEExpression::value(Context& ctx) const
       throw RuntimeError(EXC_RT_INDEX_RANGE_S, a0.toString().c_str());
     if (_exp->isConst())
     {
-      Value v(new Literal(*rv));
-      Literal * tmp = v.literal();
-      tmp->erase(tmp->begin() + p);
+      Value v(*rv);
+      v.literal()->erase(p, n);
       return ctx.allocate(std::move(v));
     }
-    rv->erase(rv->begin() + p);
+    rv->erase(p, n);
     return val;
   }
     /* tabchar */
@@ -76,7 +94,8 @@ Value& MemberDELETEExpression::value(Context& ctx) const
     Integer p = *a0.integer();
     if (p < 0 || size_t(p) >= rv->size())
       throw RuntimeError(EXC_RT_INDEX_RANGE_S, a0.toString().c_str());
-    rv->erase(rv->begin() + p);
+    n = std::min<Integer>(n, rv->size() - p);
+    rv->erase(rv->begin() + p, rv->begin() + p + n);
     return val;
   }
   default:
@@ -94,20 +113,24 @@ MemberDELETEExpression * MemberDELETEExpression::parse(Parser& p, Context& ctx,
     const Symbol& s = ctx.getSymbol(exp->symbolId());
     if (s.locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s.name().c_str(), t);
+    ctx.symbolWritten(s.id());
   }
+  /* the accessed container will be updated in place */
+  exp->setMutable();
 
   if (t->code != '(')
     throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_DELETE], t);
   try
   {
-    const Type& exp_type = exp->type(ctx);
-    /* supported type: collection, literal, tabchar */
+    const Type exp_type = exp->type(ctx);
+    /* supported type: collection, literal, tabchar, map */
     if (exp_type.level() == 0)
     {
       switch (exp_type.major())
       {
       case Type::LITERAL:
       case Type::TABCHAR:
+      case Type::MAPTYPE:
       case Type::NO_TYPE: /* opaque */
         break;
       default:
@@ -116,8 +139,22 @@ MemberDELETEExpression * MemberDELETEExpression::parse(Parser& p, Context& ctx,
     }
 
     args.push_back(ParseExpression::expression(p, ctx));
-    if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx))
+    if (exp_type.level() == 0 && exp_type == Type::MAPTYPE)
+    {
+      if (!HashMap::key_checking(args.back()->type(ctx), exp_type))
+        throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_DELETE], t);
+    }
+    else if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx) &&
+        (exp_type != Type::NO_TYPE || args.back()->type(ctx) != Type::LITERAL))
       throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_DELETE], t);
+    /* sequence: optional count of elements */
+    if ((exp_type.level() > 0 || exp_type != Type::MAPTYPE) && p.front()->code == Parser::Chain)
+    {
+      p.pop();
+      args.push_back(ParseExpression::expression(p, ctx));
+      if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx))
+        throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_DELETE], t);
+    }
     assertClosedMember(p, ctx, KEYWORDS[BTM_DELETE]);
     return new MemberDELETEExpression(exp, std::move(args));
   }
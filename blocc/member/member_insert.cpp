@@ -41,7 +41,8 @@ Value& MemberINSERTExpression::value(Context& ctx) const
 
   if (val.type().level() > 0)
   {
-    Collection * rv = val.collection();
+    /* the shared table is copied before update */
+    Collection * rv = val.detach().collection();
     const Type& rv_type = rv->table_type();
     Integer p = *a0.integer();
     if (p < 0 || size_t(p) > rv->size())
@@ -55,31 +56,11 @@ Value& MemberINSERTExpression::value(Context& ctx) const
       Collection * a = a1.collection();
       if (a->table_type() == rv_type)
       {
-        /* allocate once and for all */
-        rv->reserve(rv->size() + a->size());
-        if (a == rv)
-        {
-          /* clone and move */
-          Collection _a(*a);
-          Collection::const_iterator it = rv->begin() + p;
-          for (Value& e : _a)
-            it = rv->insert(it, std::move(e));
-          _a.clear();
-        }
-        else if (a1.lvalue())
-        {
-          /* inline clone */
-          Collection::const_iterator it = rv->begin() + p;
-          for (Value& e : *a)
-            it = rv->insert(it, e.clone());
-        }
+        /* the elements are inserted as a block */
+        if (a == rv || a1.lvalue() || a->shared())
+          rv->insert(rv->begin() + p, *a);
         else
-        {
-          /* move */
-          Collection::const_iterator it = rv->begin() + p;
-          for (Value& e : *a)
-            it = rv->insert(it, std::move(e));
-        }
+          rv->insert(rv->begin() + p, std::move(*a));
         return val;
       }
       else if (a->table_type() == rv_type.levelDown())
@@ -178,7 +159,7 @@ Value& MemberINSERTExpression::value(Context& ctx) const
     case Type::LITERAL:
       if (_exp->isConst())
       {
-        Value v(new Literal(*rv));
+        Value v(*rv);
         v.literal()->insert(p, *a1.literal());
         return ctx.allocate(std::move(v));
       }
@@ -191,7 +172,7 @@ Value& MemberINSERTExpression::value(Context& ctx) const
         throw RuntimeError(EXC_RT_OUT_OF_RANGE);
       if (_exp->isConst())
       {
-        Value v(new Literal(*rv));
+        Value v(*rv);
         v.literal()->insert(p, 1, (char)c);
         return ctx.allocate(std::move(v));
       }
@@ -258,7 +239,10 @@ MemberINSERTExpression * MemberINSERTExpression::parse(Parser& p, Context& ctx,
     const Symbol& s = ctx.getSymbol(exp->symbolId());
     if (s.locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s.name().c_str(), t);
+    ctx.symbolWritten(s.id());
   }
+  /* the accessed container will be updated in place */
+  exp->setMutable();
 
   if (t->code != '(')
     throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_INSERT], t);
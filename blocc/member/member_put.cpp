@@ -21,6 +21,7 @@
 #include <blocc/exception_parse.h>
 #include <blocc/collection.h>
 #include <blocc/tuple.h>
+#include <blocc/hashmap.h>
 #include <blocc/context.h>
 #include <blocc/parser.h>
 #include <blocc/debug.h>
@@ -41,7 +42,8 @@ Value& MemberPUTExpression::value(Context& ctx) const
 
   if (val.type().level() > 0)
   {
-    Collection * rv = val.collection();
+    /* the shared table is copied before update */
+    Collection * rv = val.detach().collection();
     const Type& rv_type = rv->table_type();
     Integer p = *a0.integer();
     if (p < 0 || size_t(p) >= rv->size())
@@ -130,6 +132,39 @@ Value& MemberPUTExpression::value(Context& ctx) const
 
   switch (val.type().major())
   {
+    /* map */
+  case Type::MAPTYPE:
+  {
+    /* the shared map is copied before update */
+    HashMap * rv = val.detach().map();
+    const Type& a1_type = a1.type();
+    const Type& rv_type = rv->value_type();
+    if (a1_type == rv_type)
+    {
+      rv->store(rv->insert(a0), a1);
+      return val;
+    }
+    /* type mixing */
+    if (a1_type == Type::NO_TYPE)
+    {
+      Value v(rv_type);
+      rv->store(rv->insert(a0), v);
+      return val;
+    }
+    if (rv_type == Type::INTEGER && a1_type == Type::NUMERIC)
+    {
+      Value v(a1.isNull() ? Value(Value::type_integer) : Value(Integer(*a1.numeric())));
+      rv->store(rv->insert(a0), v);
+      return val;
+    }
+    if (rv_type == Type::NUMERIC && a1_type == Type::INTEGER)
+    {
+      Value v(a1.isNull() ? Value(Value::type_numeric) : Value(Numeric(*a1.integer())));
+      rv->store(rv->insert(a0), v);
+      return val;
+    }
+    throw RuntimeError(EXC_RT_TYPE_MISMATCH_S, rv_type.typeName().c_str());
+  }
     /* literal */
   case Type::LITERAL:
   {
@@ -144,7 +179,7 @@ Value& MemberPUTExpression::value(Context& ctx) const
       throw RuntimeError(EXC_RT_OUT_OF_RANGE);
     if (_exp->isConst())
     {
-      Value v(new Literal(*rv));
+      Value v(*rv);
       v.literal()->replace(p, 1, 1, (char)c);
       return ctx.allocate(std::move(v));
     }
@@ -181,14 +216,17 @@ MemberPUTExpression * MemberPUTExpression::parse(Parser& p, Context& ctx, Expres
     const Symbol& s = ctx.getSymbol(exp->symbolId());
     if (s.locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s.name().c_str(), t);
+    ctx.symbolWritten(s.id());
   }
+  /* the accessed container will be updated in place */
+  exp->setMutable();
 
   if (t->code != '(')
     throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_PUT], t);
   try
   {
-    const Type& exp_type = exp->type(ctx);
-    /* supported type: collection, literal, tabchar */
+    const Type exp_type = exp->type(ctx);
+    /* supported type: collection, literal, tabchar, map */
     if (exp_type.level() == 0)
     {
       switch (exp_type.major())
@@ -196,6 +234,7 @@ MemberPUTExpression * MemberPUTExpression::parse(Parser& p, Context& ctx, Expres
       case Type::NO_TYPE: /* opaque */
       case Type::LITERAL:
       case Type::TABCHAR:
+      case Type::MAPTYPE:
         break;
       default:
         throw ParseError(EXC_PARSE_MEMB_NOT_IMPL_S, KEYWORDS[BTM_PUT], t);
@@ -203,7 +242,13 @@ MemberPUTExpression * MemberPUTExpression::parse(Parser& p, Context& ctx, Expres
     }
 
     args.push_back(ParseExpression::expression(p, ctx));
-    if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx))
+    if (exp_type.level() == 0 && exp_type == Type::MAPTYPE)
+    {
+      if (!HashMap::key_checking(args.back()->type(ctx), exp_type))
+        throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_PUT], t);
+    }
+    else if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx) &&
+        (exp_type != Type::NO_TYPE || args.back()->type(ctx) != Type::LITERAL))
       throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_PUT], t);
     t = p.pop();
     if (t->code != Parser::Chain)
@@ -216,6 +261,10 @@ MemberPUTExpression * MemberPUTExpression::parse(Parser& p, Context& ctx, Expres
       {
       case Type::NO_TYPE: /* opaque */
         break;
+      case Type::MAPTYPE: /* PUT a value of the map */
+        if (!HashMap::value_checking(args.back()->type(ctx), exp_type))
+          throw ParseError(EXC_PARSE_TYPE_MISMATCH_S, exp->typeName(ctx).c_str(), t);
+        break;
       case Type::LITERAL: /* PUT a char */
       case Type::TABCHAR: /* PUT a char */
         if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx))
@@ -41,8 +41,8 @@ Value& MemberSETExpression::value(Context& ctx) const
   if (val.type() == Type::ROWTYPE
           && val.type().level() == 0 && a0.type().level() == 0)
   {
-    /* tuple */
-    Tuple * rv = val.tuple();
+    /* tuple: the shared tuple is copied before update */
+    Tuple * rv = val.detach().tuple();
     if (_index < rv->tuple_decl().size())
     {
       if (rv->tuple_decl()[_index] == a0.type())
@@ -120,7 +120,10 @@ MemberSETExpression * MemberSETExpression::parse(Parser& p, Context& ctx, Expres
     const Symbol& s = ctx.getSymbol(exp->symbolId());
     if (s.locked())
       throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s.name().c_str(), t);
+    ctx.symbolWritten(s.id());
   }
+  /* the accessed container will be updated in place */
+  exp->setMutable();
 
   if (t->code != ItemExpression::OPERATOR)
     throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_SET], t);
@@ -0,0 +1,188 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "member_sort.h"
+#include <blocc/parse_expression.h>
+#include <blocc/exception_parse.h>
+#include <blocc/collection.h>
+#include <blocc/statement.h>
+#include <blocc/context.h>
+#include <blocc/parser.h>
+#include <blocc/debug.h>
+
+namespace bloc
+{
+
+Value& MemberSORTExpression::value(Context& ctx) const
+{
+  Value& val = _exp->value(ctx);
+  Value * a0 = (_args.empty() ? nullptr : &(_args[0]->value(ctx)));
+  if (val.type().level() == 0)
+    throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[_builtin]);
+  if (val.isNull())
+    return val;
+  /* the shared table is copied before update */
+  Collection * rv = val.detach().collection();
+  int field = sortField(rv, a0, _builtin);
+  rv->sort(_desc, field, (_parallel ? ctx.parallelism() : 1));
+  return val;
+}
+
+std::string MemberSORTExpression::unparse(Context& ctx) const
+{
+  std::string sb(_exp->unparse(ctx).append(1, OPERATOR));
+  sb.append(KEYWORDS[_builtin]).append(1, '(');
+  if (!_args.empty())
+    sb.append(_args[0]->unparse(ctx)).append(1, Parser::Chain).append(1, ' ');
+  sb.append(unparseOrder(_desc, _parallel)).append(1, ')');
+  return sb;
+}
+
+void MemberSORTExpression::assertSortable(Parser& p, Context& ctx, Expression * exp, bool column, int member)
+{
+  const Type& exp_type = exp->type(ctx);
+  if (exp_type.level() == 0)
+  {
+    if (exp_type == Type::NO_TYPE) /* opaque */
+      return;
+    throw ParseError(EXC_PARSE_MEMB_NOT_IMPL_S, KEYWORDS[member], p.front());
+  }
+  const Type elem_type = exp_type.levelDown();
+  if (elem_type.level() > 0)
+    throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[member], p.front());
+  if (elem_type == Type::NO_TYPE) /* opaque */
+    return;
+  if (column)
+  {
+    /* the key is a field of the tuple */
+    if (elem_type != Type::ROWTYPE)
+      throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[member], p.front());
+  }
+  else if (elem_type == Type::ROWTYPE)
+    throw ParseError(EXC_PARSE_MEMB_ARG_NUM_S, KEYWORDS[member], p.front());
+  else if (!Collection::sortable(elem_type))
+    throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[member], p.front());
+}
+
+bool MemberSORTExpression::parseOrder(Parser& p, bool& desc, bool * parallel)
+{
+  bool done = false;
+  TokenPtr t = p.front();
+  if (t->code == TOKEN_KEYWORD)
+  {
+    if (t->text == Statement::KEYWORDS[Statement::STMT_ASC])
+    {
+      desc = false;
+      p.pop();
+      done = true;
+    }
+    else if (t->text == Statement::KEYWORDS[Statement::STMT_DESC])
+    {
+      desc = true;
+      p.pop();
+      done = true;
+    }
+  }
+  t = p.front();
+  if (parallel && t->code == TOKEN_KEYWORD &&
+          t->text == Statement::KEYWORDS[Statement::STMT_PARALLEL])
+  {
+    *parallel = true;
+    p.pop();
+    done = true;
+  }
+  return done;
+}
+
+int MemberSORTExpression::sortField(Collection * rv, Value * column, int member)
+{
+  const Type& rv_type = rv->table_type();
+  if (column == nullptr)
+  {
+    if (!Collection::sortable(rv_type.levelDown()))
+      throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[member]);
+    return -1;
+  }
+  if (rv_type != Type::ROWTYPE || rv_type.level() != 1)
+    throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[member]);
+  if (column->isNull())
+    throw RuntimeError(EXC_RT_INDEX_RANGE_S, column->toString().c_str());
+  Integer c = *column->integer();
+  if (c < 1 || size_t(c) > rv->table_decl().size())
+    throw RuntimeError(EXC_RT_INDEX_RANGE_S, column->toString().c_str());
+  if (!Collection::sortable(rv->table_decl()[c - 1]))
+    throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[member]);
+  return (int) (c - 1);
+}
+
+std::string MemberSORTExpression::unparseOrder(bool desc, bool parallel)
+{
+  std::string sb(Statement::KEYWORDS[desc ? Statement::STMT_DESC : Statement::STMT_ASC]);
+  if (parallel)
+    sb.append(1, ' ').append(Statement::KEYWORDS[Statement::STMT_PARALLEL]);
+  return sb;
+}
+
+MemberSORTExpression * MemberSORTExpression::parse(Parser& p, Context& ctx, Expression * exp)
+{
+  std::vector<Expression*> args;
+  TokenPtr t = p.pop();
+  if (exp->symbolId() != Expression::nid)
+  {
+    const Symbol& s = ctx.getSymbol(exp->symbolId());
+    if (s.locked())
+      throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s.name().c_str(), t);
+    ctx.symbolWritten(s.id());
+  }
+  /* the accessed container will be updated in place */
+  exp->setMutable();
+
+  if (t->code != '(')
+    throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_SORT], t);
+  try
+  {
+    bool desc = false;
+    bool parallel = false;
+    if (p.front()->code != ')' && !parseOrder(p, desc, &parallel))
+    {
+      /* the rank of the field */
+      args.push_back(ParseExpression::expression(p, ctx));
+      if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx))
+        throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_SORT], t);
+      if (p.front()->code == Parser::Chain)
+      {
+        p.pop();
+        if (!parseOrder(p, desc, &parallel))
+          throw ParseError(EXC_PARSE_MEMB_ARG_NUM_S, KEYWORDS[BTM_SORT], p.front());
+      }
+    }
+    assertSortable(p, ctx, exp, !args.empty(), BTM_SORT);
+    assertClosedMember(p, ctx, KEYWORDS[BTM_SORT]);
+    return new MemberSORTExpression(exp, std::move(args), desc, parallel);
+  }
+  catch (ParseError& pe)
+  {
+    DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    for (Expression * e : args)
+      delete e;
+    throw;
+  }
+  return nullptr;
+}
+
+}
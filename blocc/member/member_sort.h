@@ -0,0 +1,89 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEMBER_SORT_H_
+#define MEMBER_SORT_H_
+
+#include <blocc/expression_member.h>
+
+namespace bloc
+{
+
+class Context;
+class Parser;
+class Collection;
+
+/**
+ * The member sort([column ,] [asc|desc] [parallel]) sorts the table in place,
+ * by element, or by the field of rank column for a table of tuples.
+ */
+class MemberSORTExpression : public MemberExpression
+{
+  bool _desc = false;
+  bool _parallel = false;
+
+public:
+
+  virtual ~MemberSORTExpression() { }
+
+  MemberSORTExpression(Expression * e, std::vector<Expression*>&& args, bool desc, bool parallel)
+  : MemberExpression(BTM_SORT, e, std::move(args)), _desc(desc), _parallel(parallel) { }
+
+  const Type& type(Context& ctx) const override { return _exp->type(ctx); }
+
+  Value& value(Context& ctx) const override;
+
+  /* it is an accessor method */
+  bool isVarName() const override { return _exp->isVarName(); }
+
+  unsigned symbolId() const override { return _exp->symbolId(); }
+
+  const TupleDecl::Decl& tuple_decl(Context& ctx) const override { return _exp->tuple_decl(ctx); }
+
+  std::string typeName(Context& ctx) const override { return _exp->typeName(ctx); }
+
+  std::string unparse(Context& ctx) const override;
+
+  static MemberSORTExpression * parse(Parser& p, Context& ctx, Expression * exp);
+
+  /* helpers shared by the members ordering a table */
+
+  /**
+   * Check the table type at parse time.
+   * @param column true if the key is a field of tuple
+   */
+  static void assertSortable(Parser& p, Context& ctx, Expression * exp, bool column, int member);
+
+  /**
+   * Parse the modifiers of the order, and of parallelism if allowed.
+   * @return true if a modifier was parsed
+   */
+  static bool parseOrder(Parser& p, bool& desc, bool * parallel);
+
+  /**
+   * Return the field of the key, or -1 to order by element.
+   * @param column the rank of the field, or null to order by element
+   */
+  static int sortField(Collection * rv, Value * column, int member);
+
+  static std::string unparseOrder(bool desc, bool parallel);
+};
+
+}
+
+#endif /* MEMBER_SORT_H_ */
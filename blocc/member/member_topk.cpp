@@ -0,0 +1,106 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "member_topk.h"
+#include "member_sort.h"
+#include <blocc/parse_expression.h>
+#include <blocc/exception_parse.h>
+#include <blocc/collection.h>
+#include <blocc/context.h>
+#include <blocc/parser.h>
+#include <blocc/debug.h>
+
+namespace bloc
+{
+
+Value& MemberTOPKExpression::value(Context& ctx) const
+{
+  Value& val = _exp->value(ctx);
+  Value * a0 = (_args.size() > 1 ? &(_args[0]->value(ctx)) : nullptr);
+  Value& n = _args.back()->value(ctx);
+  if (val.type().level() == 0)
+    throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, KEYWORDS[_builtin]);
+  if (n.isNull() || *n.integer() < 0)
+    throw RuntimeError(EXC_RT_INDEX_RANGE_S, n.toString().c_str());
+  if (val.isNull())
+    return val;
+  /* the shared table is copied before update */
+  Collection * rv = val.detach().collection();
+  int field = MemberSORTExpression::sortField(rv, a0, _builtin);
+  rv->topk((size_t) *n.integer(), _desc, field);
+  return val;
+}
+
+std::string MemberTOPKExpression::unparse(Context& ctx) const
+{
+  std::string sb(_exp->unparse(ctx).append(1, OPERATOR));
+  sb.append(KEYWORDS[_builtin]).append(1, '(');
+  for (const Expression * e : _args)
+    sb.append(e->unparse(ctx)).append(1, Parser::Chain).append(1, ' ');
+  sb.append(MemberSORTExpression::unparseOrder(_desc, false)).append(1, ')');
+  return sb;
+}
+
+MemberTOPKExpression * MemberTOPKExpression::parse(Parser& p, Context& ctx, Expression * exp)
+{
+  std::vector<Expression*> args;
+  TokenPtr t = p.pop();
+  if (exp->symbolId() != Expression::nid)
+  {
+    const Symbol& s = ctx.getSymbol(exp->symbolId());
+    if (s.locked())
+      throw ParseError(EXC_PARSE_CONST_VIOLATION_S, s.name().c_str(), t);
+    ctx.symbolWritten(s.id());
+  }
+  /* the accessed container will be updated in place */
+  exp->setMutable();
+
+  if (t->code != '(')
+    throw ParseError(EXC_PARSE_BAD_MEMB_CALL_S, KEYWORDS[BTM_TOPK], t);
+  try
+  {
+    bool desc = true;
+    /* [column ,] count */
+    for (;;)
+    {
+      args.push_back(ParseExpression::expression(p, ctx));
+      if (!ParseExpression::typeChecking(args.back(), Type::INTEGER, p, ctx))
+        throw ParseError(EXC_PARSE_MEMB_ARG_TYPE_S, KEYWORDS[BTM_TOPK], t);
+      if (p.front()->code != Parser::Chain)
+        break;
+      p.pop();
+      if (MemberSORTExpression::parseOrder(p, desc, nullptr))
+        break;
+      if (args.size() == 2)
+        throw ParseError(EXC_PARSE_MEMB_ARG_NUM_S, KEYWORDS[BTM_TOPK], p.front());
+    }
+    MemberSORTExpression::assertSortable(p, ctx, exp, args.size() > 1, BTM_TOPK);
+    assertClosedMember(p, ctx, KEYWORDS[BTM_TOPK]);
+    return new MemberTOPKExpression(exp, std::move(args), desc);
+  }
+  catch (ParseError& pe)
+  {
+    DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    for (Expression * e : args)
+      delete e;
+    throw;
+  }
+  return nullptr;
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEMBER_TOPK_H_
+#define MEMBER_TOPK_H_
+
+#include <blocc/expression_member.h>
+
+namespace bloc
+{
+
+class Context;
+class Parser;
+
+/**
+ * The member topk([column ,] n [, asc|desc]) moves the first n elements in the
+ * given order, descending by default, at the head of the table. The others
+ * are left in unspecified order.
+ */
+class MemberTOPKExpression : public MemberExpression
+{
+  bool _desc = true;
+
+public:
+
+  virtual ~MemberTOPKExpression() { }
+
+  MemberTOPKExpression(Expression * e, std::vector<Expression*>&& args, bool desc)
+  : MemberExpression(BTM_TOPK, e, std::move(args)), _desc(desc) { }
+
+  const Type& type(Context& ctx) const override { return _exp->type(ctx); }
+
+  Value& value(Context& ctx) const override;
+
+  /* it is an accessor method */
+  bool isVarName() const override { return _exp->isVarName(); }
+
+  unsigned symbolId() const override { return _exp->symbolId(); }
+
+  const TupleDecl::Decl& tuple_decl(Context& ctx) const override { return _exp->tuple_decl(ctx); }
+
+  std::string typeName(Context& ctx) const override { return _exp->typeName(ctx); }
+
+  std::string unparse(Context& ctx) const override;
+
+  static MemberTOPKExpression * parse(Parser& p, Context& ctx, Expression * exp);
+};
+
+}
+
+#endif /* MEMBER_TOPK_H_ */
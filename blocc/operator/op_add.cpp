@@ -66,7 +66,11 @@ Value& OpADDExpression::value(Context& ctx) const
 {
   Value& a1 = arg1->value(ctx);
   Value& a2 = arg2->value(ctx);
+  return operate(ctx, a1, a2);
+}
 
+Value& OpADDExpression::operate(Context& ctx, Value& a1, Value& a2) const
+{
   if (a1.type().level() == 0 && a2.type().level() == 0)
   {
     switch (a1.type().major())
@@ -109,7 +113,7 @@ Value& OpADDExpression::value(Context& ctx) const
       {
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
-        Value val(new Imaginary{Numeric(*a1.integer()) + a2.imaginary()->a, a2.imaginary()->b});
+        Value val(Imaginary{Numeric(*a1.integer()) + a2.imaginary()->a, a2.imaginary()->b});
         return LVAL2(val, a1, a2);
       }
       default:
@@ -139,7 +143,7 @@ Value& OpADDExpression::value(Context& ctx) const
       {
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
-        Value val(new Imaginary{*a1.numeric() + a2.imaginary()->a, a2.imaginary()->b});
+        Value val(Imaginary{*a1.numeric() + a2.imaginary()->a, a2.imaginary()->b});
         return LVAL2(val, a1, a2);
       }
       default:
@@ -155,21 +159,21 @@ Value& OpADDExpression::value(Context& ctx) const
       {
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
-        Value val(new Imaginary{a1.imaginary()->a + Numeric(*a2.integer()), a1.imaginary()->b});
+        Value val(Imaginary{a1.imaginary()->a + Numeric(*a2.integer()), a1.imaginary()->b});
         return LVAL2(val, a1, a2);
       }
       case Type::NUMERIC:
       {
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
-        Value val(new Imaginary{a1.imaginary()->a + *a2.numeric(), a1.imaginary()->b});
+        Value val(Imaginary{a1.imaginary()->a + *a2.numeric(), a1.imaginary()->b});
         return LVAL2(val, a1, a2);
       }
       case Type::IMAGINARY:
       {
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
-        Value val(new Imaginary{a1.imaginary()->a + a2.imaginary()->a, a1.imaginary()->b + a2.imaginary()->b});
+        Value val(Imaginary{a1.imaginary()->a + a2.imaginary()->a, a1.imaginary()->b + a2.imaginary()->b});
         return LVAL2(val, a1, a2);
       }
       default:
@@ -19,8 +19,7 @@
 #ifndef OP_BAND_H_
 #define OP_BAND_H_
 
-#include <blocc/operator.h>
-#include <blocc/expression.h>
+#include <blocc/expression_operator.h>
 
 namespace bloc
 {
@@ -28,32 +27,20 @@ namespace bloc
 class Context;
 class Parser;
 
-class OpBANDExpression : public Expression
+class OpBANDExpression : public OperatorExpression
 {
-  Expression * arg1 = nullptr;
-  Expression * arg2 = nullptr;
-  bool enc = false;
-
 public:
 
   virtual ~OpBANDExpression();
 
   OpBANDExpression(Expression * a, Expression * b)
-  : arg1(a), arg2(b) { }
+  : OperatorExpression(Operator::OP_BAND, a, b) { }
 
   const Type& type(Context& ctx) const override { return Value::type_boolean; }
 
   Value& value(Context& ctx) const override;
 
   std::string unparse(Context& ctx) const override;
-
-  bool enclosed() const override { return enc; }
-  void enclosed(bool yesno) override { enc = yesno; }
-
-  std::string toString(Context& ctx) const override
-  {
-    return Operator::OPVALS[Operator::OP_BAND];
-  }
 };
 
 }
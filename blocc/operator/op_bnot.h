@@ -19,8 +19,7 @@
 #ifndef OP_BNOT_H_
 #define OP_BNOT_H_
 
-#include <blocc/operator.h>
-#include <blocc/expression.h>
+#include <blocc/expression_operator.h>
 
 namespace bloc
 {
@@ -28,31 +27,20 @@ namespace bloc
 class Context;
 class Parser;
 
-class OpBNOTExpression : public Expression
+class OpBNOTExpression : public OperatorExpression
 {
-  Expression * arg1 = nullptr;
-  bool enc = false;
-
 public:
 
   virtual ~OpBNOTExpression();
 
   OpBNOTExpression(Expression * a)
-  : arg1(a) { }
+  : OperatorExpression(Operator::OP_BNOT, a) { }
 
   const Type& type(Context& ctx) const override { return Value::type_boolean; }
 
   Value& value(Context& ctx) const override;
 
   std::string unparse(Context& ctx) const override;
-
-  bool enclosed() const override { return enc; }
-  void enclosed(bool yesno) override { enc = yesno; }
-
-  std::string toString(Context& ctx) const override
-  {
-    return Operator::OPVALS[Operator::OP_BNOT];
-  }
 };
 
 }
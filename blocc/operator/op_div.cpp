@@ -62,7 +62,11 @@ Value& OpDIVExpression::value(Context& ctx) const
 {
   Value& a1 = arg1->value(ctx);
   Value& a2 = arg2->value(ctx);
+  return operate(ctx, a1, a2);
+}
 
+Value& OpDIVExpression::operate(Context& ctx, Value& a1, Value& a2) const
+{
   if (a1.type().level() == 0 && a2.type().level() == 0)
   {
     switch (a1.type().major())
@@ -113,7 +117,7 @@ Value& OpDIVExpression::value(Context& ctx) const
         double sc = std::pow(a2.imaginary()->a, 2) + std::pow(a2.imaginary()->b, 2);
         double a = a2.imaginary()->a / sc;
         double b = (-a2.imaginary()->b) / sc;
-        Value val(new Imaginary{Numeric(*a1.integer()) * a, Numeric(*a1.integer()) * b});
+        Value val(Imaginary{Numeric(*a1.integer()) * a, Numeric(*a1.integer()) * b});
 
         return LVAL2(val, a1, a2);
       }
@@ -154,7 +158,7 @@ Value& OpDIVExpression::value(Context& ctx) const
         double sc = std::pow(a2.imaginary()->a, 2) + std::pow(a2.imaginary()->b, 2);
         double a = a2.imaginary()->a / sc;
         double b = (-a2.imaginary()->b) / sc;
-        Value val(new Imaginary{*a1.numeric() * a, *a1.numeric() * b});
+        Value val(Imaginary{*a1.numeric() * a, *a1.numeric() * b});
 
         return LVAL2(val, a1, a2);
       }
@@ -171,14 +175,14 @@ Value& OpDIVExpression::value(Context& ctx) const
       {
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
-        Value val(new Imaginary{a1.imaginary()->a / Numeric(*a2.integer()), a1.imaginary()->b / Numeric(*a2.integer())});
+        Value val(Imaginary{a1.imaginary()->a / Numeric(*a2.integer()), a1.imaginary()->b / Numeric(*a2.integer())});
         return LVAL2(val, a1, a2);
       }
       case Type::NUMERIC:
       {
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
-        Value val(new Imaginary{a1.imaginary()->a / *a2.numeric(), a1.imaginary()->b / *a2.numeric()});
+        Value val(Imaginary{a1.imaginary()->a / *a2.numeric(), a1.imaginary()->b / *a2.numeric()});
         return LVAL2(val, a1, a2);
       }
       case Type::IMAGINARY:
@@ -189,7 +193,7 @@ Value& OpDIVExpression::value(Context& ctx) const
         double sc = std::pow(a2.imaginary()->a, 2) + std::pow(a2.imaginary()->b, 2);
         double a = a2.imaginary()->a / sc;
         double b = (-a2.imaginary()->b) / sc;
-        Value val(new Imaginary{
+        Value val(Imaginary{
                   a1.imaginary()->a * a - a1.imaginary()->b * b,
                   a1.imaginary()->a * b + a1.imaginary()->b * a
         });
@@ -64,7 +64,11 @@ Value& OpEXPExpression::value(Context& ctx) const
 {
   Value& a1 = arg1->value(ctx);
   Value& a2 = arg2->value(ctx);
+  return operate(ctx, a1, a2);
+}
 
+Value& OpEXPExpression::operate(Context& ctx, Value& a1, Value& a2) const
+{
   if (a1.type().level() == 0 && a2.type().level() == 0)
   {
     switch (a1.type().major())
@@ -106,7 +110,7 @@ Value& OpEXPExpression::value(Context& ctx) const
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
         auto z = std::pow(Numeric(*a1.integer()), IMAGINARY_TO_COMPLEX(*a2.imaginary()));
-        Value val(new Imaginary{z.real(), z.imag()});
+        Value val(Imaginary{z.real(), z.imag()});
         return LVAL2(val, a1, a2);
       }
       default:
@@ -137,7 +141,7 @@ Value& OpEXPExpression::value(Context& ctx) const
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
         auto z = std::pow(*a1.numeric(), IMAGINARY_TO_COMPLEX(*a2.imaginary()));
-        Value val(new Imaginary{z.real(), z.imag()});
+        Value val(Imaginary{z.real(), z.imag()});
         return LVAL2(val, a1, a2);
       }
       default:
@@ -154,7 +158,7 @@ Value& OpEXPExpression::value(Context& ctx) const
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
         auto z = std::pow(IMAGINARY_TO_COMPLEX(*a1.imaginary()), Numeric(*a2.integer()));
-        Value val(new Imaginary{z.real(), z.imag()});
+        Value val(Imaginary{z.real(), z.imag()});
         return LVAL2(val, a1, a2);
       }
       case Type::NUMERIC:
@@ -162,7 +166,7 @@ Value& OpEXPExpression::value(Context& ctx) const
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
         auto z = std::pow(IMAGINARY_TO_COMPLEX(*a1.imaginary()), *a2.numeric());
-        Value val(new Imaginary{z.real(), z.imag()});
+        Value val(Imaginary{z.real(), z.imag()});
         return LVAL2(val, a1, a2);
       }
       case Type::IMAGINARY:
@@ -170,7 +174,7 @@ Value& OpEXPExpression::value(Context& ctx) const
         if (a2.isNull() || a1.isNull())
           return LVAL2(Value(Value::type_imaginary), a1, a2);
         auto z = std::pow(IMAGINARY_TO_COMPLEX(*a1.imaginary()), IMAGINARY_TO_COMPLEX(*a2.imaginary()));
-        Value val(new Imaginary{z.real(), z.imag()});
+        Value val(Imaginary{z.real(), z.imag()});
         return LVAL2(val, a1, a2);
       }
       default:
@@ -19,8 +19,7 @@
 #ifndef OP_EXP_H_
 #define OP_EXP_H_
 
-#include <blocc/operator.h>
-#include <blocc/expression.h>
+#include <blocc/expression_operator.h>
 
 namespace bloc
 {
@@ -28,18 +27,14 @@ namespace bloc
 class Context;
 class Parser;
 
-class OpEXPExpression : public Expression
+class OpEXPExpression : public OperatorExpression
 {
-  Expression * arg1 = nullptr;
-  Expression * arg2 = nullptr;
-  bool enc = false;
-
 public:
 
   virtual ~OpEXPExpression();
 
   OpEXPExpression(Expression * a, Expression * b)
-  : arg1(a), arg2(b) { }
+  : OperatorExpression(Operator::OP_EXP, a, b) { }
 
   const Type& type(Context& ctx) const override;
 
@@ -47,13 +42,10 @@ public:
 
   std::string unparse(Context& ctx) const override;
 
-  bool enclosed() const override { return enc; }
-  void enclosed(bool yesno) override { enc = yesno; }
-
-  std::string toString(Context& ctx) const override
-  {
-    return Operator::OPVALS[Operator::OP_EXP];
-  }
+  /**
+   * Returns the result of the operation on the given evaluated operands.
+   */
+  Value& operate(Context& ctx, Value& a1, Value& a2) const;
 };
 
 }
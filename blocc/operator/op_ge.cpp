@@ -51,6 +51,11 @@ Value& OpGEExpression::value(Context& ctx) const
 {
   Value& a1 = arg1->value(ctx);
   Value& a2 = arg2->value(ctx);
+  return operate(ctx, a1, a2);
+}
+
+Value& OpGEExpression::operate(Context& ctx, Value& a1, Value& a2) const
+{
   if (a1.isNull() || a2.isNull())
     return LVAL2(Value(Value::type_boolean), a1, a2);
 
@@ -51,7 +51,11 @@ Value& OpIORExpression::value(Context& ctx) const
 {
   Value& a1 = arg1->value(ctx);
   Value& a2 = arg2->value(ctx);
+  return operate(ctx, a1, a2);
+}
 
+Value& OpIORExpression::operate(Context& ctx, Value& a1, Value& a2) const
+{
   if (a1.type().level() == 0 && a2.type().level() == 0)
   {
     switch (a1.type().major())
@@ -22,17 +22,19 @@
 #include <blocc/collection.h>
 #include <blocc/tuple.h>
 #include <blocc/context.h>
+#include <blocc/regex_cache.h>
 #include <blocc/debug.h>
 
 #include <cmath>
 #include <climits>
-#include <regex>
 
 namespace bloc
 {
 
 OpMATCHExpression::~OpMATCHExpression()
 {
+  if (_re)
+    delete _re;
   if (arg2)
     delete arg2;
   if (arg1)
@@ -55,9 +57,14 @@ Value& OpMATCHExpression::value(Context& ctx) const
   if (a1.isNull() || a2.isNull())
     return LVAL2(Value(Value::type_boolean), a1, a2);
 
+  if (_re)
+  {
+    Value val(Bool(std::regex_match(*a1.literal(), *_re)));
+    return LVAL2(val, a1, a2);
+  }
   try
   {
-    Value val(Bool(std::regex_match(*a1.literal(), std::regex(*a2.literal()))));
+    Value val(Bool(std::regex_match(*a1.literal(), ctx.regexCache().get(*a2.literal()))));
     return LVAL2(val, a1, a2);
   }
   catch (std::regex_error& re)
@@ -66,6 +73,15 @@ Value& OpMATCHExpression::value(Context& ctx) const
   }
 }
 
+void OpMATCHExpression::compile(Context& ctx)
+{
+  if (_re || !arg2->isConst())
+    return;
+  Value& a2 = arg2->value(ctx);
+  if (!a2.isNull())
+    _re = new std::regex(*a2.literal());
+}
+
 std::string OpMATCHExpression::unparse(Context&ctx) const
 {
   std::string str;
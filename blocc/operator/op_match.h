@@ -19,8 +19,9 @@
 #ifndef OP_MATCH_H_
 #define OP_MATCH_H_
 
-#include <blocc/operator.h>
-#include <blocc/expression.h>
+#include <blocc/expression_operator.h>
+
+#include <regex>
 
 namespace bloc
 {
@@ -28,32 +29,30 @@ namespace bloc
 class Context;
 class Parser;
 
-class OpMATCHExpression : public Expression
+class OpMATCHExpression : public OperatorExpression
 {
-  Expression * arg1 = nullptr;
-  Expression * arg2 = nullptr;
-  bool enc = false;
+  /* the compiled constant pattern */
+  std::regex * _re = nullptr;
 
 public:
 
   virtual ~OpMATCHExpression();
 
   OpMATCHExpression(Expression * a, Expression * b)
-  : arg1(a), arg2(b) { }
+  : OperatorExpression(Operator::OP_MATCH, a, b) { }
+
+  /**
+   * Compile the pattern when it is constant, otherwise it will be compiled
+   * at runtime through the cache of the context.
+   * @throw std::regex_error
+   */
+  void compile(Context& ctx);
 
   const Type& type(Context& ctx) const override { return Value::type_boolean; }
 
   Value& value(Context& ctx) const override;
 
   std::string unparse(Context& ctx) const override;
-
-  bool enclosed() const override { return enc; }
-  void enclosed(bool yesno) override { enc = yesno; }
-
-  std::string toString(Context& ctx) const override
-  {
-    return Operator::OPVALS[Operator::OP_MATCH];
-  }
 };
 
 }
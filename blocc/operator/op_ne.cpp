@@ -51,6 +51,11 @@ Value& OpNEExpression::value(Context& ctx) const
 {
   Value& a1 = arg1->value(ctx);
   Value& a2 = arg2->value(ctx);
+  return operate(ctx, a1, a2);
+}
+
+Value& OpNEExpression::operate(Context& ctx, Value& a1, Value& a2) const
+{
   if (a1.isNull() || a2.isNull())
     return LVAL2(Value(Value::type_boolean), a1, a2);
 
@@ -183,6 +188,16 @@ Value& OpNEExpression::value(Context& ctx) const
     Value val(Bool(true));
     return LVAL2(val, a1, a2);
   }
+  case Type::MAPTYPE:
+  {
+    if (t2 == Type::MAPTYPE)
+    {
+      Value val(Bool(a1.map() != a2.map()));
+      return LVAL2(val, a1, a2);
+    }
+    Value val(Bool(true));
+    return LVAL2(val, a1, a2);
+  }
   default:
     break;
   }
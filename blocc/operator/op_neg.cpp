@@ -71,7 +71,7 @@ Value& OpNEGExpression::value(Context& ctx) const
     case Type::IMAGINARY:
       if (a1.isNull())
         return a1;
-      return LVAL1(Value(new Imaginary{0.0 - a1.imaginary()->a, 0.0 - a1.imaginary()->b }), a1);
+      return LVAL1(Value(Imaginary{0.0 - a1.imaginary()->a, 0.0 - a1.imaginary()->b }), a1);
     default:
       break;
     }
@@ -0,0 +1,236 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OP_TYPED_H_
+#define OP_TYPED_H_
+
+#include <blocc/expression_operator.h>
+#include <blocc/context.h>
+#include <blocc/value.h>
+#include <blocc/exception_runtime.h>
+
+#include <cmath>
+
+namespace bloc
+{
+
+/*
+ * Specialized operator nodes, created by the parser when the static types of
+ * both operands are scalar integer or decimal. The type of a variable can
+ * still change at runtime, so the node checks the types of the evaluated
+ * operands and falls back to the generic operation of the base class when
+ * they do not match, or when an operand is null.
+ */
+
+template<typename T> struct OpScalar;
+
+template<> struct OpScalar<Integer>
+{
+  static const Type& type() { return Value::type_integer; }
+  static Integer get(Value& v) { return *v.integer(); }
+};
+
+template<> struct OpScalar<Numeric>
+{
+  static const Type& type() { return Value::type_numeric; }
+  static Numeric get(Value& v) { return *v.numeric(); }
+};
+
+template<class OP, class KERNEL, typename T1, typename T2>
+class OpTypedExpression : public OP
+{
+public:
+
+  virtual ~OpTypedExpression() { }
+
+  OpTypedExpression(Expression * a, Expression * b)
+  : OP(a, b) { }
+
+  Value& value(Context& ctx) const override
+  {
+    Value& a1 = this->arg1->value(ctx);
+    Value& a2 = this->arg2->value(ctx);
+    if (a1.type() == OpScalar<T1>::type() && a2.type() == OpScalar<T2>::type() &&
+            !a1.isNull() && !a2.isNull())
+    {
+      Value val(KERNEL::apply(OpScalar<T1>::get(a1), OpScalar<T2>::get(a2)));
+      if (!a1.lvalue())
+        return a1 = std::move(val);
+      if (!a2.lvalue())
+        return a2 = std::move(val);
+      return ctx.allocate(std::move(val));
+    }
+    return OP::operate(ctx, a1, a2);
+  }
+};
+
+/* kernels, following the semantic of the generic operations */
+
+struct OpKernelADD
+{
+  template<typename A, typename B>
+  static auto apply(A a, B b) -> decltype(a + b) { return a + b; }
+};
+
+struct OpKernelSUB
+{
+  template<typename A, typename B>
+  static auto apply(A a, B b) -> decltype(a - b) { return a - b; }
+};
+
+struct OpKernelMUL
+{
+  template<typename A, typename B>
+  static auto apply(A a, B b) -> decltype(a * b) { return a * b; }
+};
+
+struct OpKernelDIV
+{
+  template<typename A, typename B>
+  static auto apply(A a, B b) -> decltype(a / b)
+  {
+    if (b == 0)
+      throw RuntimeError(EXC_RT_DIVIDE_BY_ZERO);
+    return a / b;
+  }
+};
+
+struct OpKernelMOD
+{
+  static Integer apply(Integer a, Integer b)
+  {
+    if (b == 0)
+      throw RuntimeError(EXC_RT_DIVIDE_BY_ZERO);
+    return a % b;
+  }
+  template<typename A, typename B>
+  static Numeric apply(A a, B b)
+  {
+    if (b == 0)
+      throw RuntimeError(EXC_RT_DIVIDE_BY_ZERO);
+    return std::fmod(a, b);
+  }
+};
+
+struct OpKernelEXP
+{
+  static Integer apply(Integer a, Integer b) { return Integer(std::pow(a, b)); }
+  template<typename A, typename B>
+  static Numeric apply(A a, B b) { return std::pow(a, b); }
+};
+
+struct OpKernelEQ
+{
+  template<typename A, typename B>
+  static Bool apply(A a, B b) { return a == b; }
+};
+
+struct OpKernelNE
+{
+  template<typename A, typename B>
+  static Bool apply(A a, B b) { return a != b; }
+};
+
+struct OpKernelLT
+{
+  template<typename A, typename B>
+  static Bool apply(A a, B b) { return a < b; }
+};
+
+struct OpKernelLE
+{
+  template<typename A, typename B>
+  static Bool apply(A a, B b) { return a <= b; }
+};
+
+struct OpKernelGT
+{
+  template<typename A, typename B>
+  static Bool apply(A a, B b) { return a > b; }
+};
+
+struct OpKernelGE
+{
+  template<typename A, typename B>
+  static Bool apply(A a, B b) { return a >= b; }
+};
+
+struct OpKernelAND
+{
+  static Integer apply(Integer a, Integer b) { return a & b; }
+};
+
+struct OpKernelIOR
+{
+  static Integer apply(Integer a, Integer b) { return a | b; }
+};
+
+struct OpKernelXOR
+{
+  static Integer apply(Integer a, Integer b) { return a ^ b; }
+};
+
+struct OpKernelPOP
+{
+  static Integer apply(Integer a, Integer b) { return a << b; }
+};
+
+struct OpKernelPUS
+{
+  static Integer apply(Integer a, Integer b) { return a >> b; }
+};
+
+/**
+ * Returns the node specialized for the static types of the operands, when
+ * both are integer or decimal, else the generic node.
+ */
+template<class OP, class KERNEL>
+Expression * OpTypedNumeric(Context& ctx, Expression * a, Expression * b)
+{
+  const Type& t1 = a->type(ctx);
+  const Type& t2 = b->type(ctx);
+  if (t1 == Value::type_integer)
+  {
+    if (t2 == Value::type_integer)
+      return new OpTypedExpression<OP, KERNEL, Integer, Integer>(a, b);
+    if (t2 == Value::type_numeric)
+      return new OpTypedExpression<OP, KERNEL, Integer, Numeric>(a, b);
+  }
+  else if (t1 == Value::type_numeric)
+  {
+    if (t2 == Value::type_integer)
+      return new OpTypedExpression<OP, KERNEL, Numeric, Integer>(a, b);
+    if (t2 == Value::type_numeric)
+      return new OpTypedExpression<OP, KERNEL, Numeric, Numeric>(a, b);
+  }
+  return new OP(a, b);
+}
+
+/**
+ * Returns the node specialized for integer operands, else the generic node.
+ */
+template<class OP, class KERNEL>
+Expression * OpTypedInteger(Context& ctx, Expression * a, Expression * b)
+{
+  if (a->type(ctx) == Value::type_integer && b->type(ctx) == Value::type_integer)
+    return new OpTypedExpression<OP, KERNEL, Integer, Integer>(a, b);
+  return new OP(a, b);
+}
+
+}
+
+#endif /* OP_TYPED_H_ */
@@ -0,0 +1,640 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "optimizer.h"
+#include "context.h"
+#include "expression_operator.h"
+#include "expression_builtin.h"
+#include "expression_boolean.h"
+#include "expression_integer.h"
+#include "expression_numeric.h"
+#include "expression_literal.h"
+#include "expression_variable.h"
+#include "expression_compiled.h"
+#include "expression_cached.h"
+#include "member/member_count.h"
+#include "debug.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace bloc
+{
+
+bool Optimizer::pureBuiltin(int fc)
+{
+  switch (fc)
+  {
+  case BuiltinExpression::FUNC_MAX:
+  case BuiltinExpression::FUNC_MIN:
+  case BuiltinExpression::FUNC_FLOOR:
+  case BuiltinExpression::FUNC_ABS:
+  case BuiltinExpression::FUNC_SIGN:
+  case BuiltinExpression::FUNC_STR:
+  case BuiltinExpression::FUNC_NUM:
+  case BuiltinExpression::FUNC_CEIL:
+  case BuiltinExpression::FUNC_ROUND:
+  case BuiltinExpression::FUNC_SIN:
+  case BuiltinExpression::FUNC_COS:
+  case BuiltinExpression::FUNC_TAN:
+  case BuiltinExpression::FUNC_ATAN:
+  case BuiltinExpression::FUNC_INT:
+  case BuiltinExpression::FUNC_POW:
+  case BuiltinExpression::FUNC_SQRT:
+  case BuiltinExpression::FUNC_LOG:
+  case BuiltinExpression::FUNC_EXP:
+  case BuiltinExpression::FUNC_LOG10:
+  case BuiltinExpression::FUNC_MOD:
+  case BuiltinExpression::FUNC_ASIN:
+  case BuiltinExpression::FUNC_ACOS:
+  case BuiltinExpression::FUNC_SINH:
+  case BuiltinExpression::FUNC_COSH:
+  case BuiltinExpression::FUNC_TANH:
+  case BuiltinExpression::FUNC_CLAMP:
+  case BuiltinExpression::FUNC_ISNIL:
+  case BuiltinExpression::FUNC_ATAN2:
+  case BuiltinExpression::FUNC_HEX:
+  case BuiltinExpression::FUNC_ISNUM:
+  case BuiltinExpression::FUNC_BOOL:
+  case BuiltinExpression::FUNC_LSUB:
+  case BuiltinExpression::FUNC_RSUB:
+  case BuiltinExpression::FUNC_SUBSTR:
+  case BuiltinExpression::FUNC_CHR:
+  case BuiltinExpression::FUNC_STRLEN:
+  case BuiltinExpression::FUNC_LTRIM:
+  case BuiltinExpression::FUNC_RTRIM:
+  case BuiltinExpression::FUNC_TRIM:
+  case BuiltinExpression::FUNC_UPPER:
+  case BuiltinExpression::FUNC_LOWER:
+  case BuiltinExpression::FUNC_STRPOS:
+  case BuiltinExpression::FUNC_REPSTR:
+  case BuiltinExpression::FUNC_IMAG:
+  case BuiltinExpression::FUNC_IPHASE:
+  case BuiltinExpression::FUNC_ICONJ:
+  case BuiltinExpression::FUNC_TYPEOF:
+    return true;
+  default:
+    return false;
+  }
+}
+
+Expression * Optimizer::fold(Context& ctx, Expression * exp)
+{
+  /* a constant cannot be folded more, i.e builtin pi */
+  if (exp->isConst())
+    return exp;
+
+  OperatorExpression * op = dynamic_cast<OperatorExpression*>(exp);
+  if (op)
+  {
+    op->arg1 = fold(ctx, op->arg1);
+    bool folding = op->arg1->isConst();
+    if (op->arg2)
+    {
+      op->arg2 = fold(ctx, op->arg2);
+      folding &= op->arg2->isConst();
+    }
+    if (folding)
+      return constant(ctx, exp);
+    return exp;
+  }
+
+  BuiltinExpression * fn = dynamic_cast<BuiltinExpression*>(exp);
+  if (fn)
+  {
+    bool folding = pureBuiltin(fn->oper);
+    for (Expression *& arg : fn->_args)
+    {
+      arg = fold(ctx, arg);
+      folding &= arg->isConst();
+    }
+    if (folding)
+      return constant(ctx, exp);
+  }
+  return exp;
+}
+
+Expression * Optimizer::constant(Context& ctx, Expression * exp)
+{
+  Expression * c = nullptr;
+  /* the working memory is released after, when no value is in use */
+  size_t wm = ctx.allocationCount();
+  try
+  {
+    Value& v = exp->value(ctx);
+    if (!v.isNull() && v.type() == exp->type(ctx))
+    {
+      switch (v.type().major())
+      {
+      case Type::BOOLEAN:
+        c = new BooleanExpression(*v.boolean());
+        break;
+      case Type::INTEGER:
+        c = new IntegerExpression(*v.integer());
+        break;
+      case Type::NUMERIC:
+        /* not a number cannot be written back as a constant */
+        if (std::isfinite(*v.numeric()))
+          c = new NumericExpression(*v.numeric());
+        break;
+      case Type::LITERAL:
+        c = new LiteralExpression(ctx.internLiteral(Value(*v.literal())));
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  catch (RuntimeError& re)
+  {
+    /* the error will be raised at runtime */
+    DBG(DBG_DEBUG, "%s not folded: %s\n", exp->unparse(ctx).c_str(), re.what());
+  }
+  if (wm == 0)
+    ctx.purgeWorkingMemory();
+  if (c == nullptr)
+    return exp;
+  delete exp;
+  return c;
+}
+
+bool Optimizer::pure(Context& ctx, const Expression * exp, bool& call, std::set<unsigned>& reads)
+{
+  if (exp->isConst())
+    return true;
+
+  const VariableExpression * var = dynamic_cast<const VariableExpression*>(exp);
+  if (var)
+  {
+    /* the elements of a table could be updated through an iterator, so only
+     * the scalar variables are tracked */
+    const Type& type = var->type(ctx);
+    if (type.level() != 0)
+      return false;
+    switch (type.major())
+    {
+    case Type::BOOLEAN:
+    case Type::INTEGER:
+    case Type::NUMERIC:
+    case Type::LITERAL:
+    case Type::IMAGINARY:
+      reads.insert(var->symbolId());
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  const OperatorExpression * op = dynamic_cast<const OperatorExpression*>(exp);
+  if (op)
+    return pure(ctx, op->arg1, call, reads) &&
+            (op->arg2 == nullptr || pure(ctx, op->arg2, call, reads));
+
+  const BuiltinExpression * fn = dynamic_cast<const BuiltinExpression*>(exp);
+  if (fn)
+  {
+    if (!pureBuiltin(fn->oper))
+      return false;
+    for (const Expression * arg : fn->_args)
+    {
+      if (!pure(ctx, arg, call, reads))
+        return false;
+    }
+    call = true;
+    return true;
+  }
+
+  const MemberCOUNTExpression * cnt = dynamic_cast<const MemberCOUNTExpression*>(exp);
+  if (cnt)
+  {
+    /* the count is not changed by the update of an element */
+    var = dynamic_cast<const VariableExpression*>(cnt->_exp);
+    if (var == nullptr)
+      return false;
+    reads.insert(var->symbolId());
+    call = true;
+    return true;
+  }
+
+  const CachedExpression * cached = dynamic_cast<const CachedExpression*>(exp);
+  if (cached)
+  {
+    call = true;
+    return pure(ctx, cached->_exp, call, reads);
+  }
+
+  const CompiledExpression * compiled = dynamic_cast<const CompiledExpression*>(exp);
+  if (compiled)
+    return pure(ctx, compiled->_exp, call, reads);
+
+  return false;
+}
+
+Expression * Optimizer::cache(Context& ctx, Expression * exp)
+{
+  /* it was processed by the parse of the subexpression */
+  if (dynamic_cast<CachedExpression*>(exp))
+    return exp;
+
+  bool call = false;
+  std::set<unsigned> reads;
+  if (pure(ctx, exp, call, reads))
+    return (call ? candidate(ctx, exp) : exp);
+
+  OperatorExpression * op = dynamic_cast<OperatorExpression*>(exp);
+  if (op)
+  {
+    op->arg1 = cache(ctx, op->arg1);
+    if (op->arg2)
+      op->arg2 = cache(ctx, op->arg2);
+    return exp;
+  }
+
+  BuiltinExpression * fn = dynamic_cast<BuiltinExpression*>(exp);
+  if (fn)
+  {
+    for (Expression *& arg : fn->_args)
+      arg = cache(ctx, arg);
+  }
+  return exp;
+}
+
+Expression * Optimizer::candidate(Context& ctx, Expression * exp)
+{
+  Subexpressions subs;
+  std::vector<std::shared_ptr<Temporary> > common;
+  collect(ctx, exp, subs, common);
+  group(ctx, subs, nullptr, common);
+
+  /* outside a loop, there is nothing to keep without common subexpression */
+  if (ctx._loop == nullptr && common.empty())
+    return exp;
+  std::shared_ptr<Temporary> tmp = std::make_shared<Temporary>();
+  CachedExpression * cached = new CachedExpression(exp, tmp);
+  cached->_common = std::move(common);
+  if (ctx._loop)
+  {
+    tmp->node = cached;
+    ctx._loop->candidates.push_back(tmp);
+  }
+  return cached;
+}
+
+void Optimizer::collect(Context& ctx, Expression * exp, Subexpressions& subs,
+                        std::vector<std::shared_ptr<Temporary> >& common)
+{
+  std::vector<Expression**> args;
+  OperatorExpression * op = dynamic_cast<OperatorExpression*>(exp);
+  if (op)
+  {
+    args.push_back(&op->arg1);
+    if (op->arg2)
+      args.push_back(&op->arg2);
+  }
+  BuiltinExpression * fn = dynamic_cast<BuiltinExpression*>(exp);
+  if (fn)
+  {
+    for (Expression *& arg : fn->_args)
+      args.push_back(&arg);
+  }
+
+  for (Expression ** arg : args)
+  {
+    CachedExpression * cached = dynamic_cast<CachedExpression*>(*arg);
+    if (cached)
+    {
+      /* the enclosing expression takes over the common subexpressions */
+      common.insert(common.end(), cached->_common.begin(), cached->_common.end());
+      cached->_common.clear();
+      if (cached->_tmp->id == Expression::nid)
+      {
+        /* the candidate is replaced by the enclosing one */
+        *arg = cached->_exp;
+        cached->_exp = nullptr;
+        delete cached;
+      }
+      else
+      {
+        subs.push_back(std::make_pair((*arg)->unparse(ctx), arg));
+        collect(ctx, cached->_exp, subs, common);
+        continue;
+      }
+    }
+    bool call = false;
+    std::set<unsigned> reads;
+    if (pure(ctx, *arg, call, reads) && call)
+    {
+      subs.push_back(std::make_pair((*arg)->unparse(ctx), arg));
+      collect(ctx, *arg, subs, common);
+    }
+  }
+}
+
+void Optimizer::share(Expression ** exp, const std::shared_ptr<Temporary>& tmp)
+{
+  CachedExpression * cached = dynamic_cast<CachedExpression*>(*exp);
+  if (cached)
+  {
+    if (cached->_tmp->node == cached)
+      cached->_tmp->node = nullptr;
+    cached->_tmp = tmp;
+  }
+  else
+  {
+    cached = new CachedExpression(*exp, tmp);
+    *exp = cached;
+  }
+  if (tmp->node == nullptr)
+    tmp->node = cached;
+}
+
+void Optimizer::group(Context& ctx, Subexpressions& subs, std::vector<unsigned> * loop,
+                      std::vector<std::shared_ptr<Temporary> >& common)
+{
+  /* share the common subexpressions, the largest first */
+  std::stable_sort(subs.begin(), subs.end(),
+          [](const Subexpressions::value_type& a, const Subexpressions::value_type& b)
+          {
+            return a.first.size() > b.first.size();
+          });
+  for (size_t i = 0; i < subs.size(); ++i)
+  {
+    if (subs[i].second == nullptr)
+      continue;
+    std::shared_ptr<Temporary> tmp;
+    for (size_t j = i + 1; j < subs.size(); ++j)
+    {
+      if (subs[j].second == nullptr || subs[j].first != subs[i].first)
+        continue;
+      if (!tmp)
+      {
+        tmp = std::make_shared<Temporary>();
+        tmp->id = temporary(ctx);
+        if (loop)
+        {
+          tmp->loop = loop;
+          finalize(ctx, *tmp);
+        }
+        else
+          common.push_back(tmp);
+        share(subs[i].second, tmp);
+      }
+      Expression ** dup = subs[j].second;
+      share(dup, tmp);
+      subs[j].second = nullptr;
+      /* the subexpressions of a duplicate are not evaluated anymore */
+      drop(*dup, subs);
+    }
+  }
+}
+
+void Optimizer::drop(Expression * exp, Subexpressions& subs)
+{
+  std::vector<Expression**> args;
+  CachedExpression * cached = dynamic_cast<CachedExpression*>(exp);
+  if (cached)
+    args.push_back(&cached->_exp);
+  OperatorExpression * op = dynamic_cast<OperatorExpression*>(exp);
+  if (op)
+  {
+    args.push_back(&op->arg1);
+    if (op->arg2)
+      args.push_back(&op->arg2);
+  }
+  BuiltinExpression * fn = dynamic_cast<BuiltinExpression*>(exp);
+  if (fn)
+  {
+    for (Expression *& arg : fn->_args)
+      args.push_back(&arg);
+  }
+  for (Expression ** arg : args)
+  {
+    for (Subexpressions::value_type& sub : subs)
+    {
+      if (sub.second == arg)
+        sub.second = nullptr;
+    }
+    drop(*arg, subs);
+  }
+}
+
+void Optimizer::loopBegin(Context& ctx, const Statement * loop, std::vector<unsigned>& temporaries,
+                          std::vector<unsigned> * iteration, unsigned iterator, bool pointer)
+{
+  if (ctx.optimization() < 2)
+    return;
+  Loop * l = new Loop();
+  l->parent = ctx._loop;
+  l->owner = loop;
+  l->temporaries = &temporaries;
+  l->iteration = iteration;
+  l->iterator = iterator;
+  if (pointer)
+    l->pointer = iterator;
+  ctx._loop = l;
+}
+
+void Optimizer::loopEnd(Context& ctx, const Statement * loop)
+{
+  Loop * l = ctx._loop;
+  if (l == nullptr || l->owner != loop)
+    return;
+  ctx._loop = l->parent;
+  /* the symbols written by the body are written by the parent */
+  if (l->parent)
+  {
+    l->parent->written.insert(l->written.begin(), l->written.end());
+    if (l->iterator != Expression::nid)
+      l->parent->written.insert(l->iterator);
+  }
+
+  /* the occurrences evaluated once by iteration */
+  Subexpressions subs;
+  std::vector<Expression*> roots;
+  roots.reserve(l->candidates.size());
+  std::vector<std::shared_ptr<Temporary> > inner;
+
+  for (const std::shared_ptr<Temporary>& tmp : l->candidates)
+  {
+    CachedExpression * cached = tmp->node;
+    /* the expression was dropped, i.e by an unreachable branch */
+    if (cached == nullptr)
+    {
+      finalize(ctx, *tmp);
+      continue;
+    }
+    bool call = false;
+    std::set<unsigned> reads;
+    bool valid = pure(ctx, cached->_exp, call, reads);
+    if (valid && invariant(*l, reads))
+    {
+      tmp->loop = l->temporaries;
+      promote(ctx, *l, tmp);
+      continue;
+    }
+    bool shared = valid && periodic(*l, reads);
+    if (shared)
+    {
+      roots.push_back(cached);
+      subs.push_back(std::make_pair(cached->unparse(ctx), &roots.back()));
+    }
+    if (tmp->loop)
+    {
+      /* it is invariant in the inner loop */
+      if (shared)
+        inner.push_back(tmp);
+      else
+        finalize(ctx, *tmp);
+    }
+    else
+    {
+      /* look for the invariant subexpressions */
+      hoist(ctx, *l, cached->_exp, subs);
+    }
+  }
+
+  std::vector<std::shared_ptr<Temporary> > common;
+  group(ctx, subs, l->iteration, common);
+  /* the ones not shared are released by the inner loop */
+  for (const std::shared_ptr<Temporary>& tmp : inner)
+  {
+    if (tmp->node)
+      finalize(ctx, *tmp);
+  }
+  delete l;
+}
+
+void Optimizer::loopAbort(Context& ctx, const Statement * loop)
+{
+  Loop * l = ctx._loop;
+  if (l == nullptr || l->owner != loop)
+    return;
+  ctx._loop = l->parent;
+  delete l;
+}
+
+bool Optimizer::invariant(const Loop& loop, const std::set<unsigned>& reads)
+{
+  for (unsigned id : reads)
+  {
+    if (id == loop.iterator || loop.written.find(id) != loop.written.end())
+      return false;
+    /* the element pointed to by an iterator could be updated by the loop */
+    for (const Loop * l = &loop; l; l = l->parent)
+    {
+      if (l->pointer == id)
+        return false;
+    }
+  }
+  return true;
+}
+
+bool Optimizer::periodic(const Loop& loop, const std::set<unsigned>& reads)
+{
+  if (loop.iteration == nullptr)
+    return false;
+  /* the value changes with the iterator only */
+  std::set<unsigned> others(reads);
+  others.erase(loop.iterator);
+  return invariant(loop, others);
+}
+
+void Optimizer::hoist(Context& ctx, Loop& loop, Expression *& exp, Subexpressions& subs)
+{
+  CachedExpression * cached = dynamic_cast<CachedExpression*>(exp);
+  if (cached)
+  {
+    /* a common subexpression is hoisted as a whole */
+    if (cached->_tmp->hoisted || cached->_tmp->loop)
+      return;
+    bool call = false;
+    std::set<unsigned> reads;
+    if (pure(ctx, cached->_exp, call, reads) && invariant(loop, reads))
+    {
+      cached->_tmp->loop = loop.temporaries;
+      promote(ctx, loop, cached->_tmp);
+      return;
+    }
+    if (periodic(loop, reads))
+      subs.push_back(std::make_pair(exp->unparse(ctx), &exp));
+    hoist(ctx, loop, cached->_exp, subs);
+    return;
+  }
+
+  bool call = false;
+  std::set<unsigned> reads;
+  if (!pure(ctx, exp, call, reads) || !call)
+    return;
+  if (invariant(loop, reads))
+  {
+    std::shared_ptr<Temporary> tmp = std::make_shared<Temporary>();
+    tmp->loop = loop.temporaries;
+    cached = new CachedExpression(exp, tmp);
+    tmp->node = cached;
+    exp = cached;
+    promote(ctx, loop, tmp);
+    return;
+  }
+  if (periodic(loop, reads))
+    subs.push_back(std::make_pair(exp->unparse(ctx), &exp));
+
+  OperatorExpression * op = dynamic_cast<OperatorExpression*>(exp);
+  if (op)
+  {
+    hoist(ctx, loop, op->arg1, subs);
+    if (op->arg2)
+      hoist(ctx, loop, op->arg2, subs);
+    return;
+  }
+  BuiltinExpression * fn = dynamic_cast<BuiltinExpression*>(exp);
+  if (fn)
+  {
+    for (Expression *& arg : fn->_args)
+      hoist(ctx, loop, arg, subs);
+  }
+}
+
+void Optimizer::promote(Context& ctx, Loop& loop, const std::shared_ptr<Temporary>& tmp)
+{
+  /* it could be invariant in the parent loop too */
+  if (loop.parent)
+    loop.parent->candidates.push_back(tmp);
+  else
+    finalize(ctx, *tmp);
+}
+
+void Optimizer::finalize(Context& ctx, Temporary& tmp)
+{
+  if (tmp.loop == nullptr)
+    return;
+  if (tmp.id == Expression::nid)
+    tmp.id = temporary(ctx);
+  tmp.loop->push_back(tmp.id);
+  tmp.hoisted = true;
+  tmp.loop = nullptr;
+}
+
+unsigned Optimizer::temporary(Context& ctx)
+{
+  /* the qualifier cannot begin a symbol of the language */
+  std::string name(1, Symbol::HIDDEN_QUALIFIER);
+  name.append(std::to_string(ctx.symbolCount()));
+  return ctx.registerSymbol(name, Type()).id();
+}
+
+}
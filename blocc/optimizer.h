@@ -0,0 +1,150 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OPTIMIZER_H_
+#define OPTIMIZER_H_
+
+#include <string>
+#include <set>
+#include <vector>
+#include <memory>
+
+namespace bloc
+{
+
+class Context;
+class Expression;
+class Statement;
+struct Temporary;
+
+/**
+ * The parse time optimizer. It is enabled by the optimization level of the
+ * context, which is 0 by default. The level 1 folds the constant subtrees of the
+ * expressions, and drops the unreachable branches of the IF statements. The
+ * calls of the small functions are inlined by the parse of the call, see
+ * InlineExpression.
+ * The level 2 keeps the values of the pure expressions in hidden variables,
+ * so that the loop invariants are evaluated once by entry in the loop, the
+ * expressions of the iterator of a FOR loop are shared by the statements of
+ * the body and evaluated once by iteration, and the common subexpressions
+ * are evaluated once by evaluation of the enclosing expression.
+ */
+class Optimizer
+{
+public:
+
+  /**
+   * The parse state of a loop: the symbols written by its body, and the
+   * expressions that could be invariant.
+   */
+  struct Loop
+  {
+    Loop * parent = nullptr;
+    const Statement * owner = nullptr;
+    /* the temporaries released by the loop on entry */
+    std::vector<unsigned> * temporaries = nullptr;
+    /* the temporaries released on each iteration */
+    std::vector<unsigned> * iteration = nullptr;
+    /* the iterator, and the iterator pointing to the fetched elements */
+    unsigned iterator = (-1);
+    unsigned pointer = (-1);
+    /* the symbols written by the body */
+    std::set<unsigned> written;
+    std::vector<std::shared_ptr<Temporary> > candidates;
+  };
+
+  /**
+   * Fold the constant subtrees of operators and pure builtins into constant
+   * expressions. The expression is evaluated with the given context, and a
+   * subtree raising an error at runtime is kept as is.
+   * @param ctx   the parse context
+   * @param exp   the expression to fold, freed when replaced
+   * @return      the folded expression
+   */
+  static Expression * fold(Context& ctx, Expression * exp);
+
+  /**
+   * Returns true if the builtin function has no side effect, and returns the
+   * same value for the same arguments.
+   * @param fc    the function code of the builtin
+   */
+  static bool pureBuiltin(int fc);
+
+  /**
+   * Keep the values of the pure expressions containing a call, and share
+   * the common subexpressions. The expressions of a loop body are the
+   * candidates to hoist, analysed when the loop is parsed.
+   * @param ctx   the parse context
+   * @param exp   the expression to process
+   * @return      the expression, or its cached replacement
+   */
+  static Expression * cache(Context& ctx, Expression * exp);
+
+  /**
+   * Begin the parse of a loop, at the level 2 only.
+   * @param ctx         the parse context
+   * @param loop        the loop statement
+   * @param temporaries the storage of the temporaries released on entry
+   * @param iteration   the storage of the temporaries released on each
+   *                    iteration, or null
+   * @param iterator    the symbol written on each iteration, if any
+   * @param pointer     true if the iterator points to the fetched elements
+   */
+  static void loopBegin(Context& ctx, const Statement * loop, std::vector<unsigned>& temporaries,
+                        std::vector<unsigned> * iteration, unsigned iterator, bool pointer);
+
+  /**
+   * End the parse of a loop: the candidates depending on symbols written
+   * by the loop are not invariant, else they are passed to the parent loop.
+   * The ones depending on the iterator only are shared by the body.
+   * @param ctx         the parse context
+   * @param loop        the loop statement
+   */
+  static void loopEnd(Context& ctx, const Statement * loop);
+
+  /**
+   * Drop the parse state of a loop on parse error.
+   * @param ctx         the parse context
+   * @param loop        the loop statement
+   */
+  static void loopAbort(Context& ctx, const Statement * loop);
+
+private:
+  typedef std::vector<std::pair<std::string, Expression**> > Subexpressions;
+
+  static Expression * constant(Context& ctx, Expression * exp);
+
+  static bool pure(Context& ctx, const Expression * exp, bool& call, std::set<unsigned>& reads);
+  static Expression * candidate(Context& ctx, Expression * exp);
+  static void collect(Context& ctx, Expression * exp, Subexpressions& subs,
+                      std::vector<std::shared_ptr<Temporary> >& common);
+  static void share(Expression ** exp, const std::shared_ptr<Temporary>& tmp);
+  static void drop(Expression * exp, Subexpressions& subs);
+  static bool invariant(const Loop& loop, const std::set<unsigned>& reads);
+  static bool periodic(const Loop& loop, const std::set<unsigned>& reads);
+  static void hoist(Context& ctx, Loop& loop, Expression *& exp, Subexpressions& subs);
+  static void group(Context& ctx, Subexpressions& subs, std::vector<unsigned> * loop,
+                    std::vector<std::shared_ptr<Temporary> >& common);
+  static void promote(Context& ctx, Loop& loop, const std::shared_ptr<Temporary>& tmp);
+  static void finalize(Context& ctx, Temporary& tmp);
+  static unsigned temporary(Context& ctx);
+};
+
+}
+
+#endif /* OPTIMIZER_H_ */
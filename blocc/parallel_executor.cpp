@@ -0,0 +1,179 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "parallel_executor.h"
+#include "debug.h"
+
+#include <thread>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <exception>
+#include <system_error>
+
+/* chunks per worker when splitting the range */
+#define PARALLEL_CHUNKS 16
+
+namespace bloc
+{
+
+struct ParallelExecutor::Run
+{
+  const Job& job;
+  size_t grain;
+  std::vector<std::unique_ptr<Range> > ranges;
+  std::atomic<bool> abort;
+  std::mutex error_lock;
+  std::exception_ptr error;
+
+  Run(const Job& _job, size_t _grain) : job(_job), grain(_grain), abort(false) { }
+};
+
+ParallelExecutor::ParallelExecutor(unsigned workers)
+: _workers(workers > 0 ? workers : hardwareConcurrency())
+{
+}
+
+unsigned ParallelExecutor::hardwareConcurrency()
+{
+  unsigned n = std::thread::hardware_concurrency();
+  return (n > 0 ? n : 1);
+}
+
+unsigned ParallelExecutor::workers(size_t count) const
+{
+  if (count < _workers)
+    return (count > 0 ? (unsigned) count : 1);
+  return _workers;
+}
+
+void ParallelExecutor::run(size_t count, const Job& job)
+{
+  if (count == 0)
+    return;
+  unsigned n = workers(count);
+  size_t grain = count / (n * PARALLEL_CHUNKS);
+  Run r(job, (grain > 0 ? grain : 1));
+
+  /* split the range evenly */
+  size_t begin = 0;
+  for (unsigned k = 0; k < n; ++k)
+  {
+    Range * range = new Range();
+    range->begin = begin;
+    range->end = begin + (count - begin) / (n - k);
+    begin = range->end;
+    r.ranges.emplace_back(range);
+  }
+
+  /* a worker that cannot be started leaves its part to be stolen */
+  std::vector<std::thread> threads;
+  for (unsigned k = 1; k < n; ++k)
+  {
+    try
+    {
+      threads.emplace_back(&ParallelExecutor::work, std::ref(r), k);
+    }
+    catch (std::system_error& e)
+    {
+      DBG(DBG_WARN, "failed to start worker %u: %s\n", k, e.what());
+      break;
+    }
+  }
+  work(r, 0);
+  for (std::thread& t : threads)
+    t.join();
+
+  if (r.error)
+    std::rethrow_exception(r.error);
+}
+
+void ParallelExecutor::work(Run& r, unsigned k)
+{
+  Range& own = *r.ranges[k];
+  size_t begin, end;
+  try
+  {
+    do
+    {
+      while (!r.abort.load(std::memory_order_relaxed) && take(own, r.grain, begin, end))
+        r.job(k, begin, end);
+    } while (!r.abort.load(std::memory_order_relaxed) && steal(r, k));
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> g(r.error_lock);
+    if (!r.error)
+      r.error = std::current_exception();
+    r.abort.store(true);
+  }
+}
+
+bool ParallelExecutor::take(Range& range, size_t grain, size_t& begin, size_t& end)
+{
+  std::lock_guard<std::mutex> g(range.lock);
+  if (range.begin >= range.end)
+    return false;
+  begin = range.begin;
+  end = (range.end - begin > grain ? begin + grain : range.end);
+  range.begin = end;
+  return true;
+}
+
+bool ParallelExecutor::steal(Run& r, unsigned k)
+{
+  unsigned n = (unsigned) r.ranges.size();
+  for (;;)
+  {
+    /* look for the victim with the largest remaining part */
+    unsigned victim = k;
+    size_t remaining = 0;
+    for (unsigned i = 1; i < n; ++i)
+    {
+      Range& range = *r.ranges[(k + i) % n];
+      std::lock_guard<std::mutex> g(range.lock);
+      if (range.end > range.begin && range.end - range.begin > remaining)
+      {
+        victim = (k + i) % n;
+        remaining = range.end - range.begin;
+      }
+    }
+    if (victim == k)
+      return false;
+
+    size_t begin, end;
+    {
+      Range& range = *r.ranges[victim];
+      std::lock_guard<std::mutex> g(range.lock);
+      /* the victim could have consumed its part meanwhile */
+      if (range.begin >= range.end)
+        continue;
+      /* steal the upper half */
+      end = range.end;
+      begin = end - (end - range.begin + 1) / 2;
+      range.end = begin;
+    }
+    Range& own = *r.ranges[k];
+    std::lock_guard<std::mutex> g(own.lock);
+    own.begin = begin;
+    own.end = end;
+    return true;
+  }
+}
+
+}
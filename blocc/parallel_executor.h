@@ -0,0 +1,88 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PARALLEL_EXECUTOR_H_
+#define PARALLEL_EXECUTOR_H_
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace bloc
+{
+
+/**
+ * The executor processes a range of indexes with a set of workers. Each
+ * worker owns a part of the range and consumes it by chunks. A worker that
+ * runs out of work steals the upper half of the largest remaining part, so
+ * that uneven loads are balanced without any central queue.
+ * The calling thread acts as the worker 0, and the other workers run in their
+ * own thread for the duration of the run.
+ */
+class ParallelExecutor
+{
+public:
+  /**
+   * The job to process the indexes in [begin, end) on the given worker.
+   */
+  typedef std::function<void(unsigned worker, size_t begin, size_t end)> Job;
+
+  /**
+   * @param workers     the maximum number of workers, 0 for the hardware
+   *                    concurrency
+   */
+  explicit ParallelExecutor(unsigned workers = 0);
+  ~ParallelExecutor() = default;
+
+  ParallelExecutor(const ParallelExecutor&) = delete;
+  ParallelExecutor& operator=(const ParallelExecutor&) = delete;
+
+  /**
+   * Returns the number of workers that will process a range of the given
+   * size. The job will be called with a worker number below this count.
+   */
+  unsigned workers(size_t count) const;
+
+  /**
+   * Process the indexes in [0, count). On error, the remaining work is
+   * cancelled and the first exception thrown by a job is rethrown.
+   */
+  void run(size_t count, const Job& job);
+
+  static unsigned hardwareConcurrency();
+
+private:
+  unsigned _workers;
+
+  struct Range
+  {
+    std::mutex lock;
+    size_t begin = 0;
+    size_t end = 0;
+  };
+
+  struct Run;
+
+  static void work(Run& r, unsigned k);
+  static bool take(Range& range, size_t grain, size_t& begin, size_t& end);
+  static bool steal(Run& r, unsigned k);
+};
+
+}
+
+#endif /* PARALLEL_EXECUTOR_H_ */
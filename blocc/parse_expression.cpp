@@ -31,6 +31,8 @@
 #include "expression_builtin.h"
 #include "expression_member.h"
 #include "expression_functor.h"
+#include "expression_compiled.h"
+#include "optimizer.h"
 #include "plugin_manager.h"
 #include "functor_manager.h"
 
@@ -59,6 +61,7 @@
 #include "operator/op_pus.h"
 #include "operator/op_sub.h"
 #include "operator/op_xor.h"
+#include "operator/op_typed.h"
 
 #include <string>
 #include <cassert>
@@ -70,7 +73,14 @@ Expression * ParseExpression::expression(Parser& p, Context& ctx)
 {
   ParseExpression pe(p, ctx);
   /* begin the parse by the precedence with the lowest priority */
-  return pe.logic();
+  Expression * exp = pe.logic();
+  if (ctx.optimization() > 0)
+    exp = Optimizer::fold(ctx, exp);
+  if (ctx.optimization() > 1)
+    exp = Optimizer::cache(ctx, exp);
+  if (ctx.bytecode())
+    return CompiledExpression::compile(ctx, exp);
+  return exp;
 }
 
 bool ParseExpression::typeChecking(Expression * exp, const Type& type, Parser& p, Context& ctx)
@@ -85,7 +95,9 @@ bool ParseExpression::typeChecking(Expression * exp, const Type& type, Parser& p
             (exp_type == Type::INTEGER && (type == Type::NUMERIC || type == Type::IMAGINARY)) ||
             (exp_type == Type::IMAGINARY && (type == Type::NUMERIC || type == Type::INTEGER)) ||
             /* tuple opaque */
-            (exp_type == Type::ROWTYPE && type == Type::ROWTYPE && (exp_type.minor() == 0 || type.minor() == 0))
+            (exp_type == Type::ROWTYPE && type == Type::ROWTYPE && (exp_type.minor() == 0 || type.minor() == 0)) ||
+            /* map opaque */
+            (exp_type == Type::MAPTYPE && type == Type::MAPTYPE && (exp_type.minor() == 0 || type.minor() == 0))
           ));
 }
 
@@ -175,7 +187,7 @@ Expression * ParseExpression::element()
       catch (std::out_of_range& e) { throw ParseError(EXC_PARSE_OUT_OF_RANGE, t); }
       break;
     case TOKEN_LITERALSTR:
-      result = new LiteralExpression(Value::parseLiteral(t->text));
+      result = new LiteralExpression(ctx.internLiteral(Value::parseLiteral(t->text)));
       return member(result);
     case TOKEN_KEYWORD:
       if (BuiltinExpression::findKeyword(t->text) != BuiltinExpression::unknown)
@@ -243,10 +255,10 @@ Expression * ParseExpression::factor()
     {
     case TOKEN_KEYWORD:
       if (t->text == Operator::OPVALS[Operator::OP_EXP])
-        return new OpEXPExpression(assertType(result, Type::NUMERIC, p, ctx, false), assertType(factor(), Type::NUMERIC, p, ctx));
+        return OpTypedNumeric<OpEXPExpression, OpKernelEXP>(ctx, assertType(result, Type::NUMERIC, p, ctx, false), assertType(factor(), Type::NUMERIC, p, ctx));
       break;
     case TOKEN_POWER:
-      return new OpEXPExpression(assertType(result, Type::NUMERIC, p, ctx, false), assertType(factor(), Type::NUMERIC, p, ctx));
+      return OpTypedNumeric<OpEXPExpression, OpKernelEXP>(ctx, assertType(result, Type::NUMERIC, p, ctx, false), assertType(factor(), Type::NUMERIC, p, ctx));
     default:
       break;
     }
@@ -320,13 +332,13 @@ Expression * ParseExpression::term()
       switch (t->code)
       {
       case '*':
-        result = new OpMULExpression(assertType(result, Type::NUMERIC, p, ctx, false), assertType(primary(), Type::NUMERIC, p, ctx));
+        result = OpTypedNumeric<OpMULExpression, OpKernelMUL>(ctx, assertType(result, Type::NUMERIC, p, ctx, false), assertType(primary(), Type::NUMERIC, p, ctx));
         break;
       case '/':
-        result = new OpDIVExpression(assertType(result, Type::NUMERIC, p, ctx, false), assertType(primary(), Type::NUMERIC, p, ctx));
+        result = OpTypedNumeric<OpDIVExpression, OpKernelDIV>(ctx, assertType(result, Type::NUMERIC, p, ctx, false), assertType(primary(), Type::NUMERIC, p, ctx));
         break;
       case '%':
-        result = new OpMODExpression(assertType(result, Type::NUMERIC, p, ctx, false), assertType(primary(), Type::NUMERIC, p, ctx));
+        result = OpTypedNumeric<OpMODExpression, OpKernelMOD>(ctx, assertType(result, Type::NUMERIC, p, ctx, false), assertType(primary(), Type::NUMERIC, p, ctx));
         break;
       default:
         done = true;
@@ -364,10 +376,10 @@ Expression * ParseExpression::sum()
       switch (t->code)
       {
       case '+':
-        result = new OpADDExpression(result, assertType(term(), result->type(ctx), p, ctx));
+        result = OpTypedNumeric<OpADDExpression, OpKernelADD>(ctx, result, assertType(term(), result->type(ctx), p, ctx));
         break;
       case '-':
-        result = new OpSUBExpression(assertType(result, Type::NUMERIC, p, ctx, false), assertType(term(), Type::NUMERIC, p, ctx));
+        result = OpTypedNumeric<OpSUBExpression, OpKernelSUB>(ctx, assertType(result, Type::NUMERIC, p, ctx, false), assertType(term(), Type::NUMERIC, p, ctx));
         break;
       default:
         done = true;
@@ -405,10 +417,10 @@ Expression * ParseExpression::bitshift()
       switch (t->code)
       {
       case TOKEN_POPLEFT:
-        result =  new OpPOPExpression(assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(sum(), Type::INTEGER, p, ctx));
+        result =  OpTypedInteger<OpPOPExpression, OpKernelPOP>(ctx, assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(sum(), Type::INTEGER, p, ctx));
         break;
       case TOKEN_PUSHRIGHT:
-        result = new OpPUSExpression(assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(sum(), Type::INTEGER, p, ctx));
+        result = OpTypedInteger<OpPUSExpression, OpKernelPUS>(ctx, assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(sum(), Type::INTEGER, p, ctx));
         break;
       default:
         done = true;
@@ -446,13 +458,13 @@ Expression * ParseExpression::bitlogic()
       switch (t->code)
       {
       case '&':
-        result = new OpANDExpression(assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(bitshift(), Type::INTEGER, p, ctx));
+        result = OpTypedInteger<OpANDExpression, OpKernelAND>(ctx, assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(bitshift(), Type::INTEGER, p, ctx));
         break;
       case '|':
-        result = new OpIORExpression(assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(bitshift(), Type::INTEGER, p, ctx));
+        result = OpTypedInteger<OpIORExpression, OpKernelIOR>(ctx, assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(bitshift(), Type::INTEGER, p, ctx));
         break;
       case '^':
-        result = new OpXORExpression(assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(bitshift(), Type::INTEGER, p, ctx));
+        result = OpTypedInteger<OpXORExpression, OpKernelXOR>(ctx, assertTypeUniform(result, Type::INTEGER, p, ctx, false), assertTypeUniform(bitshift(), Type::INTEGER, p, ctx));
         break;
       default:
         done = true;
@@ -486,20 +498,33 @@ Expression * ParseExpression::relation()
     switch (t->code)
     {
     case TOKEN_ISNOTEQ:
-      return new OpNEExpression(result, bitlogic());
+      return OpTypedNumeric<OpNEExpression, OpKernelNE>(ctx, result, bitlogic());
     case TOKEN_ISEQUAL:
-      return new OpEQExpression(result, bitlogic());
+      return OpTypedNumeric<OpEQExpression, OpKernelEQ>(ctx, result, bitlogic());
     case TOKEN_ISEQLESS:
-      return new OpLEExpression(result, assertType(bitlogic(), result->type(ctx), p, ctx));
+      return OpTypedNumeric<OpLEExpression, OpKernelLE>(ctx, result, assertType(bitlogic(), result->type(ctx), p, ctx));
     case '<':
-      return new OpLTExpression(result, assertType(bitlogic(), result->type(ctx), p, ctx));
+      return OpTypedNumeric<OpLTExpression, OpKernelLT>(ctx, result, assertType(bitlogic(), result->type(ctx), p, ctx));
     case TOKEN_ISEQMORE:
-      return new OpGEExpression(result, assertType(bitlogic(), result->type(ctx), p, ctx));
+      return OpTypedNumeric<OpGEExpression, OpKernelGE>(ctx, result, assertType(bitlogic(), result->type(ctx), p, ctx));
     case '>':
-      return new OpGTExpression(result, assertType(bitlogic(), result->type(ctx), p, ctx));
+      return OpTypedNumeric<OpGTExpression, OpKernelGT>(ctx, result, assertType(bitlogic(), result->type(ctx), p, ctx));
     case TOKEN_KEYWORD:
       if (t->text == Operator::OPVALS[Operator::OP_MATCH])
-        return new OpMATCHExpression(assertType(result, Type::LITERAL, p, ctx, false), assertType(bitlogic(), Type::LITERAL, p, ctx));
+      {
+        OpMATCHExpression * m = new OpMATCHExpression(assertType(result, Type::LITERAL, p, ctx, false), assertType(bitlogic(), Type::LITERAL, p, ctx));
+        result = m;
+        try
+        {
+          /* a constant pattern is compiled once */
+          m->compile(ctx);
+        }
+        catch (std::regex_error& re)
+        {
+          throw ParseError(EXC_PARSE_OTHER_S, re.what(), t);
+        }
+        return result;
+      }
       break;
     default:
       break;
@@ -52,7 +52,11 @@ namespace bloc
 Statement * ParseStatement::statement(Parser& p, Context& ctx)
 {
   ParseStatement ps(p, ctx);
-  return ps.parse();
+  Statement * s = ps.parse();
+  /* tag the statement with its source line */
+  if (s)
+    s->line(ps._line);
+  return s;
 }
 
 Statement * ParseStatement::parse()
@@ -62,6 +66,7 @@ Statement * ParseStatement::parse()
   TokenPtr t = p.pop();
   if (!t)
     return nullptr;
+  _line = t->line;
 
   try
   {
@@ -41,6 +41,7 @@ private:
 
   Parser& p;
   Context& ctx;
+  unsigned _line = 0;
 
   ~ParseStatement() = default;
   ParseStatement(Parser& p, Context& ctx) : p(p), ctx(ctx) { }
@@ -59,12 +59,17 @@ TokenPtr Parser::pop() {
   }
   t = _tokens.front();
   _tokens.pop_front();
+  if (_record)
+    _record->push_back(t);
   DBG(DBG_PROTO, "%s [%d] : %s\n", __FUNCTION__, t->code, t->text.c_str());
   return t;
 }
 
 void Parser::push(const TokenPtr& t) {
   _tokens.push_front(t);
+  /* the token is restored, so it is no longer popped */
+  if (_record && !_record->empty() && _record->back() == t)
+    _record->pop_back();
   DBG(DBG_PROTO, "%s [%d] : %s\n", __FUNCTION__, t->code, t->text.c_str());
 }
 
@@ -106,6 +111,9 @@ bool Parser::popAny(TokenPtr& token) {
     return false;
   t = new Token(tc, ts, 0, 0);
   token.reset(t);
+  /* record the token */
+  if (_image)
+    _image->push(token);
   return true;
 }
 
@@ -202,9 +210,61 @@ Executable * Parser::parse(Context& ctx, StreamReader& reader, bool trace /*= fa
   Parser p(ctx, reader);
   if (!p.init_scanner())
     return nullptr;
-
   p.trace(trace);
-  std::list<const Statement*> statements;
+  return parse(p, ctx);
+}
+
+Executable * Parser::compile(Context& ctx, StreamReader& reader, TokenImage& image)
+{
+  Parser p(ctx, reader);
+  if (!p.init_scanner())
+    return nullptr;
+  image.clear();
+  p._image = &image;
+  return parse(p, ctx);
+}
+
+namespace
+{
+/* the image replaces the stream */
+struct NoReader : public Parser::StreamReader
+{
+  int read(Parser *, char *, int) override { return 0; }
+};
+}
+
+Executable * Parser::parse(Context& ctx, TokenImage& image)
+{
+  NoReader reader;
+  Parser p(ctx, reader);
+  image.rewind();
+  p._image = &image;
+  p._replay = true;
+  return parse(p, ctx);
+}
+
+Expression * Parser::parseExpression(Context& ctx, TokenImage& image)
+{
+  NoReader reader;
+  Parser p(ctx, reader);
+  image.rewind();
+  p._image = &image;
+  p._replay = true;
+  p.state(Parsing);
+  Expression * exp = ParseExpression::expression(p, ctx);
+  TokenPtr t = p.pop();
+  if (t->code != Separator || !p._tokens.empty() || p.next_token(t))
+  {
+    delete exp;
+    throw ParseError(EXC_PARSE_EXPRESSION_END_S, t->text.c_str(), t);
+  }
+  return exp;
+}
+
+Executable * Parser::parse(Parser& p, Context& ctx)
+{
+  bool trace = p._trace;
+  std::vector<const Statement*> statements;
 
   p.state(Parsing);
   try
@@ -252,6 +312,9 @@ bool Parser::next_token(TokenPtr& token) {
   const char * ts;
   Token * t = nullptr;
 
+  if (_replay)
+    return _image->pop(token);
+
   /* read until new token or a failure */
   while (t == nullptr)
   {
@@ -343,6 +406,9 @@ bool Parser::next_token(TokenPtr& token) {
   }
 
   token.reset(t);
+  /* record the token */
+  if (_image)
+    _image->push(token);
   return true;
 }
 
@@ -21,13 +21,16 @@
 
 #include "tokenizer.h"
 #include "token.h"
+#include "token_image.h"
 #include "executable.h"
 #include "statement.h"
 #include "expression.h"
 #include "exception_parse.h"
 
 #include <list>
+#include <vector>
 #include <unordered_set>
+#include <utility>
 
 namespace bloc
 {
@@ -69,6 +72,37 @@ public:
    */
   static Executable * parse(Context& ctx, StreamReader& reader, bool trace = false);
 
+  /**
+   * Make an executable from a source stream, like parse(), and record the
+   * scanned tokens into the image. The image can be saved to be replayed
+   * later instead of the source.
+   * @param ctx         the context used to perform the parse
+   * @param reader      the function to read stream
+   * @param image       the image to fill
+   * @return            the new executable or throws
+   */
+  static Executable * compile(Context& ctx, StreamReader& reader, TokenImage& image);
+
+  /**
+   * Make an executable by replaying the tokens of the image, without
+   * scanning the source again. On failure it throws exception ParseError.
+   * @param ctx         the context used to perform the parse
+   * @param image       the image of the source
+   * @return            the new executable or throws
+   */
+  static Executable * parse(Context& ctx, TokenImage& image);
+
+  /**
+   * Make an expression by replaying the tokens of the image, which must be
+   * ended by a separator. It is parsed in the current parse of the context.
+   * On failure it throws exception ParseError. Finally the returned pointer
+   * must be freed by the caller.
+   * @param ctx         the context used to perform the parse
+   * @param image       the tokens of the expression
+   * @return            the new expression or throws
+   */
+  static Expression * parseExpression(Context& ctx, TokenImage& image);
+
   /**
    * Returns an interactive parser for a source stream. The returned pointer
    * must be freed by the caller.
@@ -109,6 +143,18 @@ public:
    */
   void push(const TokenPtr& t);
 
+  /**
+   * Record the tokens popped from the queue, and not restored, into the
+   * given list. Passing null stops the recording.
+   * @param tokens      the list to fill, or null
+   * @return            the list previously filled, or null
+   */
+  std::vector<TokenPtr> * record(std::vector<TokenPtr> * tokens)
+  {
+    std::swap(_record, tokens);
+    return tokens;
+  }
+
   /**
    * Clear the parser state. It should be called after ParseError to purge
    * the current stream buffer until end of line.
@@ -144,12 +190,17 @@ private:
   explicit Parser(Context& ctx, StreamReader& reader)
   : _ctx(ctx), _reader(reader) { }
 
+  static Executable * parse(Parser& p, Context& ctx);
+
   Context& _ctx;
   StreamReader& _reader;
   State _state = Begin;
   TOKEN_SCANNER _scanner = nullptr;
   std::list<TokenPtr> _tokens;
   std::string _string_buffer;
+  TokenImage * _image = nullptr;  ///< the image to record, or to replay
+  std::vector<TokenPtr> * _record = nullptr; ///< the popped tokens to record
+  bool _replay = false;
 
   bool init_scanner();
   void close_scanner();
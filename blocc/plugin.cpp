@@ -89,5 +89,27 @@ make_type(PLUGIN_TYPE type_def, Type::TypeMinor type_id)
   return decl.make_type(type_def.ndim);
 }
 
+Value * PluginBase::invokeMethod(
+        bloc::Value& object_this,
+        int method_id,
+        bloc::Context& ctx,
+        const std::vector<bloc::Expression*>& args,
+        bloc::Value& ret)
+{
+  Value * rv = executeMethod(*object_this.complex(), method_id, ctx, args);
+  if (rv == nullptr || rv->lvalue())
+    return rv;
+  if (rv->type() == Type::COMPLEX && !rv->isNull() &&
+          rv->complex()->operator==(*object_this.complex()))
+  {
+    /* do not allocate for a copy */
+    delete rv;
+    return &object_this;
+  }
+  ret = std::move(*rv);
+  delete rv;
+  return &ret;
+}
+
 } /* namespace import */
 } /* namespace bloc */
@@ -79,14 +79,19 @@ public:
   virtual void destroyObject(void * object) = 0;
 
   /**
-   * Execute the given method.
-   * It should return a pointer to new expression or the expression of
-   * itself by returning new ComplexExpression(object_this). The returned
-   * pointer will be freed by the caller after payload processing.
+   * Execute the given method, in the result slot passed by the caller.
+   * The slot is taken from the temporary storage of the context, so
+   * storing the result into it requires no allocation of value. It should
+   * return the pointer to the slot (ret) after storing the result, or the
+   * pointer to the wrapper of the object (object_this) to return itself.
    * Returning nullptr will throw RuntimeError(EXC_RT_MEMB_FAILED_S).
    * Obviously it is preferable to throw RuntimeError with a more meaningful
    * message.
    *
+   * The default implementation is the adapter for a module implementing the
+   * former interface: it calls executeMethod and moves the new value into
+   * the slot.
+   *
    * Read IN/INOUT argument:
    * Arguments can be read from the Expression pointer without cast.
    *
@@ -95,6 +100,28 @@ public:
    * to test it. To pass the new value, you must cast the expression and
    * use the method store.
    *
+   * @param object_this   the value wrapping the object
+   * @param method_id     identifier of the method to execute
+   * @param ctx           the bloc context
+   * @param args          list of arguments
+   * @param ret           the slot to store the result
+   * @return              pointer to the result or nullptr
+   */
+  virtual Value * invokeMethod(
+          bloc::Value& object_this,
+          int method_id,
+          bloc::Context& ctx,
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
+          );
+
+  /**
+   * Execute the given method (former interface, see invokeMethod).
+   * It should return a pointer to new expression or the expression of
+   * itself by returning new ComplexExpression(object_this). The returned
+   * pointer will be freed by the caller after payload processing.
+   * Returning nullptr will throw RuntimeError(EXC_RT_MEMB_FAILED_S).
+   *
    * @param object_this   wrapper for the object
    * @param method_id     identifier of the method to execute
    * @param ctx           the bloc context
@@ -106,7 +133,7 @@ public:
           int method_id,
           bloc::Context& ctx,
           const std::vector<bloc::Expression*>& args
-          ) = 0;
+          ) { return nullptr; }
 };
 
 
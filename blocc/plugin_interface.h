@@ -24,7 +24,7 @@ extern "C"
 {
 #endif
 
-#define PLUGIN_VERSION  260428
+#define PLUGIN_VERSION  261019
 
   typedef void* PLUGIN_HANDLE;
 
@@ -51,27 +51,37 @@
 namespace bloc
 {
 
-PluginManager * PluginManager::_instance = nullptr;
+std::atomic<PluginManager*> PluginManager::_instance(nullptr);
+std::mutex PluginManager::_instance_lock;
 
 PLUGIN_INTERFACE PluginManager::_internal = { "null", 0, nullptr, 0, nullptr };
 
 PluginManager& PluginManager::instance()
 {
-  if (_instance)
-    return *_instance;
-  return *(_instance = new PluginManager());
+  PluginManager * pm = _instance.load(std::memory_order_acquire);
+  if (pm)
+    return *pm;
+  std::lock_guard<std::mutex> g(_instance_lock);
+  pm = _instance.load(std::memory_order_relaxed);
+  if (!pm)
+  {
+    pm = new PluginManager();
+    _instance.store(pm, std::memory_order_release);
+  }
+  return *pm;
 }
 
 void PluginManager::destroy()
 {
-  if (_instance)
-    delete _instance;
-  _instance = nullptr;
+  std::lock_guard<std::mutex> g(_instance_lock);
+  PluginManager * pm = _instance.exchange(nullptr);
+  if (pm)
+    delete pm;
 }
 
 unsigned PluginManager::findModuleTypeId(const std::string & name) const
 {
-  for (unsigned i = _modules.size() - 1; i > 0; --i)
+  for (unsigned i = _count.load(std::memory_order_acquire) - 1; i > 0; --i)
   {
     if (name == _modules[i].interface.name)
       return i;
@@ -81,11 +91,14 @@ unsigned PluginManager::findModuleTypeId(const std::string & name) const
 
 PluginManager::PluginManager()
 {
+  /* the storage is never reallocated, so readers need no lock */
+  _modules.reserve(PLUGIN_MAX_MODULES);
   PLUGGED_MODULE plug;
   plug.interface = _internal;
   plug.instance = nullptr;
   plug.dlhandle = nullptr;
   _modules.emplace_back(plug);
+  _count.store(1, std::memory_order_release);
 }
 
 PluginManager::~PluginManager()
@@ -98,13 +111,15 @@ PluginManager::~PluginManager()
       dlclose(m.dlhandle);
   }
   _modules.clear();
+  _count.store(0);
 }
 
 std::vector<const PLUGIN_INTERFACE*> PluginManager::reportInterfaces() const
 {
   std::vector<const PLUGIN_INTERFACE*> v;
-  v.reserve(_modules.size() - 1);
-  for (unsigned i = 1; i < _modules.size(); ++i)
+  unsigned count = _count.load(std::memory_order_acquire);
+  v.reserve(count - 1);
+  for (unsigned i = 1; i < count; ++i)
     v.emplace_back(&_modules[i].interface);
   return v;
 }
@@ -138,11 +153,18 @@ unsigned PluginManager::importModuleByPath(const std::string& libpath)
 
 void PluginManager::unbanPlugin(const std::string& name)
 {
-  if (bannedPlugin(name))
+  std::lock_guard<std::mutex> g(_lock);
+  if (bannedPluginUnlocked(name))
     _trustedPluginNames.push_back(name);
 }
 
 bool PluginManager::bannedPlugin(const std::string& name)
+{
+  std::lock_guard<std::mutex> g(_lock);
+  return bannedPluginUnlocked(name);
+}
+
+bool PluginManager::bannedPluginUnlocked(const std::string& name)
 {
   for (auto& n : _trustedPluginNames)
   {
@@ -154,6 +176,7 @@ bool PluginManager::bannedPlugin(const std::string& name)
 
 unsigned PluginManager::registerModule(void* dlhandle)
 {
+  std::lock_guard<std::mutex> g(_lock);
   /* check for already registered dlhandle */
   for (size_t id = 0; id < _modules.size(); ++id)
   {
@@ -204,8 +227,16 @@ unsigned PluginManager::registerModule(void* dlhandle)
     dlclose(dlhandle);
     return 0;
   }
-  /* register the module */
+  if (_modules.size() >= PLUGIN_MAX_MODULES)
+  {
+    DBG(DBG_ERROR, "%s: too many modules imported.\n", __FUNCTION__);
+    delete instance;
+    dlclose(dlhandle);
+    return 0;
+  }
+  /* register the module, then publish it */
   _modules.emplace_back(plug);
+  _count.store(_modules.size(), std::memory_order_release);
   return (_modules.size() - 1);
 }
 
@@ -23,6 +23,11 @@
 
 #include <string>
 #include <vector>
+#include <atomic>
+#include <mutex>
+
+/* the maximum count of modules, including the internal one */
+#define PLUGIN_MAX_MODULES 256
 
 namespace bloc
 {
@@ -34,6 +39,14 @@ struct PLUGGED_MODULE
   void* dlhandle;
 };
 
+/**
+ * The registry of the imported modules is shared by all contexts of the
+ * process. The registry is append only: the slot of a module is written once
+ * under lock, then published by incrementing the count. So readers access
+ * the modules without locking, and import can be done by any thread.
+ * Permissions are protected by the same lock.
+ * Destroying the instance is not thread safe, and must be done on exit.
+ */
 class PluginManager
 {
 
@@ -50,7 +63,7 @@ public:
 
   const PLUGGED_MODULE& plugged(unsigned type_id) const
   {
-    if (type_id < _modules.size())
+    if (type_id < _count.load(std::memory_order_acquire))
         return _modules[type_id];
     return _modules[0];
   }
@@ -58,20 +71,30 @@ public:
   unsigned importModuleByName(const std::string& name);
   unsigned importModuleByPath(const std::string& libpath);
 
-  void clearPermissions() { _trustedPluginNames.clear(); }
+  void clearPermissions()
+  {
+    std::lock_guard<std::mutex> g(_lock);
+    _trustedPluginNames.clear();
+  }
   void unbanPlugin(const std::string& name);
   bool bannedPlugin(const std::string& name);
 
 private:
   PluginManager();
 
-  static PluginManager * _instance;
+  static std::atomic<PluginManager*> _instance;
+  static std::mutex _instance_lock;
   std::vector<PLUGGED_MODULE> _modules;
+  std::atomic<unsigned> _count;
   static PLUGIN_INTERFACE _internal;
 
+  /* serialize import and permissions */
+  std::mutex _lock;
+
   std::vector<std::string> _trustedPluginNames;
 
   unsigned registerModule(void* dlhandle);
+  bool bannedPluginUnlocked(const std::string& name);
 };
 
 }
@@ -0,0 +1,166 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "profiler.h"
+#include "context.h"
+#include "statement.h"
+#include "functor_manager.h"
+
+#include <algorithm>
+
+namespace bloc
+{
+
+const Statement * Profiler::execute(Context& ctx, const Statement& s)
+{
+  enter(ctx, &s, STATEMENT);
+  const Statement * next;
+  try
+  {
+    next = s.doit(ctx);
+  }
+  catch (...)
+  {
+    leave();
+    throw;
+  }
+  leave();
+  return next;
+}
+
+void Profiler::call(Context& ctx, const Functor& f)
+{
+  enter(ctx, &f, FUNCTION);
+  try
+  {
+    f.body->doit(ctx);
+  }
+  catch (...)
+  {
+    leave();
+    throw;
+  }
+  leave();
+}
+
+void Profiler::enter(Context& ctx, const void * key, Kind kind)
+{
+  auto it = _entries.find(key);
+  if (it == _entries.end())
+  {
+    Entry e;
+    e.kind = kind;
+    if (kind == STATEMENT)
+    {
+      const Statement * s = static_cast<const Statement*>(key);
+      e.label.assign(Statement::KEYWORDS[s->keyword()]);
+      e.line = s->line();
+    }
+    else
+    {
+      const Functor * f = static_cast<const Functor*>(key);
+      e.label.assign(f->name).append("/").append(std::to_string(f->params.size()));
+    }
+    it = _entries.emplace(key, std::move(e)).first;
+  }
+  Frame f;
+  f.entry = &(it->second);
+  f.ctx = &ctx;
+  f.allocs = ctx.allocationTotal();
+  f.start = clock::now();
+  _frames.push_back(f);
+}
+
+void Profiler::leave()
+{
+  Frame& f = _frames.back();
+  std::chrono::duration<double> d = clock::now() - f.start;
+  double time = d.count();
+  /* a function does not allocate by itself, but its statements do */
+  uint64_t allocs = f.foreign;
+  if (f.entry->kind == STATEMENT)
+    allocs += f.ctx->allocationTotal() - f.allocs;
+
+  Entry& e = *(f.entry);
+  e.count += 1;
+  e.total += time;
+  e.self += time - f.child_time;
+  e.allocs += allocs;
+  e.self_allocs += allocs - f.child_allocs;
+
+  Kind kind = f.entry->kind;
+  uint64_t foreign = f.foreign;
+  _frames.pop_back();
+  if (_frames.empty())
+    return;
+  /* account the child to its parent */
+  Frame& p = _frames.back();
+  p.child_time += time;
+  p.child_allocs += allocs;
+  /* the allocations of a nested statement are already counted by the
+   * context of its parent, except the ones done in other contexts */
+  if (kind == FUNCTION || p.entry->kind == FUNCTION)
+    p.foreign += allocs;
+  else
+    p.foreign += foreign;
+}
+
+std::vector<Profiler::Entry> Profiler::entries() const
+{
+  std::vector<Entry> v;
+  v.reserve(_entries.size());
+  for (const auto& e : _entries)
+    v.push_back(e.second);
+  std::sort(v.begin(), v.end(), [](const Entry& a, const Entry& b)
+  {
+    if (a.self != b.self)
+      return a.self > b.self;
+    return a.line < b.line;
+  });
+  return v;
+}
+
+void Profiler::report(FILE * out, unsigned max) const
+{
+  std::vector<Entry> v = entries();
+  if (max > 0 && v.size() > max)
+    v.resize(max);
+  fprintf(out, "%10s %12s %12s %12s %12s  %s\n",
+          "calls", "total(s)", "self(s)", "allocs", "self allocs", "location");
+  for (const Entry& e : v)
+  {
+    std::string where;
+    if (e.kind == STATEMENT)
+      where.assign("line ").append(std::to_string(e.line)).append(" ").append(e.label);
+    else
+      where.assign("function ").append(e.label);
+    fprintf(out, "%10llu %12.6f %12.6f %12llu %12llu  %s\n",
+            (unsigned long long)e.count, e.total, e.self,
+            (unsigned long long)e.allocs, (unsigned long long)e.self_allocs,
+            where.c_str());
+  }
+  fflush(out);
+}
+
+void Profiler::clear()
+{
+  _entries.clear();
+  _frames.clear();
+}
+
+}
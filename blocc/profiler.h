@@ -0,0 +1,120 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+namespace bloc
+{
+
+class Context;
+class Statement;
+struct Functor;
+
+/**
+ * The counting profiler aggregates the executions of the statements and of
+ * the functions of a program. For each one, it records the count of runs,
+ * the inclusive and exclusive wall time, and the inclusive and exclusive
+ * count of temporary values allocated. It belongs to the instance root, so
+ * the workers of a parallel loop are not profiled: the whole loop is
+ * accounted to the statement running it.
+ */
+class Profiler
+{
+public:
+  enum Kind { STATEMENT = 0, FUNCTION = 1 };
+
+  struct Entry
+  {
+    Kind kind;
+    std::string label;        /* keyword of the statement, or function name */
+    unsigned line = 0;        /* source line of the statement */
+    uint64_t count = 0;       /* count of runs */
+    double total = 0.0;       /* inclusive wall time in seconds */
+    double self = 0.0;        /* exclusive wall time in seconds */
+    uint64_t allocs = 0;      /* inclusive count of allocations */
+    uint64_t self_allocs = 0; /* exclusive count of allocations */
+  };
+
+  Profiler() = default;
+  ~Profiler() = default;
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+
+  /**
+   * Run the statement in a new frame.
+   * @return the next statement to run
+   */
+  const Statement * execute(Context& ctx, const Statement& s);
+
+  /**
+   * Run the body of the function in a new frame.
+   * @param ctx   the runtime context of the function
+   */
+  void call(Context& ctx, const Functor& f);
+
+  /**
+   * Returns a copy of the entries sorted by descending exclusive time.
+   */
+  std::vector<Entry> entries() const;
+
+  /**
+   * Print the flat report of the entries sorted by descending exclusive
+   * time.
+   * @param out   the output stream
+   * @param max   the maximum count of entries to print, 0 for all
+   */
+  void report(FILE * out, unsigned max = 0) const;
+
+  size_t size() const { return _entries.size(); }
+
+  void clear();
+
+private:
+  typedef std::chrono::steady_clock clock;
+
+  struct Frame
+  {
+    Entry * entry;
+    Context * ctx;
+    clock::time_point start;
+    uint64_t allocs;          /* allocation total of the context at start */
+    double child_time = 0.0;
+    uint64_t child_allocs = 0;
+    uint64_t foreign = 0;     /* allocations done in other contexts */
+  };
+
+  /* the entries are keyed by statement or functor */
+  std::unordered_map<const void*, Entry> _entries;
+  std::vector<Frame> _frames;
+
+  void enter(Context& ctx, const void * key, Kind kind);
+  void leave();
+};
+
+}
+
+#endif /* PROFILER_H_ */
@@ -0,0 +1,56 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "regex_cache.h"
+
+namespace bloc
+{
+
+const std::regex& RegexCache::get(const std::string& pattern)
+{
+  auto it = _index.find(pattern);
+  if (it != _index.end())
+  {
+    ++_hits;
+    /* move to front as most recently used */
+    if (it->second != _lru.begin())
+      _lru.splice(_lru.begin(), _lru, it->second);
+    return it->second->second;
+  }
+  ++_misses;
+  /* compile first, as it could throw */
+  std::regex re(pattern);
+  if (_lru.size() >= _capacity && !_lru.empty())
+  {
+    _index.erase(_lru.back().first);
+    _lru.pop_back();
+  }
+  _lru.emplace_front(pattern, std::move(re));
+  _index.emplace(pattern, _lru.begin());
+  return _lru.front().second;
+}
+
+void RegexCache::clear()
+{
+  _index.clear();
+  _lru.clear();
+  _hits = 0;
+  _misses = 0;
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef REGEX_CACHE_H_
+#define REGEX_CACHE_H_
+
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <regex>
+
+#define REGEX_CACHE_SIZE 64
+
+namespace bloc
+{
+
+/**
+ * The cache of compiled regular expressions keyed by pattern. When the cache
+ * is full, the least recently used expression is evicted.
+ */
+class RegexCache
+{
+public:
+  explicit RegexCache(size_t capacity = REGEX_CACHE_SIZE) : _capacity(capacity) { }
+  ~RegexCache() = default;
+
+  RegexCache(const RegexCache&) = delete;
+  RegexCache& operator=(const RegexCache&) = delete;
+
+  /**
+   * Returns the compiled expression for the given pattern. The reference is
+   * valid until the next call.
+   * @param pattern     the regular expression
+   * @return            the compiled expression
+   * @throw std::regex_error
+   */
+  const std::regex& get(const std::string& pattern);
+
+  unsigned hits() const { return _hits; }
+
+  unsigned misses() const { return _misses; }
+
+  size_t size() const { return _lru.size(); }
+
+  void clear();
+
+private:
+  typedef std::list<std::pair<std::string, std::regex> > container;
+
+  size_t _capacity;
+  container _lru;
+  std::unordered_map<std::string, container::iterator> _index;
+  unsigned _hits = 0;
+  unsigned _misses = 0;
+};
+
+}
+
+#endif /* REGEX_CACHE_H_ */
@@ -0,0 +1,68 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHARED_PAYLOAD_H_
+#define SHARED_PAYLOAD_H_
+
+#include <atomic>
+
+namespace bloc
+{
+
+/**
+ * The base class of payloads shared between values: table and tuple.
+ * A payload is held by any number of values, and it is copied only when a
+ * value updates it in place (copy on write), see Value::clone() and
+ * Value::detach().
+ * A pinned payload cannot be shared anymore; any clone is a copy. This is
+ * required as long as pointers to its elements are in use.
+ */
+class SharedPayload
+{
+public:
+  SharedPayload() : _refs(1), _pins(0) { }
+
+  /* the copy is a new payload */
+  SharedPayload(const SharedPayload&) : _refs(1), _pins(0) { }
+  SharedPayload& operator=(const SharedPayload&) { return *this; }
+
+  void hold() const noexcept { _refs.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * Drop a reference.
+   * @return true if it was the last, then the payload must be deleted
+   */
+  bool release() const noexcept
+  {
+    return (_refs.fetch_sub(1, std::memory_order_acq_rel) == 1);
+  }
+
+  bool shared() const noexcept { return _refs.load(std::memory_order_acquire) > 1; }
+
+  void pin() const noexcept { _pins.fetch_add(1, std::memory_order_relaxed); }
+  void unpin() const noexcept { _pins.fetch_sub(1, std::memory_order_relaxed); }
+  bool pinned() const noexcept { return _pins.load(std::memory_order_relaxed) > 0; }
+
+private:
+  mutable std::atomic<unsigned> _refs;
+  mutable std::atomic<unsigned> _pins;
+};
+
+}
+
+#endif /* SHARED_PAYLOAD_H_ */
@@ -18,6 +18,8 @@
 
 #include "statement.h"
 #include "parser.h"
+#include "regex_cache.h"
+#include "profiler.h"
 
 #include <cstring>
 #include <cstddef>
@@ -35,7 +37,7 @@ const char * Statement::KEYWORDS[] = {
   "begin",    "break",    "continue", "end",      "end if",
   "end loop", "print",    "put",      "do",       "exception",
   "when",     "raise",    "asc",      "desc",     "is",
-  "forall",   "include",  "step",
+  "forall",   "include",  "step",     "parallel", "reduce",
 };
 
 Statement::~Statement()
@@ -46,9 +48,9 @@ Statement::~Statement()
 const Statement *Statement::execute(Context& ctx) const
 {
   bool trace = ctx.trace();
-  _level = ctx.execLevel();
   if (trace) trace_pre(ctx);
-  const Statement * next = doit(ctx);
+  Profiler * profiler = ctx.profiler();
+  const Statement * next = (profiler ? profiler->execute(ctx, *this) : doit(ctx));
   if (trace) trace_post(ctx);
   ctx.onStatementEnd(this);
   return next;
@@ -90,9 +92,14 @@ void Statement::trace_post(Context& ctx) const
   if (ctx.ctxerr())
   {
     size_t count = ctx.allocationCount();
-    fprintf(ctx.ctxerr(), "%012.6f: %s : alloc=%u bcr=%d%d%d\n",
+    fprintf(ctx.ctxerr(), "%012.6f: %s : alloc=%u bcr=%d%d%d",
             ctx.timestamp(), KEYWORDS[_keyword], (unsigned)count,
             ctx.breakCondition(), ctx.continueCondition(), ctx.returnCondition());
+    /* hits and misses of the regex cache */
+    if (ctx.regexCached())
+      fprintf(ctx.ctxerr(), " regex=%u/%u",
+              ctx.regexCache().hits(), ctx.regexCache().misses());
+    fputc('\n', ctx.ctxerr());
     fflush(ctx.ctxerr());
   }
 }
@@ -76,6 +76,8 @@ public:
     STMT_FORALL     = 30,
     STMT_INCLUDE    = 31,
     STMT_STEP       = 32,
+    STMT_PARALLEL   = 33,
+    STMT_REDUCE     = 34,
   };
 
   virtual ~Statement();
@@ -90,6 +92,8 @@ public:
    * abstract function 'doit' which is defined in each statement subclass. The
    * runtime error (if any) is caught so that the line number and statement can
    * be attached to the result and then it is re-thrown.
+   * Without trace nor profiler, the statement loop of the executable calls
+   * 'doit' straight.
    */
   const Statement * execute(Context& ctx) const;
 
@@ -129,7 +133,12 @@ public:
 
   int keyword() const { return _keyword; }
   Statement * next() const { return _next; }
-  size_t level() const { return _level; }
+
+  /**
+   * The source line where the statement begins, or 0 if unknown.
+   */
+  unsigned line() const { return _line; }
+  void line(unsigned n) { _line = n; }
 
   void setNext(Statement * s) { _next = s; }
 
@@ -140,7 +149,7 @@ protected:
 
   Statement * _next   = nullptr;
   STATEMENT _keyword  = STMT_NOP;
-  mutable size_t _level  = 0;
+  unsigned _line      = 0;
 
   void unparse_next(Context& ctx, FILE * out) const;
 
@@ -129,7 +129,7 @@ void BEGINStatement::unparse(Context& ctx, FILE * out) const
 
 Executable * BEGINStatement::parse_catch(Parser& p, Context& ctx)
 {
-  std::list<const Statement*> statements;
+  std::vector<const Statement*> statements;
   try
   {
     TokenPtr t;
@@ -165,7 +165,7 @@ BEGINStatement * BEGINStatement::parse(Parser& p, Context& ctx)
 {
   BEGINStatement * s = new BEGINStatement();
   ctx.execBegin(s);
-  std::list<const Statement*> statements;
+  std::vector<const Statement*> statements;
   try
   {
     TokenPtr t;
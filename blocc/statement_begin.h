@@ -51,6 +51,11 @@ public:
 
   const Statement * doit(Context& ctx) const override;
 
+  /**
+   * Returns true if the block has handlers of exception.
+   */
+  bool handlers() const { return !_catches.empty(); }
+
   void unparse(Context& ctx, FILE * out) const override;
 
   /**
@@ -31,6 +31,7 @@ ENDStatement * ENDStatement::parse(Parser& p, Context& ctx, STATEMENT endof)
   try
   {
     TokenPtr t = p.pop();
+    s->line(t->line);
     switch (endof)
     {
     case STMT_ENDIF:
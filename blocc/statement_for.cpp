@@ -24,6 +24,7 @@
 #include "expression_variable.h"
 #include "parser.h"
 #include "context.h"
+#include "optimizer.h"
 #include "debug.h"
 
 #include <string>
@@ -60,6 +61,9 @@ const Statement * FORStatement::doit(Context& ctx) const
 {
   if (this != ctx.topControl())
   {
+    /* release the values hoisted from the body */
+    for (unsigned id : _temporaries)
+      ctx.clearVariable(id);
     Integer s = 1;
     Value& vb = _expBeg->value(ctx);
     if (vb.isNull())
@@ -116,6 +120,10 @@ const Statement * FORStatement::doit(Context& ctx) const
     *(data->iterator->integer()) = nxt;
   }
 
+  /* release the values shared by the body for the previous iteration */
+  for (unsigned id : _iteration)
+    ctx.clearVariable(id);
+
   /* it should run with the given context, and will throw on error */
   _exec->run(ctx, _exec->statements());
 
@@ -175,12 +183,13 @@ void FORStatement::unparse(Context& ctx, FILE * out) const
 Executable * FORStatement::parse_clause(Parser& p, Context& ctx, FORStatement * rof)
 {
   ctx.execBegin(rof);
-  std::list<const Statement*> statements;
+  std::vector<const Statement*> statements;
   /* get symbol non-const */
   Symbol& vt = ctx.getSymbol(rof->_var->symbolId());
   /* iterator must be protected against type change */
   bool safety_bak = vt.safety();
   vt.safety(true);
+  Optimizer::loopBegin(ctx, rof, rof->_temporaries, &rof->_iteration, vt.id(), false);
   try
   {
     bool end = false;
@@ -205,12 +214,14 @@ Executable * FORStatement::parse_clause(Parser& p, Context& ctx, FORStatement *
   catch (ParseError& pe)
   {
     // cleanup
+    Optimizer::loopAbort(ctx, rof);
     vt.safety(safety_bak);
     ctx.execEnd();
     for (auto ss : statements)
       delete ss;
     throw;
   }
+  Optimizer::loopEnd(ctx, rof);
   vt.safety(safety_bak);
   ctx.execEnd();
   return new Executable(ctx, statements);
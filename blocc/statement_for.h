@@ -24,6 +24,7 @@
 #include "expression_integer.h"
 
 #include <string>
+#include <vector>
 
 namespace bloc
 {
@@ -53,6 +54,10 @@ private:
   Expression * _expStp = nullptr;
   Executable * _exec = nullptr;
   enum { AUTO = 0, ASC, DESC } _order = AUTO;
+  /* the values hoisted from the body, released on entry */
+  std::vector<unsigned> _temporaries;
+  /* the values shared by the statements of the body, released on iteration */
+  std::vector<unsigned> _iteration;
 
   struct RT
   {
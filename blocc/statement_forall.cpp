@@ -23,8 +23,11 @@
 #include "parse_statement.h"
 #include "expression_variable.h"
 #include "collection.h"
+#include "hashmap.h"
 #include "parser.h"
 #include "context.h"
+#include "optimizer.h"
+#include "parallel_executor.h"
 #include "debug.h"
 
 #include <string>
@@ -42,10 +45,15 @@ FORALLStatement::~FORALLStatement()
     delete _exp;
   if (_var)
     delete _var;
+  for (VariableExpression * r : _reduce)
+    delete r;
 }
 
 void FORALLStatement::finalizeControl(Context& ctx, void * data) const
 {
+  /* the control of a parallel worker holds no data */
+  if (data == nullptr)
+    return;
   RT * _data = reinterpret_cast<RT*>(data);
 
   /* restore the state of the iterator variable */
@@ -53,6 +61,19 @@ void FORALLStatement::finalizeControl(Context& ctx, void * data) const
   ctx.loadVariable(vs.id()).swap(Value(_data->it_type_bak).to_lvalue(true));
   vs.safety(_data->it_safety_bak);
   vs.locked(_data->it_locked_bak);
+  if (_data->view)
+  {
+    /* store the view of the last fetched row */
+    release(*_data);
+    delete _data->view;
+  }
+  if (_data->pinned)
+  {
+    if (_data->target->type() == Type::MAPTYPE)
+      _data->target->map()->unpin();
+    else
+      _data->target->collection()->unpin();
+  }
   if (_exp->symbolId() != Expression::nid)
   {
     /* restore the state of the symbol */
@@ -69,10 +90,16 @@ void FORALLStatement::finalizeControl(Context& ctx, void * data) const
 
 const Statement * FORALLStatement::doit(Context& ctx) const
 {
+  if (_parallel)
+    return doit_parallel(ctx);
+
   if (this != ctx.topControl())
   {
+    /* release the values hoisted from the body */
+    for (unsigned id : _temporaries)
+      ctx.clearVariable(id);
     Value& val = _exp->value(ctx);
-    if (val.isNull() || val.collection()->size() == 0)
+    if (val.isNull() || size_of(val) == 0)
       return _next;
     /* the variable, which will point to the fetched value, cannot already be
      * used by a running iteration i.e in parent loop; typically a protected
@@ -85,7 +112,7 @@ const Statement * FORALLStatement::doit(Context& ctx) const
     if (_order == DESC)
     {
       data.step = -1;
-      data.index = val.collection()->size()-1;
+      data.index = size_of(val)-1;
     }
     else
     {
@@ -117,10 +144,19 @@ const Statement * FORALLStatement::doit(Context& ctx) const
     data.it_safety_bak = vs.safety();
     data.it_locked_bak = vs.locked();
     data.it_type_bak = ctx.loadVariable(vs.id()).type();
+    /* the elements could be updated via the iterator, so the table must not
+     * be shared, and it cannot be shared during the loop */
+    if (!data.ex_locked_bak)
+    {
+      if (data.target->type() == Type::MAPTYPE)
+        data.target->detach().map()->pin();
+      else
+        data.target->detach().collection()->pin();
+      data.pinned = true;
+    }
 
     /* fetch first item: make a pointer to the element value */
-    make_pointer(data.target->collection(), data.index,
-              ctx.loadVariable(vs.id())).to_lvalue(true);
+    fetch(data, ctx.loadVariable(vs.id())).to_lvalue(true);
     vs.safety(true);
     /* iterator inherits constness of the target */
     vs.locked(data.ex_locked_bak);
@@ -129,8 +165,13 @@ const Statement * FORALLStatement::doit(Context& ctx) const
   else
   {
     RT * data = reinterpret_cast<RT*>(ctx.topControlData());
+    if (data->view)
+    {
+      /* store the view of the previous row, updated via the iterator */
+      release(*data);
+    }
     data->index += data->step;
-    if (data->index < 0 || size_t(data->index) >= data->target->collection()->size())
+    if (data->index < 0 || size_t(data->index) >= size_of(*data->target))
     {
       ctx.unstackControl();
       return _next;
@@ -138,8 +179,7 @@ const Statement * FORALLStatement::doit(Context& ctx) const
     else
     {
       /* fetch current item: make a pointer to the element value */
-      make_pointer(data->target->collection(), data->index,
-                ctx.loadVariable(_var->symbolId())).to_lvalue(true);
+      fetch(*data, ctx.loadVariable(_var->symbolId())).to_lvalue(true);
     }
   }
 
@@ -158,6 +198,156 @@ const Statement * FORALLStatement::doit(Context& ctx) const
   return _next;
 }
 
+bool FORALLStatement::isReduction(unsigned id) const
+{
+  for (VariableExpression * r : _reduce)
+  {
+    if (r->symbolId() == id)
+      return true;
+  }
+  return false;
+}
+
+const Statement * FORALLStatement::doit_parallel(Context& ctx) const
+{
+  Value& val = _exp->value(ctx);
+  if (val.isNull() || size_of(val) == 0)
+    return _next;
+  if (val.type() == Type::MAPTYPE)
+    throw RuntimeError(EXC_RT_OTHER_S, "PARALLEL FORALL requires a table expression.");
+  Symbol& vs = ctx.getSymbol(_var->symbolId());
+  if (vs.safety())
+    throw RuntimeError(EXC_RT_NOT_IMPLEMENTED);
+  Value * target = nullptr;
+  Value * temporary = nullptr;
+  bool ex_locked = false;
+  if (_exp->symbolId() != Expression::nid)
+  {
+    target = &val;
+    ex_locked = ctx.getSymbol(_exp->symbolId()).locked();
+  }
+  else if (!val.lvalue())
+  {
+    /* the target value is temporary and it must be preserved during the
+     * loop execution */
+    temporary = target = new Value(std::move(val.to_lvalue(true)));
+  }
+  else
+  {
+    throw RuntimeError(EXC_RT_NOT_IMPLEMENTED);
+  }
+
+  /* the elements could be updated via the iterator, so the table must not
+   * be shared, and it cannot be shared during the loop */
+  Collection * rows = target->collection();
+  if (!ex_locked)
+  {
+    rows = target->detach().collection();
+    rows->pin();
+  }
+  /* the workers make pointers to the rows */
+  rows->materialize();
+  ParallelExecutor executor(ctx.parallelism());
+  std::vector<Context*> workers;
+  try
+  {
+    /* setup a context for each worker */
+    unsigned n = executor.workers(rows->size());
+    for (unsigned k = 0; k < n; ++k)
+    {
+      Context * w = ctx.createWorker(_shared);
+      workers.push_back(w);
+      /* take control to handle break and continue */
+      w->stackControl(this, nullptr);
+      if (_exp->symbolId() != Expression::nid)
+        w->getSymbol(_exp->symbolId()).locked(true);
+      /* iterator inherits constness of the target */
+      Symbol& ws = w->getSymbol(vs.id());
+      ws.safety(true);
+      ws.locked(ex_locked);
+      /* the reduction starts from zero */
+      for (VariableExpression * r : _reduce)
+      {
+        Value& m = r->value(ctx);
+        Value& z = w->loadVariable(r->symbolId());
+        switch (m.type().major())
+        {
+        case Type::INTEGER:
+          z = Value(Integer(0));
+          break;
+        case Type::NUMERIC:
+          z = Value(Numeric(0.0));
+          break;
+        case Type::IMAGINARY:
+          z = Value(Imaginary{0.0, 0.0});
+          break;
+        default:
+          throw RuntimeError(EXC_RT_NOT_NUMERIC);
+        }
+        z.to_lvalue(true);
+        w->getSymbol(r->symbolId()).safety(true);
+      }
+    }
+
+    executor.run(rows->size(), [this, rows, &workers, &vs](unsigned k, size_t begin, size_t end)
+    {
+      Context& w = *workers[k];
+      Value& itr = w.loadVariable(vs.id());
+      for (size_t i = begin; i < end; ++i)
+      {
+        /* fetch current item: make a pointer to the element value */
+        make_pointer(rows, i, itr).to_lvalue(true);
+        _exec->run(w, _exec->statements());
+        if (w.breakCondition() || w.returnCondition())
+          throw RuntimeError(EXC_RT_OTHER_S, "BREAK or RETURN cannot stop a PARALLEL FORALL.");
+        w.continueCondition(false);
+      }
+    });
+
+    /* merge the partials */
+    for (VariableExpression * r : _reduce)
+    {
+      Value& m = r->value(ctx);
+      for (Context * w : workers)
+      {
+        Value& z = w->loadVariable(r->symbolId());
+        if (z.type() != m.type())
+          throw RuntimeError(EXC_RT_TYPE_MISMATCH_S, m.typeName().c_str());
+        if (z.isNull())
+          continue;
+        if (m.isNull())
+          m.swap(std::move(z));
+        else if (m.type() == Type::INTEGER)
+          *m.integer() += *z.integer();
+        else if (m.type() == Type::NUMERIC)
+          *m.numeric() += *z.numeric();
+        else
+        {
+          m.imaginary()->a += z.imaginary()->a;
+          m.imaginary()->b += z.imaginary()->b;
+        }
+      }
+    }
+  }
+  catch (...)
+  {
+    for (Context * w : workers)
+      delete w;
+    if (!ex_locked)
+      rows->unpin();
+    if (temporary)
+      delete temporary;
+    throw;
+  }
+  for (Context * w : workers)
+    delete w;
+  if (!ex_locked)
+    rows->unpin();
+  if (temporary)
+    delete temporary;
+  return _next;
+}
+
 void FORALLStatement::unparse(Context& ctx, FILE * out) const
 {
   fputs(Statement::KEYWORDS[keyword()], out);
@@ -181,6 +371,23 @@ void FORALLStatement::unparse(Context& ctx, FILE * out) const
     fputc(' ', out);
     break;
   }
+  if (_parallel)
+  {
+    fputs(KEYWORDS[STMT_PARALLEL], out);
+    fputc(' ', out);
+    if (!_reduce.empty())
+    {
+      fputs(KEYWORDS[STMT_REDUCE], out);
+      fputc(' ', out);
+      for (size_t i = 0; i < _reduce.size(); ++i)
+      {
+        if (i > 0)
+          fputc(Parser::Chain, out);
+        fputs(ctx.getSymbol(_reduce[i]->symbolId()).name().c_str(), out);
+      }
+      fputc(' ', out);
+    }
+  }
   fputs(KEYWORDS[STMT_LOOP], out);
   fputc(Parser::NewLine, out);
   ctx.execBegin(this);
@@ -195,10 +402,60 @@ Value& FORALLStatement::make_pointer(Collection * tgt, unsigned i, Value& itr) n
   return itr;
 }
 
+size_t FORALLStatement::size_of(Value& target)
+{
+  if (target.type().level() == 0 && target.type() == Type::MAPTYPE)
+    return target.map()->size();
+  return target.collection()->size();
+}
+
+void FORALLStatement::release(RT& data)
+{
+  /* the view is not stored back when the target is read-only */
+  if (data.target->type().level() == 0 && data.target->type() == Type::MAPTYPE)
+  {
+    /* the index is out of range when the loop is done */
+    HashMap * tgt = data.target->map();
+    if (!data.ex_locked_bak && data.index >= 0 && size_t(data.index) < tgt->size())
+      tgt->store_view((size_t) data.index, *data.view);
+  }
+  else
+    data.target->collection()->release_view(*data.view, !data.ex_locked_bak);
+}
+
+Value& FORALLStatement::fetch(RT& data, Value& itr)
+{
+  if (data.target->type().level() == 0 && data.target->type() == Type::MAPTYPE)
+  {
+    /* the entry of a map is loaded into the view, the iterator points to it */
+    if (data.view == nullptr)
+      data.view = new Value();
+    data.target->map()->load_view((size_t) data.index, *data.view);
+    itr = Value(data.view);
+    return itr;
+  }
+  Collection * tgt = data.target->collection();
+  if (tgt->columnar())
+  {
+    /* the row of a columnar table is loaded into the view, the iterator
+     * points to it */
+    if (data.view == nullptr)
+      data.view = new Value();
+    if (tgt->bind_view((unsigned) data.index, *data.view))
+    {
+      itr = Value(data.view);
+      return itr;
+    }
+    /* the table is viewed by another loop */
+    tgt->materialize();
+  }
+  return make_pointer(tgt, (unsigned) data.index, itr);
+}
+
 Executable * FORALLStatement::parse_clause(Parser& p, Context& ctx, FORALLStatement * rof)
 {
   ctx.execBegin(rof);
-  std::list<const Statement*> statements;
+  std::vector<const Statement*> statements;
   /* get symbol non-const */
   Symbol& vt = ctx.getSymbol(rof->_var->symbolId());
   /* iterator must be protected against type change */
@@ -216,6 +473,30 @@ Executable * FORALLStatement::parse_clause(Parser& p, Context& ctx, FORALLStatem
     /* iterator inherits constness of the target */
     vt.locked(locked_ex_bak);
   }
+  /* the body of a parallel loop cannot modify the shared symbols, but the
+   * iterator and the reductions, that must keep their type */
+  std::vector<unsigned> locked_ids;
+  std::vector<bool> safety_rd_bak;
+  if (rof->_parallel)
+  {
+    rof->_shared = ctx.symbolCount();
+    for (unsigned id = 0; id < rof->_shared; ++id)
+    {
+      Symbol& sym = ctx.getSymbol(id);
+      if (id == vt.id() || sym.locked() || rof->isReduction(id))
+        continue;
+      sym.locked(true);
+      locked_ids.push_back(id);
+    }
+    for (VariableExpression * r : rof->_reduce)
+    {
+      Symbol& sym = ctx.getSymbol(r->symbolId());
+      safety_rd_bak.push_back(sym.safety());
+      sym.safety(true);
+    }
+  }
+  /* the iterator points to the fetched elements */
+  Optimizer::loopBegin(ctx, rof, rof->_temporaries, nullptr, vt.id(), true);
   try
   {
     bool end = false;
@@ -240,6 +521,11 @@ Executable * FORALLStatement::parse_clause(Parser& p, Context& ctx, FORALLStatem
   catch (ParseError& pe)
   {
     // cleanup
+    Optimizer::loopAbort(ctx, rof);
+    for (unsigned id : locked_ids)
+      ctx.getSymbol(id).locked(false);
+    for (size_t i = 0; i < safety_rd_bak.size(); ++i)
+      ctx.getSymbol(rof->_reduce[i]->symbolId()).safety(safety_rd_bak[i]);
     if (sid != Expression::nid)
       ctx.getSymbol(sid).locked(locked_ex_bak);
     vt.safety(safety_vt_bak);
@@ -249,6 +535,11 @@ Executable * FORALLStatement::parse_clause(Parser& p, Context& ctx, FORALLStatem
       delete ss;
     throw;
   }
+  Optimizer::loopEnd(ctx, rof);
+  for (unsigned id : locked_ids)
+    ctx.getSymbol(id).locked(false);
+  for (size_t i = 0; i < safety_rd_bak.size(); ++i)
+    ctx.getSymbol(rof->_reduce[i]->symbolId()).safety(safety_rd_bak[i]);
   if (sid != Expression::nid)
     ctx.getSymbol(sid).locked(locked_ex_bak);
   vt.safety(safety_vt_bak);
@@ -257,6 +548,35 @@ Executable * FORALLStatement::parse_clause(Parser& p, Context& ctx, FORALLStatem
   return new Executable(ctx, statements);
 }
 
+void FORALLStatement::parse_reduce(Parser& p, Context& ctx, FORALLStatement * rof)
+{
+  TokenPtr t;
+  do
+  {
+    t = p.pop();
+    if (t->code != TOKEN_KEYWORD)
+      throw ParseError(EXC_PARSE_OTHER_S, "Symbol of reduction required for PARALLEL FORALL.", t);
+    if (p.reservedKeyword(t->text))
+      throw ParseError(EXC_PARSE_RESERVED_WORD_S, t->text.c_str(), t);
+    std::string vname = t->text;
+    std::transform(vname.begin(), vname.end(), vname.begin(), ::toupper);
+    const Symbol * s = ctx.findSymbol(vname);
+    if (s == nullptr)
+      throw ParseError(EXC_PARSE_UNDEFINED_SYMBOL_S, vname.c_str(), t);
+    if (s->locked())
+      throw ParseError(EXC_PARSE_CONST_VIOLATION_S, vname.c_str(), t);
+    if (s->id() == rof->_var->symbolId() || s->id() == rof->_exp->symbolId() ||
+            rof->isReduction(s->id()))
+      throw ParseError(EXC_PARSE_OTHER_S, "Invalid symbol of reduction.", t);
+    if (s->level() != 0 || (s->major() != Type::INTEGER &&
+            s->major() != Type::NUMERIC && s->major() != Type::IMAGINARY))
+      throw ParseError(EXC_PARSE_OTHER_S, "Reduction requires a numeric variable.", t);
+    rof->_reduce.push_back(new VariableExpression(*s));
+    t = p.pop();
+  } while (t->code == Parser::Chain);
+  p.push(t);
+}
+
 FORALLStatement * FORALLStatement::parse(Parser& p, Context& ctx)
 {
   FORALLStatement * s = new FORALLStatement();
@@ -294,6 +614,14 @@ FORALLStatement * FORALLStatement::parse(Parser& p, Context& ctx)
       else
         s->_var = new VariableExpression(ctx.registerSymbol(vname, exp_type));
     }
+    else if (exp_type.level() == 0 && exp_type.major() == Type::MAPTYPE)
+    {
+      /* register symbol of the entry: the key and the value */
+      if (exp_type.minor() == 0)
+        s->_var = new VariableExpression(ctx.registerSymbol(vname, Type(Type::ROWTYPE)));
+      else
+        s->_var = new VariableExpression(ctx.registerSymbol(vname, HashMap::entry_decl(exp_type), 0));
+    }
     else
     {
       if (exp_type.level() == 0)
@@ -319,6 +647,21 @@ FORALLStatement * FORALLStatement::parse(Parser& p, Context& ctx)
         t = p.pop();
       }
     }
+    if (t->code == TOKEN_KEYWORD && t->text == KEYWORDS[STMT_PARALLEL])
+    {
+      /* rows are fetched in any order */
+      if (s->_exp->type(ctx) == Type::MAPTYPE)
+        throw ParseError(EXC_PARSE_OTHER_S, "PARALLEL FORALL requires a table expression.", t);
+      if (s->_order != AUTO)
+        throw ParseError(EXC_PARSE_OTHER_S, "Fetch order cannot be specified for PARALLEL FORALL.", t);
+      s->_parallel = true;
+      t = p.pop();
+      if (t->code == TOKEN_KEYWORD && t->text == KEYWORDS[STMT_REDUCE])
+      {
+        parse_reduce(p, ctx, s);
+        t = p.pop();
+      }
+    }
     if (t->code != TOKEN_KEYWORD || t->text != KEYWORDS[STMT_LOOP])
       throw ParseError(EXC_PARSE_OTHER_S, "Missing LOOP keyword in FORALL statement.", t);
     s->_exec = parse_clause(p, ctx, s);
@@ -23,6 +23,7 @@
 #include "executable.h"
 
 #include <string>
+#include <vector>
 
 namespace bloc
 {
@@ -42,6 +43,16 @@ class Collection;
  * forall {var} in {table expression} [asc|desc] loop
  *     [statement ...]
  * end loop
+ * The iteration over a map fetches its entries as tuples of the key and the
+ * value; only the value could be updated.
+ *
+ * The PARALLEL form partitions the rows among a set of workers, each running
+ * the body in its own context. The shared symbols are read-only in the body,
+ * so the results are merged back by writing the fetched rows, or by summing
+ * the private partials of the reduction variables.
+ * forall {var} in {table expression} parallel [reduce {var} [, ...]] loop
+ *     [statement ...]
+ * end loop
  */
 class FORALLStatement : public Controller
 {
@@ -50,6 +61,12 @@ private:
   Expression * _exp = nullptr;
   Executable * _exec = nullptr;
   enum { AUTO = 0, ASC, DESC } _order = AUTO;
+  bool _parallel = false;
+  /* symbols below this id are shared with the workers */
+  unsigned _shared = 0;
+  std::vector<VariableExpression*> _reduce;
+  /* the values hoisted from the body, released on entry */
+  std::vector<unsigned> _temporaries;
 
   struct RT
   {
@@ -60,12 +77,28 @@ private:
     bool it_safety_bak = false;
     bool it_locked_bak = false;
     bool ex_locked_bak = false;
+    bool pinned = false;
+    /* the row of a columnar table, or the entry of a map, is loaded into
+     * the view */
+    Value * view = nullptr;
   };
 
   static Value& make_pointer(Collection * tgt, unsigned i, Value& itr) noexcept;
 
+  static Value& fetch(RT& data, Value& itr);
+
+  static size_t size_of(Value& target);
+
+  static void release(RT& data);
+
   static Executable * parse_clause(Parser& p, Context& ctx, FORALLStatement * rof);
 
+  static void parse_reduce(Parser& p, Context& ctx, FORALLStatement * rof);
+
+  bool isReduction(unsigned id) const;
+
+  const Statement * doit_parallel(Context& ctx) const;
+
 public:
   virtual ~FORALLStatement();
 
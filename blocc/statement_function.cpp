@@ -98,6 +98,32 @@ void FUNCTIONStatement::unparse(Context& ctx, FILE * out) const
   _functor->body->unparse(*_functor->ctx, out);
 }
 
+/* keep the tokens of the returned expression, when the body is a single
+ * RETURN statement of a small expression, without call of the functor */
+static void inlining(Functor& fct, const std::vector<TokenPtr>& tokens)
+{
+  if (tokens.empty() || tokens[0]->code != TOKEN_KEYWORD ||
+          tokens[0]->text != Statement::KEYWORDS[Statement::STMT_RETURN])
+    return;
+  size_t n = 1;
+  for (; n < tokens.size() && tokens[n]->code != Parser::Separator; ++n)
+  {
+    if (tokens[n]->code == TOKEN_KEYWORD)
+    {
+      std::string name(tokens[n]->text);
+      std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+      if (name == fct.name)
+        return;
+    }
+  }
+  /* the statement must be followed by the end of the body */
+  if (n == 1 || n - 1 > INLINE_THRESHOLD || n + 1 >= tokens.size() ||
+          tokens[n + 1]->code != TOKEN_KEYWORD ||
+          tokens[n + 1]->text != Statement::KEYWORDS[Statement::STMT_END])
+    return;
+  fct.inlined.assign(tokens.begin() + 1, tokens.begin() + n);
+}
+
 FUNCTIONStatement * FUNCTIONStatement::parse(Parser& p, Context& ctx)
 {
   bool rollback = false;
@@ -214,13 +240,18 @@ FUNCTIONStatement * FUNCTIONStatement::parse(Parser& p, Context& ctx)
     FunctorManager::Entry& fe = ctx.functorManager().createOrReplace(fct->name, fct->params);
     rollback = true;
     fe.functor.swap(fct);
-    /* parse body or throws */
+    /* parse body or throws, recording the tokens */
+    std::vector<TokenPtr> tokens;
+    p.record(&tokens);
     fe.functor->body = BEGINStatement::parse(p, *(fe.functor->ctx));
+    p.record(nullptr);
+    inlining(*fe.functor, tokens);
     return new FUNCTIONStatement(fe.functor);
   }
   catch (ParseError& pe)
   {
     DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    p.record(nullptr);
     if (rollback)
       ctx.functorManager().rollback();
     throw;
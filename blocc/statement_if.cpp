@@ -21,6 +21,8 @@
 #include "exception_parse.h"
 #include "parse_expression.h"
 #include "parse_statement.h"
+#include "expression_boolean.h"
+#include "executable.h"
 #include "parser.h"
 #include "context.h"
 #include "debug.h"
@@ -94,7 +96,7 @@ void IFStatement::unparse(Context& ctx, FILE * out) const
 Executable * IFStatement::parse_clause(Parser& p, Context& ctx, IFStatement * s)
 {
   ctx.execBegin(s);
-  std::list<const Statement*> statements;
+  std::vector<const Statement*> statements;
   try
   {
     bool end = false;
@@ -129,6 +131,53 @@ Executable * IFStatement::parse_clause(Parser& p, Context& ctx, IFStatement * s)
   return new Executable(ctx, statements);
 }
 
+/**
+ * Drop the rules which are never taken, and the ones following a rule which
+ * is always taken. At least one rule is kept, and the last one holds the
+ * statement END IF.
+ */
+void IFStatement::prune(Context& ctx)
+{
+  std::vector<const Statement*>& last = _rules.back().second->statements();
+  const Statement * end = last.back();
+  last.pop_back();
+
+  auto it = _rules.begin();
+  while (it != _rules.end())
+  {
+    if (it->first == nullptr || !it->first->isConst())
+    {
+      ++it;
+      continue;
+    }
+    Value& val = it->first->value(ctx);
+    if (!val.isNull() && *val.boolean())
+    {
+      /* always taken, so the next rules are unreachable */
+      ++it;
+      while (it != _rules.end())
+      {
+        if (it->first)
+          delete it->first;
+        delete it->second;
+        it = _rules.erase(it);
+      }
+      break;
+    }
+    if (_rules.size() == 1)
+      break;
+    /* never taken */
+    delete it->first;
+    delete it->second;
+    it = _rules.erase(it);
+  }
+  /* the ELSE rule cannot be the first */
+  if (_rules.front().first == nullptr)
+    _rules.front().first = new BooleanExpression(true);
+
+  _rules.back().second->statements().push_back(end);
+}
+
 IFStatement * IFStatement::parse(Parser& p, Context& ctx)
 {
   IFStatement * s = new IFStatement();
@@ -175,6 +224,8 @@ IFStatement * IFStatement::parse(Parser& p, Context& ctx)
         throw ParseError(EXC_PARSE_STATEMENT_END_S, t->text.c_str(), t);
       break;
     }
+    if (ctx.optimization() > 0)
+      s->prune(ctx);
     return s;
   }
   catch (ParseError& pe)
@@ -49,6 +49,7 @@ class IFStatement : public Statement
 private:
   std::list<std::pair<Expression*, Executable*> > _rules;
   static Executable * parse_clause(Parser& p, Context& ctx, IFStatement * s);
+  void prune(Context& ctx);
 
 public:
   virtual ~IFStatement();
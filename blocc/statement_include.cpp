@@ -93,7 +93,7 @@ void INCLUDEStatement::loadSource(Parser& p, Context& ctx)
     throw ParseError(EXC_PARSE_OTHER_S, "Failed to open file for read.");
 
   Parser * np = nullptr;
-  std::list<const Statement*> statements;
+  std::vector<const Statement*> statements;
 
   try
   {
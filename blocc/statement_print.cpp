@@ -77,6 +77,9 @@ const Statement * PRINTStatement::doit(Context& ctx) const
         case Type::ROWTYPE:
           fputs(Value::readableTuple(*val.tuple()).c_str(), ctx.ctxout());
           break;
+        case Type::MAPTYPE:
+          fputs(val.toString().c_str(), ctx.ctxout());
+          break;
         default:
           throw RuntimeError(EXC_RT_NOT_IMPLEMENTED);
         }
@@ -70,6 +70,7 @@ const Statement * PUTStatement::doit(Context& ctx) const
         }
         case Type::COMPLEX:
         case Type::ROWTYPE:
+        case Type::MAPTYPE:
           break;
         default:
           throw RuntimeError(EXC_RT_NOT_IMPLEMENTED);
@@ -17,6 +17,8 @@
  */
 
 #include "statement_return.h"
+#include "statement_begin.h"
+#include "expression_functor.h"
 #include "exception_parse.h"
 #include "parse_expression.h"
 #include "parser.h"
@@ -38,9 +40,23 @@ RETURNStatement::~RETURNStatement()
     delete _exp;
 }
 
+/* the errors of the call must be caught by the handlers of the blocks */
+static bool handled(const Context& ctx)
+{
+  for (size_t i = 0; i < ctx.execLevel(); ++i)
+  {
+    const Statement * s = ctx.execStatement(i);
+    if (s->keyword() == Statement::STMT_BEGIN && static_cast<const BEGINStatement*>(s)->handlers())
+      return true;
+  }
+  return false;
+}
+
 const Statement * RETURNStatement::doit(Context& ctx) const
 {
-  if (_exp != nullptr)
+  if (_tail && !handled(ctx))
+    static_cast<const FunctorExpression*>(_exp)->tailCall(ctx);
+  else if (_exp != nullptr)
     ctx.saveReturned(_exp->value(ctx));
   ctx.returnCondition(true);
   return _next;
@@ -65,6 +81,10 @@ RETURNStatement * RETURNStatement::parse(Parser& p, Context& ctx)
   try
   {
     s->_exp = ParseExpression::expression(p, ctx);
+    /* the call of the functor being parsed can reuse the frame */
+    FunctorExpression * fe = dynamic_cast<FunctorExpression*>(s->_exp);
+    if (fe && fe->recursive(ctx))
+      s->_tail = true;
     return s;
   }
   catch (ParseError& pe)
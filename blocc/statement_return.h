@@ -40,6 +40,8 @@ class Expression;
 class RETURNStatement : public Statement
 {
   Expression * _exp = nullptr;
+  /* the expression is a call of the functor in tail position */
+  bool _tail = false;
 
 public:
   virtual ~RETURNStatement();
@@ -23,6 +23,7 @@
 #include "parse_statement.h"
 #include "parser.h"
 #include "context.h"
+#include "optimizer.h"
 #include "debug.h"
 
 #include <string>
@@ -47,6 +48,9 @@ const Statement * WHILEStatement::doit(Context& ctx) const
 {
   if (this != ctx.topControl())
   {
+    /* release the values hoisted from the body */
+    for (unsigned id : _temporaries)
+      ctx.clearVariable(id);
     ctx.stackControl(this, nullptr);
   }
   Value& val = exp->value(ctx);
@@ -83,7 +87,7 @@ void WHILEStatement::unparse(Context& ctx, FILE * out) const
 Executable * WHILEStatement::parse_clause(Parser& p, Context& ctx, Statement * ihw)
 {
   ctx.execBegin(ihw);
-  std::list<const Statement*> statements;
+  std::vector<const Statement*> statements;
   try
   {
     bool end = false;
@@ -121,6 +125,8 @@ WHILEStatement * WHILEStatement::parse(Parser& p, Context& ctx)
   WHILEStatement * s = new WHILEStatement();
   try
   {
+    /* the condition is evaluated on each iteration */
+    Optimizer::loopBegin(ctx, s, s->_temporaries, nullptr, Expression::nid, false);
     s->exp = ParseExpression::expression(p, ctx);
     if (s->exp->type(ctx) != Type::BOOLEAN)
       throw ParseError(EXC_PARSE_OTHER_S, "Boolean expression required for WHILE.", p.front());
@@ -130,6 +136,7 @@ WHILEStatement * WHILEStatement::parse(Parser& p, Context& ctx)
     if (t->code != TOKEN_KEYWORD || t->text != KEYWORDS[STMT_LOOP])
       throw ParseError(EXC_PARSE_OTHER_S, "Missing LOOP keyword in WHILE statement.", t);
     s->_exec = parse_clause(p, ctx, s);
+    Optimizer::loopEnd(ctx, s);
     t = p.pop();
     if (t->text != KEYWORDS[STMT_END])
       throw ParseError(EXC_PARSE_OTHER_S, "Endless WHILE LOOP statement.", t);
@@ -143,6 +150,7 @@ WHILEStatement * WHILEStatement::parse(Parser& p, Context& ctx)
   catch (ParseError& pe)
   {
     DBG(DBG_DEBUG, "exception %p at %s line %d\n", &pe, __PRETTY_FUNCTION__, __LINE__);
+    Optimizer::loopAbort(ctx, s);
     delete s;
     throw;
   }
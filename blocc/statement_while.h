@@ -22,6 +22,7 @@
 #include "statement.h"
 
 #include <string>
+#include <vector>
 
 namespace bloc
 {
@@ -45,6 +46,8 @@ class WHILEStatement : public Controller
 private:
   Expression * exp = nullptr;
   Executable * _exec = nullptr;
+  /* the values hoisted from the body, released on entry */
+  std::vector<unsigned> _temporaries;
 
   static Executable * parse_clause(Parser& p, Context& ctx, Statement * ihw);
 
@@ -33,6 +33,8 @@ class Symbol : public Type, public TupleDecl
 public:
 
   constexpr static char SAFETY_QUALIFIER = '$';
+  /* qualifier of the hidden variables of the optimizer */
+  constexpr static char HIDDEN_QUALIFIER = '#';
 
   Symbol(unsigned id, const std::string& name, const Type& type)
   : Type(type), _id(id), _name(name) { }
@@ -47,6 +47,11 @@ public:
     return _stack.back();
   }
 
+  T at(size_t i) const
+  {
+    return _stack[i];
+  }
+
   void unstack()
   {
     if (!empty())
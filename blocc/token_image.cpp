@@ -0,0 +1,190 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "token_image.h"
+#include "context.h"
+
+#include <cstdio>
+#include <cstring>
+#include <sys/stat.h>
+
+#define IMAGE_MAGIC     "BLOCIMG"
+#define IMAGE_FORMAT    1
+
+namespace bloc
+{
+
+/* the file is closed on return */
+struct ImageFile
+{
+  FILE * file;
+  explicit ImageFile(FILE * f) : file(f) { }
+  ~ImageFile() { if (file) ::fclose(file); }
+};
+
+/* the image is encoded in memory, then written at once */
+template<typename T>
+static void put_item(std::string& buf, T v)
+{
+  buf.append(reinterpret_cast<const char*>(&v), sizeof(T));
+}
+
+static void put_text(std::string& buf, const std::string& text)
+{
+  put_item<uint32_t>(buf, (uint32_t) text.size());
+  buf.append(text);
+}
+
+/* the image is read at once, then decoded from memory */
+struct ImageReader
+{
+  const char * p;
+  const char * end;
+
+  template<typename T>
+  bool get_item(T& v)
+  {
+    if (size_t(end - p) < sizeof(T))
+      return false;
+    ::memcpy(&v, p, sizeof(T));
+    p += sizeof(T);
+    return true;
+  }
+
+  bool get_text(std::string& text)
+  {
+    uint32_t len;
+    if (!get_item(len) || size_t(end - p) < len)
+      return false;
+    text.assign(p, len);
+    p += len;
+    return true;
+  }
+};
+
+bool TokenImage::sign(const std::string& path, Signature& sig)
+{
+  struct stat st;
+  if (::stat(path.c_str(), &st) != 0)
+    return false;
+  ImageFile f(::fopen(path.c_str(), "rb"));
+  if (f.file == nullptr)
+    return false;
+  /* FNV-1a */
+  uint64_t h = 14695981039346656037ULL;
+  uint64_t size = 0;
+  char buf[4096];
+  size_t len;
+  while ((len = ::fread(buf, 1, sizeof(buf), f.file)) > 0)
+  {
+    for (size_t i = 0; i < len; ++i)
+    {
+      h ^= (unsigned char) buf[i];
+      h *= 1099511628211ULL;
+    }
+    size += len;
+  }
+  if (::ferror(f.file))
+    return false;
+  sig.size = size;
+  sig.mtime = (int64_t) st.st_mtime;
+  sig.hash = h;
+  return true;
+}
+
+bool TokenImage::save(const std::string& path, const Signature& sig) const
+{
+  std::string buf;
+  buf.append(IMAGE_MAGIC, sizeof(IMAGE_MAGIC));
+  put_item<uint32_t>(buf, IMAGE_FORMAT);
+  put_text(buf, Context::version());
+  put_item(buf, sig.size);
+  put_item(buf, sig.mtime);
+  put_item(buf, sig.hash);
+  put_item<uint32_t>(buf, (uint32_t) _tokens.size());
+  for (const TokenPtr& t : _tokens)
+  {
+    put_item<int32_t>(buf, t->code);
+    put_item<int32_t>(buf, t->line);
+    put_item<int32_t>(buf, t->column);
+    put_text(buf, t->text);
+  }
+
+  ImageFile f(::fopen(path.c_str(), "wb"));
+  if (f.file == nullptr)
+    return false;
+  if (::fwrite(buf.data(), 1, buf.size(), f.file) != buf.size() || ::fflush(f.file) != 0)
+  {
+    /* do not leave a truncated image */
+    ::fclose(f.file);
+    f.file = nullptr;
+    ::remove(path.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool TokenImage::load(const std::string& path, const Signature& sig)
+{
+  clear();
+  struct stat st;
+  if (::stat(path.c_str(), &st) != 0)
+    return false;
+  ImageFile f(::fopen(path.c_str(), "rb"));
+  if (f.file == nullptr)
+    return false;
+  std::string buf(st.st_size, '\0');
+  if (buf.empty() || ::fread(&buf[0], 1, buf.size(), f.file) != buf.size())
+    return false;
+
+  ImageReader r = { buf.data(), buf.data() + buf.size() };
+  uint32_t format, count;
+  std::string version;
+  Signature s;
+  if (buf.size() < sizeof(IMAGE_MAGIC) ||
+          ::memcmp(r.p, IMAGE_MAGIC, sizeof(IMAGE_MAGIC)) != 0)
+    return false;
+  r.p += sizeof(IMAGE_MAGIC);
+  if (!r.get_item(format) || format != IMAGE_FORMAT ||
+          !r.get_text(version) || version != Context::version() ||
+          !r.get_item(s.size) || !r.get_item(s.mtime) || !r.get_item(s.hash) ||
+          !(s == sig) || !r.get_item(count))
+    return false;
+  _tokens.reserve(count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    int32_t code, line, column;
+    std::string text;
+    if (!r.get_item(code) || !r.get_item(line) || !r.get_item(column) ||
+            !r.get_text(text))
+    {
+      clear();
+      return false;
+    }
+    _tokens.push_back(std::make_shared<Token>(code, text, line, column));
+  }
+  /* nothing should follow */
+  if (r.p != r.end)
+  {
+    clear();
+    return false;
+  }
+  return true;
+}
+
+}
@@ -0,0 +1,107 @@
+/*
+ *      Copyright (C) 2026 Jean-Luc Barriere
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TOKEN_IMAGE_H_
+#define TOKEN_IMAGE_H_
+
+#include "token.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bloc
+{
+
+/**
+ * The image of a source, as the sequence of the tokens made by the scanner.
+ * It is saved with the signature of the source, so that the parser can
+ * replay it instead of scanning the source again, while this one is
+ * unchanged (see Parser::compile).
+ */
+class TokenImage
+{
+public:
+  struct Signature
+  {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    uint64_t hash = 0;
+
+    bool operator==(const Signature& s) const
+    {
+      return size == s.size && mtime == s.mtime && hash == s.hash;
+    }
+  };
+
+  TokenImage() = default;
+
+  /**
+   * Compute the signature of the source file: its size, its time of last
+   * modification, and the hash of its content.
+   * @return false if the file cannot be read
+   */
+  static bool sign(const std::string& path, Signature& sig);
+
+  /**
+   * Write the image to the file, with the signature of the source.
+   * @return false on failure
+   */
+  bool save(const std::string& path, const Signature& sig) const;
+
+  /**
+   * Read the image from the file. It fails if the file is corrupted, if it
+   * was made by another version of the library, or if its signature does
+   * not match the given one.
+   * @return false on failure, and the image is left empty
+   */
+  bool load(const std::string& path, const Signature& sig);
+
+  void clear() { _tokens.clear(); _next = 0; }
+  size_t size() const { return _tokens.size(); }
+
+  /**
+   * Append a token to the image.
+   */
+  void push(const TokenPtr& t) { _tokens.push_back(t); }
+
+  /**
+   * Pop the next token to replay.
+   * @return false at the end of the image
+   */
+  bool pop(TokenPtr& t)
+  {
+    if (_next >= _tokens.size())
+      return false;
+    t = _tokens[_next++];
+    return true;
+  }
+
+  /**
+   * Rewind the image to replay it again.
+   */
+  void rewind() { _next = 0; }
+
+private:
+  std::vector<TokenPtr> _tokens;
+  size_t _next = 0;
+};
+
+}
+
+#endif /* TOKEN_IMAGE_H_ */
@@ -21,6 +21,7 @@
 
 #include "intrinsic_type.h"
 #include "tuple_decl.h"
+#include "shared_payload.h"
 #include "value.h"
 
 #include <vector>
@@ -28,7 +29,7 @@
 namespace bloc
 {
 
-class Tuple : public TupleDecl
+class Tuple : public TupleDecl, public SharedPayload
 {
 public:
   typedef std::vector<Value> container_t;
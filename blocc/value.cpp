@@ -20,6 +20,7 @@
 #include "complex.h"
 #include "tuple.h"
 #include "collection.h"
+#include "hashmap.h"
 #include "plugin_manager.h"
 #include "blocc/collection.h"
 #include "debug.h"
@@ -50,6 +51,7 @@ const Type& Value::type_tabchar = Type(Type::TABCHAR);
 const Type& Value::type_rowtype = Type(Type::ROWTYPE);
 const Type& Value::type_pointer = Type(Type::POINTER);
 const Type& Value::type_imaginary = Type(Type::IMAGINARY);
+const Type& Value::type_maptype = Type(Type::MAPTYPE);
 
 void Value::_clear() noexcept
 {
@@ -58,12 +60,15 @@ void Value::_clear() noexcept
 #endif
   _flags &= ~NOTNULL;
   if (_type.level() > 0)
-    delete _bloc_vcast_1(Collection);
+  {
+    if (_bloc_vcast_1(Collection)->release())
+      delete _bloc_vcast_1(Collection);
+  }
   else
     switch (_type.major())
     {
     case Type::LITERAL:
-      delete _bloc_vcast_1(Literal);
+      _literal()->~Literal();
       break;
     case Type::COMPLEX:
       delete _bloc_vcast_1(Complex);
@@ -72,10 +77,12 @@ void Value::_clear() noexcept
       delete _bloc_vcast_1(TabChar);
       break;
     case Type::ROWTYPE:
-      delete _bloc_vcast_1(Tuple);
+      if (_bloc_vcast_1(Tuple)->release())
+        delete _bloc_vcast_1(Tuple);
       break;
-    case Type::IMAGINARY:
-      delete _bloc_vcast_1(Imaginary);
+    case Type::MAPTYPE:
+      if (_bloc_vcast_1(HashMap)->release())
+        delete _bloc_vcast_1(HashMap);
       break;
     default:
       break;
@@ -87,10 +94,12 @@ Value::Value(Imaginary * v) : _type(Type::IMAGINARY)
 #ifdef DEBUG_VALUE
   DBG(DBG_DEBUG, "%s line %d\n", __PRETTY_FUNCTION__, __LINE__);
 #endif
+  /* the imaginary is stored inline, so the given one is released */
   if (v)
   {
-    _value.p = v;
+    _value.z = *v;
     _flags = NOTNULL;
+    delete v;
   }
 }
 
@@ -99,10 +108,12 @@ Value::Value(Literal * v) : _type(Type::LITERAL)
 #ifdef DEBUG_VALUE
   DBG(DBG_DEBUG, "%s line %d\n", __PRETTY_FUNCTION__, __LINE__);
 #endif
+  /* the literal is stored inline, so the given one is moved then released */
   if (v)
   {
-    _value.p = v;
+    new (&_value.s) Literal(std::move(*v));
     _flags = NOTNULL;
+    delete v;
   }
 }
 
@@ -157,6 +168,19 @@ Value::Value(Collection * v) : _type(type_no_type.levelUp())
   }
 }
 
+Value::Value(HashMap * v) : _type(Type::MAPTYPE)
+{
+#ifdef DEBUG_VALUE
+  DBG(DBG_DEBUG, "%s line %d\n", __PRETTY_FUNCTION__, __LINE__);
+#endif
+  if (v)
+  {
+    _value.p = v;
+    _type = v->map_type();
+    _flags = NOTNULL;
+  }
+}
+
 Value::Value(Value * v) : _type(Type::POINTER)
 {
 #ifdef DEBUG_VALUE
@@ -169,14 +193,29 @@ Value::Value(Value * v) : _type(Type::POINTER)
   }
 }
 
+void Value::_move(Value& v) noexcept
+{
+  _type = v._type;
+  _flags = v._flags;
+  if (v._inlined())
+  {
+    /* an inline literal cannot be copied bitwise */
+    new (&_value.s) Literal(std::move(*v._literal()));
+    v._literal()->~Literal();
+  }
+  else
+    _value = v._value;
+  v._flags = 0;
+}
+
 Value::Value(Value&& v) noexcept
-: _value(v._value), _type(v._type), _flags(v._flags)
+: _type(Type::NO_TYPE)
 {
 #ifdef DEBUG_VALUE
   DBG(DBG_DEBUG, "%s line %d\n", __PRETTY_FUNCTION__, __LINE__);
 #endif
   /* move */
-  v._flags = 0;
+  _move(v);
 }
 
 Value& Value::operator=(Value&& v) noexcept
@@ -189,10 +228,7 @@ Value& Value::operator=(Value&& v) noexcept
   if (!isNull())
     _clear();
   /*  move */
-  _value = v._value;
-  _type = v._type;
-  _flags = v._flags;
-  v._flags = 0;
+  _move(v);
   return *this;
 }
 
@@ -203,6 +239,13 @@ void Value::swap(Value& v) noexcept
 #endif
   if (this == &v)
     return;
+  if (_inlined() || v._inlined())
+  {
+    Value tmp(std::move(v));
+    v._move(*this);
+    _move(tmp);
+    return;
+  }
   payload tmp_p = _value;
   Type tmp_t = _type;
   int tmp_f = _flags;
@@ -224,10 +267,7 @@ void Value::swap(Value&& v) noexcept
   if (!isNull())
     _clear();
   /*  move */
-  _value = v._value;
-  _type = v._type;
-  _flags = v._flags;
-  v._flags = 0;
+  _move(v);
 }
 
 Value Value::clone() const noexcept
@@ -240,7 +280,17 @@ Value Value::clone() const noexcept
   {
     c._flags = NOTNULL;
     if (_type.level() > 0)
-      c._value.p = new Collection(*_bloc_vcast_1(Collection));
+    {
+      /* share the table, unless pointers to its elements are in use */
+      Collection * rv = _bloc_vcast_1(Collection);
+      if (rv->pinned())
+        c._value.p = new Collection(*rv);
+      else
+      {
+        rv->hold();
+        c._value.p = rv;
+      }
+    }
     else
       switch (_type.major())
       {
@@ -256,10 +306,10 @@ Value Value::clone() const noexcept
         c._value.d = _value.d;
         break;
       case Type::IMAGINARY:
-        c._value.p = new Imaginary(*_bloc_vcast_1(Imaginary));
+        c._value.z = _value.z;
         break;
       case Type::LITERAL:
-        c._value.p = new Literal(*_bloc_vcast_1(Literal));
+        new (&c._value.s) Literal(*_literal());
         break;
       case Type::COMPLEX:
         c._value.p = new Complex(*_bloc_vcast_1(Complex));
@@ -268,8 +318,31 @@ Value Value::clone() const noexcept
         c._value.p = new TabChar(*_bloc_vcast_1(TabChar));
         break;
       case Type::ROWTYPE:
-        c._value.p = new Tuple(*_bloc_vcast_1(Tuple));
+      {
+        /* share the tuple, unless pointers to its elements are in use */
+        Tuple * rv = _bloc_vcast_1(Tuple);
+        if (rv->pinned())
+          c._value.p = new Tuple(*rv);
+        else
+        {
+          rv->hold();
+          c._value.p = rv;
+        }
         break;
+      }
+      case Type::MAPTYPE:
+      {
+        /* share the map, unless pointers to its entries are in use */
+        HashMap * rv = _bloc_vcast_1(HashMap);
+        if (rv->pinned())
+          c._value.p = new HashMap(*rv);
+        else
+        {
+          rv->hold();
+          c._value.p = rv;
+        }
+        break;
+      }
       case Type::POINTER:
       {
         /* clone the pointed to value */
@@ -288,6 +361,81 @@ Value Value::clone() const noexcept
   return c;
 }
 
+Value Value::deep_clone() const noexcept
+{
+#ifdef DEBUG_VALUE
+  DBG(DBG_DEBUG, "%s line %d\n", __PRETTY_FUNCTION__, __LINE__);
+#endif
+  if (isNull())
+    return clone();
+  if (_type.level() > 0)
+  {
+    const Collection * rv = _bloc_vcast_1(Collection);
+    /* the copy of the columns is deep */
+    if (rv->columnar())
+      return Value(new Collection(*rv));
+    Collection::container_t items;
+    items.reserve(rv->size());
+    for (unsigned i = 0; i < rv->size(); ++i)
+      items.push_back((*rv)[i].deep_clone());
+    if (rv->table_decl().empty())
+      return Value(new Collection(rv->table_type(), std::move(items)));
+    return Value(new Collection(rv->table_decl(), _type.level(), std::move(items)));
+  }
+  if (_type == Type::ROWTYPE)
+  {
+    const Tuple * rv = _bloc_vcast_1(Tuple);
+    Tuple::container_t items;
+    items.reserve(rv->size());
+    for (unsigned i = 0; i < rv->size(); ++i)
+      items.push_back((*rv)[i].deep_clone());
+    return Value(new Tuple(std::move(items)));
+  }
+  /* the entries of a map are scalar */
+  if (_type == Type::MAPTYPE)
+    return Value(new HashMap(*_bloc_vcast_1(HashMap)));
+  if (_type == Type::POINTER)
+    return deref_value().deep_clone();
+  return clone();
+}
+
+Value& Value::detach() noexcept
+{
+  if (isNull())
+    return *this;
+  if (_type.level() > 0)
+  {
+    Collection * rv = _bloc_vcast_1(Collection);
+    if (rv->shared())
+    {
+      _value.p = new Collection(*rv);
+      if (rv->release())
+        delete rv;
+    }
+  }
+  else if (_type == Type::ROWTYPE)
+  {
+    Tuple * rv = _bloc_vcast_1(Tuple);
+    if (rv->shared())
+    {
+      _value.p = new Tuple(*rv);
+      if (rv->release())
+        delete rv;
+    }
+  }
+  else if (_type == Type::MAPTYPE)
+  {
+    HashMap * rv = _bloc_vcast_1(HashMap);
+    if (rv->shared())
+    {
+      _value.p = new HashMap(*rv);
+      if (rv->release())
+        delete rv;
+    }
+  }
+  return *this;
+}
+
 std::string Value::toString() const
 {
 #ifdef DEBUG_VALUE
@@ -318,10 +466,10 @@ std::string Value::toString() const
             .append(readableNumeric(_value.d));
   case Type::IMAGINARY:
     return typeName().append(1, ' ')
-            .append(readableImaginary(*_bloc_vcast_1(Imaginary)));
+            .append(readableImaginary(_value.z));
   case Type::LITERAL:
     return typeName().append(1, '[')
-            .append(std::to_string(_bloc_vcast_1(Literal)->size()))
+            .append(std::to_string(_literal()->size()))
             .append(1, ']');
   case Type::COMPLEX:
     return readableComplex(*_bloc_vcast_1(Complex));
@@ -329,6 +477,10 @@ std::string Value::toString() const
     return typeName().append(1, '[')
             .append(std::to_string(_bloc_vcast_1(TabChar)->size()))
             .append(1, ']');
+  case Type::MAPTYPE:
+    return typeName().append(1, '[')
+            .append(std::to_string(_bloc_vcast_1(HashMap)->size()))
+            .append(1, ']');
 
   default:
     break;
@@ -352,6 +504,8 @@ std::string Value::typeName() const
     if (_type.level() > 0)
       return _type.typeName(_bloc_vcast_1(Collection)->table_decl().tupleName());
     return _type.typeName(_bloc_vcast_1(Tuple)->tuple_decl().tupleName());
+  case Type::MAPTYPE:
+    return _type.typeName(HashMap::mapName(_type));
   default:
     return _type.typeName();
   }
@@ -516,7 +670,7 @@ void Value::outputTabchar(const TabChar& v, FILE * _stdout, unsigned max_lines)
 
 Value Value::parseLiteral(const std::string& text)
 {
-  Value val(new Literal());
+  Value val = Value(Literal());
   Literal * v = val.literal();
   v->reserve(text.size());
   /* start on enclosure, then finally drop last enclosure */
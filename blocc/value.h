@@ -26,6 +26,8 @@
 #include <string>
 #include <cinttypes>
 #include <cstdio>
+#include <new>
+#include <type_traits>
 
 namespace bloc
 {
@@ -33,6 +35,7 @@ namespace bloc
 class Complex;
 class Tuple;
 class Collection;
+class HashMap;
 
 typedef bool Bool;
 typedef int64_t Integer;
@@ -43,8 +46,12 @@ typedef std::vector<char> TabChar;
 
 class Value final
 {
-  /* value payload */
-  typedef union { bool b; int64_t i; double d; void * p; } payload;
+  /* value payload, the imaginary and the literal are stored inline */
+  typedef union
+  {
+    bool b; int64_t i; double d; void * p; Imaginary z;
+    std::aligned_storage<sizeof(Literal), alignof(Literal)>::type s;
+  } payload;
   mutable payload _value;
 
   /* value type */
@@ -56,6 +63,16 @@ class Value final
 
   void _clear() noexcept;
 
+  /* the inline literal, valid only when _inlined() */
+  Literal * _literal() const { return reinterpret_cast<Literal*>(&_value.s); }
+  bool _inlined() const
+  {
+    return (_flags & NOTNULL) && _type.level() == 0 && _type.major() == Type::LITERAL;
+  }
+
+  /* take the payload of v, this must be null */
+  void _move(Value& v) noexcept;
+
 public:
   LIBBLOC_API static const char * STR_TRUE;
   LIBBLOC_API static const char * STR_FALSE;
@@ -74,6 +91,7 @@ public:
   LIBBLOC_API static const Type& type_tabchar;
   LIBBLOC_API static const Type& type_rowtype;
   LIBBLOC_API static const Type& type_pointer;
+  LIBBLOC_API static const Type& type_maptype;
 
   bool operator==(const Value& v) const { return (this->_value.p == v._value.p); }
   bool operator!=(const Value& v) const { return !(*this == v); }
@@ -83,12 +101,16 @@ public:
   explicit Value(Bool v)    : _type(Type::BOOLEAN), _flags(NOTNULL) { _value.b = v; }
   explicit Value(Integer v) : _type(Type::INTEGER), _flags(NOTNULL) { _value.i = v; }
   explicit Value(Numeric v) : _type(Type::NUMERIC), _flags(NOTNULL) { _value.d = v; }
+  explicit Value(const Imaginary& v) : _type(Type::IMAGINARY), _flags(NOTNULL) { _value.z = v; }
+  explicit Value(const Literal& v) : _type(Type::LITERAL), _flags(NOTNULL) { new (&_value.s) Literal(v); }
+  explicit Value(Literal&& v) : _type(Type::LITERAL), _flags(NOTNULL) { new (&_value.s) Literal(std::move(v)); }
   explicit Value(Imaginary * v);
   explicit Value(Literal * v);
   explicit Value(TabChar * v);
   explicit Value(Complex * v);
   explicit Value(Tuple * v);
   explicit Value(Collection * v);
+  explicit Value(HashMap * v);
   explicit Value(Value * v);
 
   ~Value() { if (!isNull()) _clear(); }
@@ -108,9 +130,18 @@ public:
   /* move */
   void swap(Value&& v) noexcept;
 
-  /* clone */
+  /* clone: a table, a tuple or a map is shared until updated */
   Value clone() const noexcept;
 
+  /* clone: a table, a tuple or a map is copied including its elements */
+  Value deep_clone() const noexcept;
+
+  /**
+   * Ensure the payload of a table, a tuple or a map is not shared, before
+   * updating it in place. A shared payload is replaced by a copy.
+   */
+  Value& detach() noexcept;
+
   payload get() { return _value; }
 
   bool isNull() const { return (_flags & NOTNULL) == 0; }
@@ -159,14 +190,14 @@ public:
   {
     if (_type != Type::IMAGINARY || _type.level())
       throw RuntimeError(EXC_RT_NOT_IMAGINARY);
-    return _bloc_vcast_null(Imaginary);
+    return (isNull() ? nullptr : &_value.z);
   }
 
   Literal * literal()
   {
     if (_type != Type::LITERAL || _type.level())
       throw RuntimeError(EXC_RT_NOT_LITERAL);
-    return _bloc_vcast_null(Literal);
+    return (isNull() ? nullptr : _literal());
   }
 
   TabChar * tabchar()
@@ -190,6 +221,13 @@ public:
     return _bloc_vcast_null(Tuple);
   }
 
+  HashMap * map()
+  {
+    if (_type != Type::MAPTYPE || _type.level())
+      throw RuntimeError(EXC_RT_NOT_MAPTYPE);
+    return _bloc_vcast_null(HashMap);
+  }
+
   Complex * complex()
   {
     if (_type != Type::COMPLEX || _type.level())
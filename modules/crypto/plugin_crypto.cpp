@@ -221,34 +221,35 @@ void CRYPTOPlugin::destroyObject(void * object)
   delete h;
 }
 
-bloc::Value * CRYPTOPlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * CRYPTOPlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  crypto::Handle * h = static_cast<crypto::Handle*>(object_this.instance());
+  crypto::Handle * h = static_cast<crypto::Handle*>(object_this.complex()->instance());
   switch (method_id)
   {
   case crypto::MD5Hash1:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     bloc::TabChar * buf = new bloc::TabChar();
     h->MD5_hash(*buf, a0.literal()->c_str(), a0.literal()->size());
-    return new bloc::Value(buf);
+    return &(ret = bloc::Value(buf));
   }
 
   case crypto::MD5Hash2:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     bloc::TabChar * buf = new bloc::TabChar();
     h->MD5_hash(*buf, a0.tabchar()->data(), a0.tabchar()->size());
-    return new bloc::Value(buf);
+    return &(ret = bloc::Value(buf));
   }
 
   case crypto::SetKey1:
@@ -259,7 +260,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     bloc::TabChar * tmp = new bloc::TabChar();
     h->keyFromString(*tmp, a0.literal()->c_str(), a0.literal()->size());
     if (h->setKey(*tmp))
-      return new bloc::Value(tmp);
+      return &(ret = bloc::Value(tmp));
     delete tmp;
     throw RuntimeError(EXC_RT_OTHER_S, "The given value is not acceptable for"
             " this encryption algorithm.");
@@ -271,7 +272,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (h->setKey(*a0.tabchar()))
-      return new bloc::Value(bloc::Bool(true));
+      return &(ret = bloc::Value(bloc::Bool(true)));
     throw RuntimeError(EXC_RT_OTHER_S, "The given value is not acceptable for"
             " this encryption algorithm.");
   }
@@ -281,7 +282,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     // generate new IV
     bloc::TabChar * tmp = new bloc::TabChar();
     h->generateIV(*tmp, ctx.random(1.0));
-    return new bloc::Value(tmp);
+    return &(ret = bloc::Value(tmp));
   }
 
   default:
@@ -296,7 +297,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     // generate new IV
     bloc::TabChar * tmp = new bloc::TabChar();
     h->generateIV(*tmp, ctx.random(1.0));
@@ -306,7 +307,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     {
       h->CBC_encrypt(buf);
       tmp->insert(tmp->end(), buf.begin(), buf.end());
-      return new bloc::Value(tmp);
+      return &(ret = bloc::Value(tmp));
     }
     delete tmp;
     break;
@@ -316,7 +317,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     // generate new IV
     bloc::TabChar * tmp = new bloc::TabChar();
     h->generateIV(*tmp, ctx.random(1.0));
@@ -326,7 +327,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     {
       h->CBC_encrypt(buf);
       tmp->insert(tmp->end(), buf.begin(), buf.end());
-      return new bloc::Value(tmp);
+      return &(ret = bloc::Value(tmp));
     }
     delete tmp;
     break;
@@ -336,7 +337,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     if (a0.tabchar()->size() > AES_BLOCKLEN)
     {
       // fetch IV
@@ -344,7 +345,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
       // fetch cipher
       bloc::TabChar * buf = new bloc::TabChar(a0.tabchar()->begin() + AES_BLOCKLEN, a0.tabchar()->end());
       if (h->CBC_start(tmp) && h->CBC_decrypt(*buf))
-        return new bloc::Value(buf);
+        return &(ret = bloc::Value(buf));
       delete buf;
     }
     break;
@@ -356,7 +357,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     if (a0.isNull() || a0.tabchar()->size() != AES_BLOCKLEN)
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (h->CBC_start(*a0.tabchar()))
-      return new bloc::Value(bloc::Bool(true));
+      return &(ret = bloc::Value(bloc::Bool(true)));
     break;
   }
 
@@ -364,20 +365,20 @@ bloc::Value * CRYPTOPlugin::executeMethod(
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     bloc::TabChar * buf = new bloc::TabChar(a0.literal()->begin(), a0.literal()->end());
     h->CBC_encrypt_chunk(*buf);
-    return new bloc::Value(buf);
+    return &(ret = bloc::Value(buf));
   }
 
   case crypto::CBCEnc2:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     bloc::TabChar * buf = new bloc::TabChar(*a0.tabchar());
     h->CBC_encrypt_chunk(*buf);
-    return new bloc::Value(buf);
+    return &(ret = bloc::Value(buf));
   }
 
   case crypto::CBCEndEnc1:
@@ -389,7 +390,7 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     else
       buf = new bloc::TabChar(a0.literal()->begin(), a0.literal()->end());
     h->CBC_end_encrypt(*buf);
-    return new bloc::Value(buf);
+    return &(ret = bloc::Value(buf));
   }
 
   case crypto::CBCEndEnc2:
@@ -401,27 +402,27 @@ bloc::Value * CRYPTOPlugin::executeMethod(
     else
       buf = new bloc::TabChar(*a0.tabchar());
     h->CBC_end_encrypt(*buf);
-    return new bloc::Value(buf);
+    return &(ret = bloc::Value(buf));
   }
 
   case crypto::CBCDec1:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     bloc::TabChar * buf = new bloc::TabChar(*a0.tabchar());
     h->CBC_decrypt_chunk(*buf);
-    return new bloc::Value(buf);
+    return &(ret = bloc::Value(buf));
   }
 
   case crypto::CBCEndDec:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_tabchar);
+      return &(ret = bloc::Value(bloc::Value::type_tabchar));
     bloc::TabChar * buf = new bloc::TabChar(*a0.tabchar());
     if (h->CBC_end_decrypt(*buf))
-      return new bloc::Value(buf);
+      return &(ret = bloc::Value(buf));
     delete buf;
     break;
   }
@@ -18,6 +18,45 @@
 
 #include "csvparser.h"
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CSV_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+static inline unsigned csv_ctz(unsigned x) { unsigned long r; _BitScanForward(&r, x); return r; }
+#else
+static inline unsigned csv_ctz(unsigned x) { return __builtin_ctz(x); }
+#endif
+#endif
+
+/**
+ * Returns the position of the first byte matching one of the given
+ * characters, or end. It processes 16 bytes per step when SSE2 is available.
+ */
+static inline const char * find_first_of3(const char * p, const char * end, char c1, char c2, char c3)
+{
+#if defined(CSV_SSE2)
+  const __m128i v1 = _mm_set1_epi8(c1);
+  const __m128i v2 = _mm_set1_epi8(c2);
+  const __m128i v3 = _mm_set1_epi8(c3);
+  while (end - p >= 16)
+  {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(b, v1), _mm_cmpeq_epi8(b, v2)),
+                             _mm_cmpeq_epi8(b, v3));
+    unsigned mask = (unsigned) _mm_movemask_epi8(m);
+    if (mask)
+      return p + csv_ctz(mask);
+    p += 16;
+  }
+#endif
+  while (p < end && *p != c1 && *p != c2 && *p != c3)
+    ++p;
+  return p;
+}
+
 CSVParser::CSVParser(const char separator, const char encapsulator)
 : m_separator(separator)
 , m_encapsulator(encapsulator)
@@ -157,3 +196,115 @@ void CSVParser::serialize(std::string& out, const container& row)
     first = false;
   }
 }
+
+CSVParser::scan_status CSVParser::scan(const char * begin, const char * end, bool final,
+                                       record_view& out, const char ** next)
+{
+  const char * p = begin;
+  out.clear();
+  m_error = false;
+  /* skip blank lines */
+  while (p < end && (*p == '\n' || *p == '\r'))
+    ++p;
+  *next = p;
+  if (p == end)
+    return (final ? SCAN_END : SCAN_MORE);
+  const char * rec = p;
+  for (;;)
+  {
+    field_view field = { p, 0, false, false };
+    const char * q = p;
+    while (q < end && *q == 0x20)
+      ++q;
+    if (q < end && *q == m_encapsulator)
+    {
+      /* encapsulated data can contain any character */
+      const char * r = ++q;
+      for (;;)
+      {
+        r = static_cast<const char*>(::memchr(r, m_encapsulator, end - r));
+        if (r == nullptr || (r + 1 == end && !final))
+        {
+          if (!final)
+            return SCAN_MORE;
+          /* unexpected end of stream */
+          m_error = true;
+          m_error_pos = (unsigned) (end - rec);
+          *next = end;
+          return SCAN_ERROR;
+        }
+        if (r + 1 < end && r[1] == m_encapsulator)
+        {
+          field.escaped = true;
+          r += 2;
+          continue;
+        }
+        break;
+      }
+      field.data = q;
+      field.size = r - q;
+      field.quoted = true;
+      /* ignore trailing characters */
+      p = r + 1;
+      while (p < end && *p != m_separator && *p != '\n')
+        ++p;
+    }
+    else
+    {
+      const char * r = find_first_of3(p, end, m_separator, m_encapsulator, '\n');
+      if (r < end && *r == m_encapsulator)
+      {
+        /* invalid character in stream: skip the line */
+        const char * eol = static_cast<const char*>(::memchr(r, '\n', end - r));
+        if (eol == nullptr && !final)
+          return SCAN_MORE;
+        m_error = true;
+        m_error_pos = (unsigned) (r - rec);
+        *next = (eol ? eol + 1 : end);
+        return SCAN_ERROR;
+      }
+      if (r == end && !final)
+        return SCAN_MORE;
+      field.size = r - p;
+      if ((r == end || *r == '\n') && field.size > 0 && p[field.size - 1] == '\r')
+        --field.size;
+      p = r;
+    }
+    out.push_back(field);
+    if (p == end)
+    {
+      if (!final)
+        return SCAN_MORE;
+      *next = end;
+      return SCAN_OK;
+    }
+    if (*p == '\n')
+    {
+      *next = p + 1;
+      return SCAN_OK;
+    }
+    /* separator */
+    ++p;
+  }
+}
+
+void CSVParser::unescape(std::string& out, const field_view& field) const
+{
+  out.clear();
+  if (!field.escaped)
+  {
+    out.assign(field.data, field.size);
+    return;
+  }
+  out.reserve(field.size);
+  const char * p = field.data;
+  const char * end = field.data + field.size;
+  while (p < end)
+  {
+    out.push_back(*p);
+    /* a doubled encapsulator stands for one */
+    if (*p == m_encapsulator)
+      ++p;
+    ++p;
+  }
+}
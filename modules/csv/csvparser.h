@@ -37,6 +37,42 @@ public:
 
   void serialize(std::string& out, const container& row);
 
+  /**
+   * A field of record, pointing into the scanned buffer. When the field is
+   * escaped, it contains doubled encapsulators to be unescaped.
+   */
+  struct field_view
+  {
+    const char * data;
+    size_t size;
+    bool quoted;
+    bool escaped;
+  };
+  typedef std::vector<field_view> record_view;
+
+  enum scan_status
+  {
+    SCAN_OK     = 0,  /* a record has been scanned */
+    SCAN_MORE   = 1,  /* the record is truncated, more data is required */
+    SCAN_ERROR  = 2,  /* the record is malformed, and it has been skipped */
+    SCAN_END    = 3,  /* no more record */
+  };
+
+  /**
+   * Scan the next record from the buffer, without copy. Blank lines are
+   * skipped. On return, next points to the start of the following record.
+   * @param begin       the start of data
+   * @param end         the end of data
+   * @param final       true if no data follows the end
+   * @param out         the fields of the record
+   * @param next        the start of the following record
+   * @return            the status
+   */
+  scan_status scan(const char * begin, const char * end, bool final,
+                   record_view& out, const char ** next);
+
+  void unescape(std::string& out, const field_view& field) const;
+
 private:
   char m_separator;
   char m_encapsulator;
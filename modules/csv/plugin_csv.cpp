@@ -21,6 +21,18 @@
 #include <blocc/collection.h>
 #include <blocc/tuple.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+
+#ifdef _MSC_VER
+#define strncasecmp _strnicmp
+#endif
+
+#define CSV_LOAD_BUFSZ    0x100000
+#define CSV_MAX_ERRORS    1000
+
 /*
  * Create the module CSVImport
  */
@@ -66,6 +78,7 @@ enum Method
 {
   Serialize0 = 0, SerializeB, SerializeN, SerializeL,
   Deserialize, Deserialize_next, In_error, Error_pos,
+  Load, Loadfile, Load_errors,
 };
 
 /**********************************************************************/
@@ -98,6 +111,18 @@ static PLUGIN_ARG deserialize_next_args[]  = {
   { PLUGIN_INOUT, { "L", 1 } }, // table of fields
 };
 
+static PLUGIN_ARG load_args[]  = {
+  { PLUGIN_INOUT, { "R", 1 } }, // table of records
+  { PLUGIN_IN,    { "L", 0 } }, // the data
+  { PLUGIN_IN,    { "I", 0 } }, // number of records to skip
+};
+
+static PLUGIN_ARG loadfile_args[]  = {
+  { PLUGIN_INOUT, { "R", 1 } }, // table of records
+  { PLUGIN_IN,    { "L", 0 } }, // the file path
+  { PLUGIN_IN,    { "I", 0 } }, // number of records to skip
+};
+
 /**********************************************************************/
 /*  Methods list                                                      */
 /*  id:       name:         ret: decl,ndim  args_count,args:          */
@@ -124,6 +149,18 @@ static PLUGIN_METHOD methods[] =
           "Returns TRUE if an error occurred during the last deserialization." },
   { Error_pos,     "error_pos",       { "I", 0 },     0, nullptr,
           "Returns the position of the code point in error." },
+  { Load,           "load",           { "I", 0 },     3, load_args,
+          "Deserialize all records of the data, and append them to the table.\n"
+  "The fields are converted according to the declaration of the table, which\n"
+  "supports the types boolean, integer, decimal and string. The first records\n"
+  "given by the third argument are skipped. Records in error are not loaded,\n"
+  "see load_errors(). It returns the number of records loaded." },
+  { Loadfile,       "loadfile",       { "I", 0 },     3, loadfile_args,
+          "Deserialize all records of the file, and append them to the table.\n"
+  "See load()." },
+  { Load_errors,    "load_errors",    { "IIL", 1 },   0, nullptr,
+          "Returns the records in error during the last load:\n"
+  "[{ Record number, Field number or 0, Message }]" },
 };
 
 /**
@@ -132,8 +169,23 @@ static PLUGIN_METHOD methods[] =
 struct Handle {
   CSVParser _parser;
 
+  /* bulk load */
+  struct LoadError
+  {
+    unsigned record;
+    unsigned field;
+    std::string message;
+  };
+  CSVParser::record_view _fields;
+  std::vector<LoadError> _errors;
+  unsigned _record = 0;
+
   ~Handle() { }
   Handle(char s, char e) : _parser(s, e) { }
+  void load_begin();
+  const char * load(bloc::Collection& tab, const char * begin, const char * end,
+                    bool final, unsigned skip, bloc::Integer& count);
+  void load_error(unsigned field, const std::string& message);
   bool serialize(std::string& out, const CSVParser::container& data);
   bool deserialize(CSVParser::container& out, const std::string& line);
   bool deserialize_next(CSVParser::container& out, const std::string& line);
@@ -205,21 +257,22 @@ void CSVPlugin::destroyObject(void * object)
   delete csv;
 }
 
-bloc::Value * CSVPlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * CSVPlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  csv::Handle * csv = static_cast<csv::Handle*>(object_this.instance());
+  csv::Handle * csv = static_cast<csv::Handle*>(object_this.complex()->instance());
   switch (method_id)
   {
   case csv::SerializeL:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(static_cast<bloc::Literal*>(nullptr));
+      return &(ret = bloc::Value(static_cast<bloc::Literal*>(nullptr)));
     bloc::Collection& c = *a0.collection();
     std::vector<std::string> data;
     for (bloc::Value& v : c)
@@ -229,16 +282,16 @@ bloc::Value * CSVPlugin::executeMethod(
       else
         data.push_back(*v.literal());
     }
-    std::string * out = new std::string();
-    csv->serialize(*out, data);
-    return new bloc::Value(out);
+    std::string out;
+    csv->serialize(out, data);
+    return &(ret = bloc::Value(std::move(out)));
   }
 
   case csv::SerializeB:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(static_cast<bloc::Literal*>(nullptr));
+      return &(ret = bloc::Value(static_cast<bloc::Literal*>(nullptr)));
     bloc::Collection& c = *a0.collection();
     std::vector<std::string> data;
     for (bloc::Value& v : c)
@@ -248,16 +301,16 @@ bloc::Value * CSVPlugin::executeMethod(
       else
         data.push_back(bloc::Value::readableBoolean(*v.boolean()));
     }
-    std::string * out = new std::string();
-    csv->serialize(*out, data);
-    return new bloc::Value(out);
+    std::string out;
+    csv->serialize(out, data);
+    return &(ret = bloc::Value(std::move(out)));
   }
 
   case csv::SerializeN:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(static_cast<bloc::Literal*>(nullptr));
+      return &(ret = bloc::Value(static_cast<bloc::Literal*>(nullptr)));
     bloc::Collection& c = *a0.collection();
     const bloc::Type& exp_type = c.table_type();
     std::vector<std::string> data;
@@ -272,16 +325,16 @@ bloc::Value * CSVPlugin::executeMethod(
       else
         throw RuntimeError(EXC_RT_NOT_NUMERIC);
     }
-    std::string * out = new std::string();
-    csv->serialize(*out, data);
-    return new bloc::Value(out);
+    std::string out;
+    csv->serialize(out, data);
+    return &(ret = bloc::Value(std::move(out)));
   }
 
   case csv::Serialize0:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(static_cast<bloc::Literal*>(nullptr));
+      return &(ret = bloc::Value(static_cast<bloc::Literal*>(nullptr)));
     bloc::Tuple& t = *a0.tuple();
     std::vector<std::string> data;
     for (bloc::Value& v : t)
@@ -319,9 +372,9 @@ bloc::Value * CSVPlugin::executeMethod(
         }
       }
     }
-    std::string * out = new std::string();
-    csv->serialize(*out, data);
-    return new bloc::Value(out);
+    std::string out;
+    csv->serialize(out, data);
+    return &(ret = bloc::Value(std::move(out)));
   }
 
   case csv::Deserialize:
@@ -336,9 +389,9 @@ bloc::Value * CSVPlugin::executeMethod(
     bloc::Value v = bloc::Value(new bloc::Collection(bloc::Type(bloc::Type::LITERAL).levelUp()));
     bloc::Collection * c = v.collection();
     for (std::string& f : data)
-      c->push_back(bloc::Value(new bloc::Literal(f)));
+      c->push_back(bloc::Value(bloc::Literal(f)));
     ctx.storeVariable(args[1]->symbolId(), std::move(v));
-    return new bloc::Value(bloc::Bool(next));
+    return &(ret = bloc::Value(bloc::Bool(next)));
   }
 
   case csv::Deserialize_next:
@@ -347,7 +400,7 @@ bloc::Value * CSVPlugin::executeMethod(
     bloc::Value& a1 = args[1]->value(ctx);
     if (a0.isNull() || !args[1]->isVarName() || a1.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    bloc::Collection& c = *a1.collection();
+    bloc::Collection& c = *a1.detach().collection();
     std::vector<std::string> data;
     if (c.begin() != c.end())
     {
@@ -359,15 +412,98 @@ bloc::Value * CSVPlugin::executeMethod(
     }
     bool next = csv->deserialize_next(data, *a0.literal());
     for (std::string& f : data)
-      c.push_back(bloc::Value(new bloc::Literal(f)));
-    return new bloc::Value(bloc::Bool(next));
+      c.push_back(bloc::Value(bloc::Literal(f)));
+    return &(ret = bloc::Value(bloc::Bool(next)));
+  }
+
+  case csv::Load:
+  case csv::Loadfile:
+  {
+    bloc::Value& a1 = args[1]->value(ctx);
+    bloc::Value& a2 = args[2]->value(ctx);
+    if (!args[0]->isVarName() || a1.isNull() || a2.isNull() || *a2.integer() < 0)
+      throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+    /* INOUT: the table must be declared */
+    bloc::Value& a0 = ctx.loadVariable(args[0]->symbolId()).deref_value();
+    if (a0.isNull() || a0.collection()->table_decl().empty())
+      throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+    bloc::Collection& c = *a0.detach().collection();
+    for (const bloc::Type& t : c.table_decl())
+    {
+      if (t != bloc::Type::BOOLEAN && t != bloc::Type::INTEGER &&
+              t != bloc::Type::NUMERIC && t != bloc::Type::LITERAL)
+        throw RuntimeError(EXC_RT_OTHER_S, "Unsupported type of field.");
+    }
+    unsigned skip = (unsigned) *a2.integer();
+    bloc::Integer count = 0;
+    csv->load_begin();
+    if (method_id == csv::Load)
+    {
+      const std::string& data = *a1.literal();
+      csv->load(c, data.data(), data.data() + data.size(), true, skip, count);
+      return &(ret = bloc::Value(count));
+    }
+    FILE * file = ::fopen(a1.literal()->c_str(), "rb");
+    if (!file)
+      throw RuntimeError(EXC_RT_OTHER_S, "Failed to open file.");
+    /* process the file by chunk, the remaining of a truncated record is
+     * moved to the front of the buffer before reading more */
+    size_t size = CSV_LOAD_BUFSZ;
+    char * buf = new char[size];
+    size_t len = 0;
+    try
+    {
+      bool final = false;
+      while (!final)
+      {
+        if (len == size)
+        {
+          char * tmp = new char[size * 2];
+          ::memcpy(tmp, buf, len);
+          delete [] buf;
+          buf = tmp;
+          size *= 2;
+        }
+        size_t n = ::fread(buf + len, 1, size - len, file);
+        if (n == 0 && ::ferror(file))
+          throw RuntimeError(EXC_RT_OTHER_S, ::strerror(errno));
+        final = (n == 0);
+        len += n;
+        const char * next = csv->load(c, buf, buf + len, final, skip, count);
+        len -= (next - buf);
+        ::memmove(buf, next, len);
+      }
+    }
+    catch (...)
+    {
+      delete [] buf;
+      ::fclose(file);
+      throw;
+    }
+    delete [] buf;
+    ::fclose(file);
+    return &(ret = bloc::Value(count));
+  }
+
+  case csv::Load_errors:
+  {
+    bloc::Collection * c = new bloc::Collection(bloc::plugin::make_decl("IIL", 0), 1);
+    for (const csv::Handle::LoadError& e : csv->_errors)
+    {
+      bloc::Tuple::container_t row;
+      row.push_back(bloc::Value(bloc::Integer(e.record)));
+      row.push_back(bloc::Value(bloc::Integer(e.field)));
+      row.push_back(bloc::Value(bloc::Literal(e.message)));
+      c->push_back(bloc::Value(new bloc::Tuple(std::move(row))));
+    }
+    return &(ret = bloc::Value(c));
   }
 
   case csv::In_error:
-    return new bloc::Value(bloc::Bool(csv->in_error()));
+    return &(ret = bloc::Value(bloc::Bool(csv->in_error())));
 
   case csv::Error_pos:
-    return new bloc::Value(bloc::Integer(csv->error_position()));
+    return &(ret = bloc::Value(bloc::Integer(csv->error_position())));
 
   default:
     break;
@@ -391,5 +527,181 @@ bool csv::Handle::deserialize_next(CSVParser::container& out, const std::string&
   return _parser.deserialize_next(out, line);
 }
 
+/**
+ * Parse a boolean from the field: TRUE, FALSE, 1 or 0 regardless of case.
+ */
+static bool _parse_boolean(const char * p, const char * end, bloc::Bool * v)
+{
+  while (p < end && *p == 0x20) ++p;
+  while (end > p && *(end - 1) == 0x20) --end;
+  size_t n = end - p;
+  if ((n == 4 && ::strncasecmp(p, "true", 4) == 0) || (n == 1 && *p == '1'))
+    *v = true;
+  else if ((n == 5 && ::strncasecmp(p, "false", 5) == 0) || (n == 1 && *p == '0'))
+    *v = false;
+  else
+    return false;
+  return true;
+}
+
+/**
+ * Parse a decimal integer from the field, in place.
+ */
+static bool _parse_integer(const char * p, const char * end, bloc::Integer * v)
+{
+  while (p < end && *p == 0x20) ++p;
+  while (end > p && *(end - 1) == 0x20) --end;
+  bool neg = false;
+  if (p < end && (*p == '-' || *p == '+'))
+    neg = (*p++ == '-');
+  if (p == end)
+    return false;
+  uint64_t u = 0;
+  const uint64_t max = (neg ? (uint64_t) INT64_MAX + 1 : (uint64_t) INT64_MAX);
+  for (; p < end; ++p)
+  {
+    unsigned d = (unsigned) (*p - '0');
+    if (d > 9 || u > (max - d) / 10)
+      return false;
+    u = u * 10 + d;
+  }
+  *v = (neg ? (bloc::Integer) (0 - u) : (bloc::Integer) u);
+  return true;
+}
+
+/**
+ * Parse a decimal number from the field. The field is copied on the stack
+ * to be terminated.
+ */
+static bool _parse_numeric(const char * p, const char * end, bloc::Numeric * v)
+{
+  while (p < end && *p == 0x20) ++p;
+  while (end > p && *(end - 1) == 0x20) --end;
+  char buf[64];
+  size_t n = end - p;
+  if (n == 0 || n >= sizeof(buf))
+    return false;
+  ::memcpy(buf, p, n);
+  buf[n] = '\0';
+  char * e;
+  *v = ::strtod(buf, &e);
+  return (e == buf + n);
+}
+
+void csv::Handle::load_begin()
+{
+  _errors.clear();
+  _record = 0;
+}
+
+void csv::Handle::load_error(unsigned field, const std::string& message)
+{
+  if (_errors.size() < CSV_MAX_ERRORS)
+    _errors.push_back({ _record, field, message });
+}
+
+const char * csv::Handle::load(bloc::Collection& tab, const char * begin, const char * end,
+                               bool final, unsigned skip, bloc::Integer& count)
+{
+  const bloc::TupleDecl::Decl& decl = tab.table_decl();
+  /* an empty table of scalar fields is filled by column */
+  if (tab.size() == 0)
+    tab.make_columnar();
+  bloc::Tuple::container_t row;
+  const char * p = begin;
+  for (;;)
+  {
+    const char * next;
+    CSVParser::scan_status st = _parser.scan(p, end, final, _fields, &next);
+    if (st == CSVParser::SCAN_MORE || st == CSVParser::SCAN_END)
+      break;
+    p = next;
+    ++_record;
+    if (_record <= skip)
+      continue;
+    if (st == CSVParser::SCAN_ERROR)
+    {
+      load_error(0, std::string("Invalid character at position ")
+                 .append(std::to_string(_parser.error_position())));
+      continue;
+    }
+    if (_fields.size() != decl.size())
+    {
+      load_error(0, std::string("Invalid number of fields: ")
+                 .append(std::to_string(_fields.size())));
+      continue;
+    }
+    /* convert the fields in place */
+    row.clear();
+    row.reserve(decl.size());
+    unsigned f = 0;
+    for (; f < decl.size(); ++f)
+    {
+      const CSVParser::field_view& field = _fields[f];
+      const char * b = field.data;
+      const char * e = field.data + field.size;
+      bool null = (field.size == 0 && (!field.quoted || decl[f] != bloc::Type::LITERAL));
+      switch (decl[f].major())
+      {
+      case bloc::Type::BOOLEAN:
+      {
+        bloc::Bool v;
+        if (null)
+          row.push_back(bloc::Value(bloc::Value::type_boolean));
+        else if (_parse_boolean(b, e, &v))
+          row.push_back(bloc::Value(v));
+        else
+          break;
+        continue;
+      }
+      case bloc::Type::INTEGER:
+      {
+        bloc::Integer v;
+        if (null)
+          row.push_back(bloc::Value(bloc::Value::type_integer));
+        else if (_parse_integer(b, e, &v))
+          row.push_back(bloc::Value(v));
+        else
+          break;
+        continue;
+      }
+      case bloc::Type::NUMERIC:
+      {
+        bloc::Numeric v;
+        if (null)
+          row.push_back(bloc::Value(bloc::Value::type_numeric));
+        else if (_parse_numeric(b, e, &v))
+          row.push_back(bloc::Value(v));
+        else
+          break;
+        continue;
+      }
+      default:
+      {
+        if (null)
+          row.push_back(bloc::Value(bloc::Value::type_literal));
+        else
+        {
+          bloc::Literal v;
+          _parser.unescape(v, field);
+          row.push_back(bloc::Value(std::move(v)));
+        }
+        continue;
+      }
+      }
+      /* conversion failed */
+      break;
+    }
+    if (f < decl.size())
+    {
+      load_error(f + 1, std::string("Invalid value for type ").append(decl[f].typeName()));
+      continue;
+    }
+    tab.push_row(row);
+    ++count;
+  }
+  return p;
+}
+
 } /* namespace import */
 } /* namespace bloc */
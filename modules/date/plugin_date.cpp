@@ -292,14 +292,15 @@ void DatePlugin::destroyObject(void * object)
   delete dd;
 }
 
-bloc::Value * DatePlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * DatePlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  date::Handle * dd = static_cast<date::Handle*>(object_this.instance());
+  date::Handle * dd = static_cast<date::Handle*>(object_this.complex()->instance());
   switch (method_id)
   {
   case date::Format:
@@ -309,19 +310,19 @@ bloc::Value * DatePlugin::executeMethod(
      if (a0.isNull())
        throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
      size_t n = strftime(buf, 64, a0.literal()->c_str(), &dd->_tm);
-     return new bloc::Value(new bloc::Literal(buf, n));
+     return &(ret = bloc::Value(bloc::Literal(buf, n)));
   }
 
   case date::Unixtime:
   {
-    return new Value(Integer(dd->unixtime()));
+    return &(ret = Value(Integer(dd->unixtime())));
   }
 
   case date::Iso8601:
   {
      char buf[64];
      size_t n = strftime(buf, 64, "%Y-%m-%dT%H:%M:%S", &dd->_tm);
-     return new bloc::Value(new bloc::Literal(buf, n));
+     return &(ret = bloc::Value(bloc::Literal(buf, n)));
   }
 
   case date::Iso8601utc:
@@ -331,14 +332,14 @@ bloc::Value * DatePlugin::executeMethod(
      time_t tt = mktime(&dd->_tm);
      gmtime_r(&tt, &_tm);
      size_t n = strftime(buf, 64, "%Y-%m-%dT%H:%M:%SZ", &_tm);
-     return new bloc::Value(new bloc::Literal(buf, n));
+     return &(ret = bloc::Value(bloc::Literal(buf, n)));
   }
 
   case date::Isodate:
   {
      char buf[64];
      size_t n = strftime(buf, 64, "%Y-%m-%d", &dd->_tm);
-     return new bloc::Value(new bloc::Literal(buf, n));
+     return &(ret = bloc::Value(bloc::Literal(buf, n)));
   }
 
   case date::Difftime:
@@ -349,7 +350,7 @@ bloc::Value * DatePlugin::executeMethod(
     date::Handle * dd0 = static_cast<date::Handle*>(a0.complex()->instance());
     if (dd0 == nullptr)
       throw RuntimeError(EXC_RT_MEMB_ARG_TYPE_S, date::methods[date::Difftime].name);
-    return new bloc::Value(bloc::Numeric(difftime(dd->unixtime(), dd0->unixtime())));
+    return &(ret = bloc::Value(bloc::Numeric(difftime(dd->unixtime(), dd0->unixtime()))));
   }
 
   case date::Add:
@@ -376,7 +377,7 @@ bloc::Value * DatePlugin::executeMethod(
     if (tt == INVALID_TIME)
       throw RuntimeError(EXC_RT_OTHER_S, "The system does not support this date range.");
     dd->_tm = _tm;
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
   }
 
   case date::Add_unit:
@@ -418,7 +419,7 @@ bloc::Value * DatePlugin::executeMethod(
     if (tt == INVALID_TIME)
       throw RuntimeError(EXC_RT_OTHER_S, "The system does not support this date range.");
     dd->_tm = _tm;
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
   }
 
   case date::Trunc:
@@ -429,7 +430,7 @@ bloc::Value * DatePlugin::executeMethod(
     dd->_tm.tm_min = 0;
     dd->_tm.tm_hour = 0;
     mktime(&dd->_tm);
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
   }
 
   case date::Trunc_unit:
@@ -463,27 +464,27 @@ bloc::Value * DatePlugin::executeMethod(
       dd->_tm.tm_mon = 0; /* first month of the yeay */
 
     mktime(&dd->_tm);
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
   }
 
   case date::Second:
-    return new bloc::Value(Integer(dd->_tm.tm_sec));
+    return &(ret = bloc::Value(Integer(dd->_tm.tm_sec)));
   case date::Minute:
-    return new bloc::Value(Integer(dd->_tm.tm_min));
+    return &(ret = bloc::Value(Integer(dd->_tm.tm_min)));
   case date::Hour:
-    return new bloc::Value(Integer(dd->_tm.tm_hour));
+    return &(ret = bloc::Value(Integer(dd->_tm.tm_hour)));
   case date::Day:
-    return new bloc::Value(Integer(dd->_tm.tm_mday));
+    return &(ret = bloc::Value(Integer(dd->_tm.tm_mday)));
   case date::Month:
-    return new bloc::Value(Integer(dd->_tm.tm_mon + 1));
+    return &(ret = bloc::Value(Integer(dd->_tm.tm_mon + 1)));
   case date::Year:
-    return new bloc::Value(Integer(dd->_tm.tm_year + 1900));
+    return &(ret = bloc::Value(Integer(dd->_tm.tm_year + 1900)));
   case date::Weekday:
     /* the int value follows the ISO-8601 standard, from 1 (monday) to 7 (sunday) */
-    return new bloc::Value(Integer((dd->_tm.tm_wday == 0 ? 7 : dd->_tm.tm_wday)));
+    return &(ret = bloc::Value(Integer((dd->_tm.tm_wday == 0 ? 7 : dd->_tm.tm_wday))));
   case date::Yearday:
     /* [ 1 - 366 ] */
-    return new bloc::Value(Integer(dd->_tm.tm_yday + 1));
+    return &(ret = bloc::Value(Integer(dd->_tm.tm_yday + 1)));
 
   }
   return nullptr;
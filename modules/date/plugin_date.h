@@ -37,11 +37,12 @@ public:
 
   void destroyObject(void * object) override;
 
-  Value * executeMethod(
-          bloc::Complex& object_this,
+  Value * invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           ) override;
 };
 
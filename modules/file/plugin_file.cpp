@@ -33,6 +33,12 @@
 #include <limits.h>
 #endif
 #include <sys/stat.h>
+#if !defined(LIBBLOC_MSWIN)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <cstring>
+#include <algorithm>
 
 #if defined(LIBBLOC_MSWIN)
 #define FILE_SEPARATOR '\\'
@@ -44,6 +50,7 @@
 #endif
 
 #define BLOC_FILE_BUFSZ 4096
+#define BLOC_FILE_STREAM_BUFSZ 0x100000
 
 /*
  * Create the module FileImport
@@ -69,6 +76,11 @@ static PLUGIN_TYPE ctor_0_args[]  = {
   { "L", 0 }, // open flags
 };
 
+static PLUGIN_TYPE ctor_1_args[]  = {
+  { "L", 0 }, // filename
+  { "I", 0 }, // buffer size
+};
+
 static PLUGIN_CTOR ctors[] =
 {
   { 0,      2,  ctor_0_args,
@@ -80,6 +92,11 @@ static PLUGIN_CTOR ctors[] =
           "\nw+ or wb+  Truncate to zero length or create file for update"
           "\na+ or ab+  Append, open or create file for update, writing at end-of-file"
    },
+  { 1,      2,  ctor_1_args,
+          "Open file for the given filename, as a stream for reading, with an input"
+          "\nbuffer of the given size in bytes. A size of 0 maps a regular file in"
+          "\nmemory, otherwise a buffer of 1MB is used."
+   },
 };
 
 enum Method
@@ -87,7 +104,7 @@ enum Method
   Close = 0, Open, Write_S, Write_B, Read_S, Read_B, Readln, Flush,
   SeekSet, SeekCur, SeekEnd, Position, IsOpen, Mode, Filename,
   FDirname, FBasename, FStat,
-  Stat, Dir, Separator, Dirname, Basename,
+  Stat, Dir, Separator, Dirname, Basename, Readlines, ReadlinesSep,
 };
 
 /**********************************************************************/
@@ -125,6 +142,17 @@ static PLUGIN_ARG read_b_args[]   = {
   { PLUGIN_IN,    { "I", 0 } }, // read size
 };
 
+static PLUGIN_ARG readlines_args[] = {
+  { PLUGIN_INOUT, { "L", 1 } }, // lines read
+  { PLUGIN_IN,    { "I", 0 } }, // max count
+};
+
+static PLUGIN_ARG readlines_sep_args[] = {
+  { PLUGIN_INOUT, { "L", 1 } }, // records read
+  { PLUGIN_IN,    { "I", 0 } }, // max count
+  { PLUGIN_IN,    { "L", 0 } }, // separator
+};
+
 /**********************************************************************/
 /*  Methods list                                                      */
 /*  id:       name:         ret: decl,ndim  args_count,args:          */
@@ -151,6 +179,14 @@ static PLUGIN_METHOD methods[] =
   { Read_B,   "read",       { "I", 0 },     2, read_b_args,
           "Reads up to count bytes into the variable, and returns the number of byte"
           "\nread successfully." },
+  { Readlines, "readlines", { "I", 0 },     2, readlines_args,
+          "Reads up to count lines from the stream into the table, and returns the"
+          "\nnumber of line read. The storage of the table is reused, and LF is removed."
+          "\nAt EOF it returns 0, and the table is empty." },
+  { ReadlinesSep, "readlines", { "I", 0 },  3, readlines_sep_args,
+          "Reads up to count records from the stream into the table, and returns the"
+          "\nnumber of record read. Records are split on the given separator, which is"
+          "\nremoved. At EOF it returns 0, and the table is empty." },
   { SeekSet,  "seekset",    { "I", 0 },     1, int_args,
           "Moves the file position indicator to an absolute location in a file." },
   { SeekCur,  "seekcur",    { "I", 0 },     1, int_args,
@@ -204,10 +240,26 @@ struct Handle {
   bool _r = false;
   bool _w = false;
 
-  ~Handle() { if (_file) ::fclose(_file); }
+  /* streaming reader */
+  bool _stream = false;
+  char * _buf = nullptr;      /* the input buffer */
+  size_t _buf_size = 0;
+  char * _map = nullptr;      /* the mapped file */
+  size_t _map_size = 0;
+  const char * _data = nullptr; /* _buf or _map */
+  size_t _head = 0;           /* start of the next record */
+  size_t _tail = 0;           /* end of valid data */
+  size_t _scan = 0;           /* resume search of separator from here */
+  int64_t _offset = 0;        /* file position of _data[0] */
+  bool _eof = false;
+
+  ~Handle() { close(); }
   Handle() { }
   int open(const std::string& path, const std::string& flags);
+  int open_stream(const std::string& path, int64_t bufsize);
   int close();
+  bool next_record(const char * sep, size_t seplen, const char ** rec, size_t * len);
+  int seek_stream(int64_t s, int whence);
   size_t write(const char * buf, unsigned n);
   size_t read(char * buf, unsigned n);
   int seek_cur(int64_t s);
@@ -319,7 +371,7 @@ static int _dir(const std::string& path, bloc::Collection ** out)
       row.push_back(bloc::Value(bloc::Integer(fsize)));
     else
       row.push_back(bloc::Value(bloc::Value::type_integer));
-    row.push_back(bloc::Value(new bloc::Literal(dp->d_name)));
+    row.push_back(bloc::Value(bloc::Literal(dp->d_name)));
     if (fmode == 1 || fmode == 2)
       row.push_back(bloc::Value(bloc::Integer(ctime)));
     else
@@ -361,6 +413,17 @@ void * FilePlugin::createObject(int ctor_id, bloc::Context& ctx, const std::vect
       break;
     }
 
+    case 1: /* file( filename, buffer size ) */
+    {
+      bloc::Value& a0 = args[0]->value(ctx);
+      bloc::Value& a1 = args[1]->value(ctx);
+      if (a0.isNull() || a1.isNull() || *a1.integer() < 0)
+        throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+      if (file->open_stream(*a0.literal(), *a1.integer()) != 0)
+        throw RuntimeError(EXC_RT_OTHER_S, "Failed to open file.");
+      break;
+    }
+
     default: /* default ctor */
       break;
     }
@@ -379,18 +442,19 @@ void FilePlugin::destroyObject(void * object)
   delete file;
 }
 
-bloc::Value * FilePlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * FilePlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  file::Handle * file = static_cast<file::Handle*>(object_this.instance());
+  file::Handle * file = static_cast<file::Handle*>(object_this.complex()->instance());
   switch (method_id)
   {
   case file::Close:
-    return new Value(bloc::Bool(file->close() == 0 ? true : false));
+    return &(ret = Value(bloc::Bool(file->close() == 0 ? true : false)));
 
   case file::Open:
   {
@@ -398,7 +462,7 @@ bloc::Value * FilePlugin::executeMethod(
     bloc::Value& a1 = args[1]->value(ctx);
     if (a0.isNull() || a1.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Integer(file->open(*a0.literal(), *a1.literal())));
+    return &(ret = bloc::Value(bloc::Integer(file->open(*a0.literal(), *a1.literal()))));
   }
 
   case file::Write_S:
@@ -407,30 +471,32 @@ bloc::Value * FilePlugin::executeMethod(
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened for write operation.");
     bloc::Value& a0 = args[0]->value(ctx);
     if (!a0.isNull())
-      return new bloc::Value(bloc::Integer(file->write(a0.literal()->c_str(), a0.literal()->size())));
-    return new bloc::Value(bloc::Integer(0));
+      return &(ret = bloc::Value(bloc::Integer(file->write(a0.literal()->c_str(), a0.literal()->size()))));
+    return &(ret = bloc::Value(bloc::Integer(0)));
   }
 
   case file::Read_S:
   {
     if (!file->_r)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened for read operation.");
+    if (file->_stream)
+      throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file opened as stream, use readlines.");
     bloc::Value& a1 = args[1]->value(ctx);
     if (!args[0]->isVarName() || a1.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
 
-    bloc::Literal * str = new bloc::Literal();
+    bloc::Literal str;
     bloc::Integer r = 0;
     bloc::Integer l = *a1.integer();
     if (l > 0)
     {
       bloc::Integer n = l;
-      str->reserve(n);
+      str.reserve(n);
       char buf[BLOC_FILE_BUFSZ];
       while (n > 0)
       {
         size_t c = file->read(buf, (n > BLOC_FILE_BUFSZ ? BLOC_FILE_BUFSZ : n));
-        str->append(buf, c);
+        str.append(buf, c);
         r += c;
         if (c < BLOC_FILE_BUFSZ)
           break;
@@ -438,14 +504,16 @@ bloc::Value * FilePlugin::executeMethod(
       }
     }
     /* INOUT */
-    ctx.storeVariable(args[0]->symbolId(), bloc::Value(str));
-    return new bloc::Value(bloc::Integer(r));
+    ctx.storeVariable(args[0]->symbolId(), bloc::Value(std::move(str)));
+    return &(ret = bloc::Value(bloc::Integer(r)));
   }
 
   case file::Readln:
   {
     if (!file->_r)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened for read operation.");
+    if (file->_stream)
+      throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file opened as stream, use readlines.");
     if (!args[0]->isVarName())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
 
@@ -454,9 +522,72 @@ bloc::Value * FilePlugin::executeMethod(
     if (n >= 0)
     {
       /* INOUT */
-      ctx.storeVariable(args[0]->symbolId(), bloc::Value(new bloc::Literal(buf, n)));
+      ctx.storeVariable(args[0]->symbolId(), bloc::Value(bloc::Literal(buf, n)));
+    }
+    return &(ret = bloc::Value(bloc::Bool(n < 0 ? false : true)));
+  }
+
+  case file::Readlines:
+  case file::ReadlinesSep:
+  {
+    if (!file->_stream)
+      throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened as stream.");
+    bloc::Value& a1 = args[1]->value(ctx);
+    if (!args[0]->isVarName() || a1.isNull() || *a1.integer() <= 0)
+      throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+    const char * sep = "\n";
+    size_t seplen = 1;
+    if (method_id == file::ReadlinesSep)
+    {
+      bloc::Value& a2 = args[2]->value(ctx);
+      if (a2.isNull() || a2.literal()->empty())
+        throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+      sep = a2.literal()->c_str();
+      seplen = a2.literal()->size();
+    }
+
+    /* INOUT: reuse the storage of the bound table when possible */
+    const bloc::Type tab_type = bloc::Type(bloc::Type::LITERAL).levelUp();
+    bloc::Value& var = ctx.loadVariable(args[0]->symbolId()).deref_value();
+    bloc::Collection * tab = nullptr;
+    bool reuse = (var.type() == tab_type && !var.isNull());
+    if (reuse)
+      tab = var.detach().collection();
+    else
+      tab = new bloc::Collection(tab_type);
+
+    bloc::Integer max = *a1.integer();
+    bloc::Integer r = 0;
+    const char * rec;
+    size_t len;
+    try
+    {
+      while (r < max && file->next_record(sep, seplen, &rec, &len))
+      {
+        if (r < (bloc::Integer) tab->size())
+        {
+          bloc::Value& e = tab->at(r);
+          if (e.type() == bloc::Type::LITERAL && !e.isNull())
+            e.literal()->assign(rec, len);
+          else
+            e.swap(bloc::Value(bloc::Literal(rec, len)));
+        }
+        else
+          tab->push_back(bloc::Value(bloc::Literal(rec, len)));
+        ++r;
+      }
+    }
+    catch (...)
+    {
+      if (!reuse)
+        delete tab;
+      throw;
     }
-    return new bloc::Value(bloc::Bool(n < 0 ? false : true));
+    if (r < (bloc::Integer) tab->size())
+      tab->erase(tab->begin() + r, tab->end());
+    if (!reuse)
+      ctx.storeVariable(args[0]->symbolId(), bloc::Value(tab));
+    return &(ret = bloc::Value(bloc::Integer(r)));
   }
 
   case file::SeekSet:
@@ -466,7 +597,7 @@ bloc::Value * FilePlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Integer(file->seek_set(*a0.integer())));
+    return &(ret = bloc::Value(bloc::Integer(file->seek_set(*a0.integer()))));
   }
 
   case file::SeekCur:
@@ -476,7 +607,7 @@ bloc::Value * FilePlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Integer(file->seek_cur(*a0.integer())));
+    return &(ret = bloc::Value(bloc::Integer(file->seek_cur(*a0.integer()))));
   }
 
   case file::SeekEnd:
@@ -486,39 +617,39 @@ bloc::Value * FilePlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Integer(file->seek_end(*a0.integer())));
+    return &(ret = bloc::Value(bloc::Integer(file->seek_end(*a0.integer()))));
   }
 
   case file::Position:
     if (!file->_file)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened.");
-    return new bloc::Value(bloc::Integer(file->position()));
+    return &(ret = bloc::Value(bloc::Integer(file->position())));
 
   case file::Flush:
     if (!file->_file)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened.");
-    return new bloc::Value(bloc::Bool(file->flush() == 0 ? true : false));
+    return &(ret = bloc::Value(bloc::Bool(file->flush() == 0 ? true : false)));
 
   case file::Filename:
     if (!file->_file)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened.");
-    return new bloc::Value(new bloc::Literal(file->_path));
+    return &(ret = bloc::Value(bloc::Literal(file->_path)));
 
   case file::FDirname:
     if (!file->_file)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened.");
-    return new bloc::Value(new bloc::Literal(file::_dirName(file->_path)));
+    return &(ret = bloc::Value(bloc::Literal(file::_dirName(file->_path))));
 
   case file::FBasename:
     if (!file->_file)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened.");
-    return new bloc::Value(new bloc::Literal(file::_baseName(file->_path)));
+    return &(ret = bloc::Value(bloc::Literal(file::_baseName(file->_path))));
 
   case file::Mode:
-    return new bloc::Value(new bloc::Literal(file->_mode));
+    return &(ret = bloc::Value(bloc::Literal(file->_mode)));
 
   case file::IsOpen:
-    return new bloc::Value(bloc::Bool(file->_file ? true : false));
+    return &(ret = bloc::Value(bloc::Bool(file->_file ? true : false)));
 
   case file::Write_B:
   {
@@ -526,14 +657,16 @@ bloc::Value * FilePlugin::executeMethod(
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened for write operation.");
     bloc::Value& a0 = args[0]->value(ctx);
     if (!a0.isNull())
-      return new bloc::Value(bloc::Integer(file->write(a0.tabchar()->data(), a0.tabchar()->size())));
-    return new bloc::Value(bloc::Integer(0));
+      return &(ret = bloc::Value(bloc::Integer(file->write(a0.tabchar()->data(), a0.tabchar()->size()))));
+    return &(ret = bloc::Value(bloc::Integer(0)));
   }
 
   case file::Read_B:
   {
     if (!file->_r)
       throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file not opened for read operation.");
+    if (file->_stream)
+      throw bloc::RuntimeError(bloc::EXC_RT_OTHER_S, "file opened as stream, use readlines.");
     bloc::Value& a1 = args[1]->value(ctx);
     if (!args[0]->isVarName() || a1.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
@@ -558,7 +691,7 @@ bloc::Value * FilePlugin::executeMethod(
     }
     /* INOUT */
     ctx.storeVariable(args[0]->symbolId(), bloc::Value(raw));
-    return new bloc::Value(bloc::Integer(r));
+    return &(ret = bloc::Value(bloc::Integer(r)));
   }
 
   case file::FStat:
@@ -579,13 +712,13 @@ bloc::Value * FilePlugin::executeMethod(
       row[0].swap(bloc::Value(bloc::Integer(fmode)));
       if (fmode == 1)
         row[1].swap(bloc::Value(bloc::Integer(fsize)));
-      row[2].swap(bloc::Value(new bloc::Literal(file::_absolutePath(file->_path))));
+      row[2].swap(bloc::Value(bloc::Literal(file::_absolutePath(file->_path))));
       if (fmode == 1 || fmode == 2)
         row[3].swap(bloc::Value(bloc::Integer(ctime)));
     }
     else
       row[0].swap(bloc::Value(bloc::Integer(0)));
-    return new bloc::Value(new bloc::Tuple(std::move(row)));
+    return &(ret = bloc::Value(new bloc::Tuple(std::move(row))));
   }
 
   case file::Stat:
@@ -608,13 +741,13 @@ bloc::Value * FilePlugin::executeMethod(
       row[0].swap(bloc::Value(bloc::Integer(fmode)));
       if (fmode == 1)
         row[1].swap(bloc::Value(bloc::Integer(fsize)));
-      row[2].swap(bloc::Value(new bloc::Literal(file::_absolutePath(path))));
+      row[2].swap(bloc::Value(bloc::Literal(file::_absolutePath(path))));
       if (fmode == 1 || fmode == 2)
         row[3].swap(bloc::Value(bloc::Integer(ctime)));
     }
     else
       row[0].swap(bloc::Value(bloc::Integer(0)));
-    return new bloc::Value(new bloc::Tuple(std::move(row)));
+    return &(ret = bloc::Value(new bloc::Tuple(std::move(row))));
   }
 
   case file::Dir:
@@ -624,12 +757,12 @@ bloc::Value * FilePlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     Collection * c = nullptr;
     file::_dir(*a0.literal(), &c);
-    return new Value(c);
+    return &(ret = Value(c));
   }
 
   case file::Separator:
   {
-    return new Value(new bloc::Literal(1, FILE_SEPARATOR));
+    return &(ret = Value(bloc::Literal(1, FILE_SEPARATOR)));
   }
 
   case file::Dirname:
@@ -637,7 +770,7 @@ bloc::Value * FilePlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new Value(new bloc::Literal(file::_dirName(*a0.literal())));
+    return &(ret = Value(bloc::Literal(file::_dirName(*a0.literal()))));
   }
 
   case file::Basename:
@@ -645,7 +778,7 @@ bloc::Value * FilePlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new Value(new bloc::Literal(file::_baseName(*a0.literal())));
+    return &(ret = Value(bloc::Literal(file::_baseName(*a0.literal()))));
   }
 
   }
@@ -665,8 +798,61 @@ int file::Handle::open(const std::string& path, const std::string& mode)
   return 0;
 }
 
+int file::Handle::open_stream(const std::string& path, int64_t bufsize)
+{
+  int r = open(path, "rb");
+  if (r != 0)
+    return r;
+  _stream = true;
+#if !defined(LIBBLOC_MSWIN)
+  if (bufsize == 0)
+  {
+    /* map a regular file in memory */
+    struct stat buf;
+    int fd = ::fileno(_file);
+    if (::fstat(fd, &buf) == 0 && S_ISREG(buf.st_mode) && buf.st_size > 0)
+    {
+      void * map = ::mmap(nullptr, (size_t) buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map != MAP_FAILED)
+      {
+        ::madvise(map, (size_t) buf.st_size, MADV_SEQUENTIAL);
+        _map = static_cast<char*>(map);
+        _map_size = (size_t) buf.st_size;
+        _data = _map;
+        _tail = _map_size;
+        _eof = true;
+        return 0;
+      }
+    }
+  }
+#endif
+  /* fall back on the buffered input */
+  _buf_size = (bufsize < BLOC_FILE_BUFSZ ? (bufsize == 0 ? BLOC_FILE_STREAM_BUFSZ : BLOC_FILE_BUFSZ)
+                                         : (size_t) bufsize);
+  _buf = new char[_buf_size];
+  _data = _buf;
+  /* the stream buffer replaces the one of stdio */
+  ::setvbuf(_file, nullptr, _IONBF, 0);
+  return 0;
+}
+
 int file::Handle::close()
 {
+  if (_stream)
+  {
+#if !defined(LIBBLOC_MSWIN)
+    if (_map)
+      ::munmap(_map, _map_size);
+#endif
+    delete [] _buf;
+    _stream = false;
+    _buf = _map = nullptr;
+    _buf_size = _map_size = 0;
+    _data = nullptr;
+    _head = _tail = _scan = 0;
+    _offset = 0;
+    _eof = false;
+  }
   if (!_file)
     return 0;
   int r = ::fclose(_file);
@@ -690,6 +876,8 @@ size_t file::Handle::read(char * buf, unsigned n)
 
 int file::Handle::seek_cur(int64_t s)
 {
+  if (_stream)
+    return seek_stream(s, SEEK_CUR);
   if (::fseek(_file, s, SEEK_CUR) != 0)
     return errno;
   return 0;
@@ -697,6 +885,8 @@ int file::Handle::seek_cur(int64_t s)
 
 int file::Handle::seek_set(int64_t s)
 {
+  if (_stream)
+    return seek_stream(s, SEEK_SET);
   if (::fseek(_file, s, SEEK_SET) != 0)
     return errno;
   return 0;
@@ -704,6 +894,8 @@ int file::Handle::seek_set(int64_t s)
 
 int file::Handle::seek_end(int64_t s)
 {
+  if (_stream)
+    return seek_stream(s, SEEK_END);
   if (::fseek(_file, s, SEEK_END) != 0)
     return errno;
   return 0;
@@ -711,6 +903,8 @@ int file::Handle::seek_end(int64_t s)
 
 int64_t file::Handle::position()
 {
+  if (_stream)
+    return _offset + (int64_t) _head;
   return ::ftell(_file);
 }
 
@@ -737,5 +931,102 @@ int file::Handle::readln(char * buf, int n)
   return (c < 0 ? c : r);
 }
 
+bool file::Handle::next_record(const char * sep, size_t seplen, const char ** rec, size_t * len)
+{
+  for (;;)
+  {
+    /* search the separator in the pending data, records are not copied */
+    if (_scan < _head)
+      _scan = _head;
+    const char * b = _data + _scan;
+    const char * e = _data + _tail;
+    const char * p;
+    if (seplen == 1)
+      p = static_cast<const char*>(::memchr(b, *sep, e - b));
+    else
+    {
+      p = std::search(b, e, sep, sep + seplen);
+      if (p == e)
+        p = nullptr;
+    }
+    if (p)
+    {
+      *rec = _data + _head;
+      *len = p - *rec;
+      _head = _scan = (p - _data) + seplen;
+      return true;
+    }
+    if (_eof)
+    {
+      if (_head >= _tail)
+        return false;
+      /* the last record is not terminated */
+      *rec = _data + _head;
+      *len = _tail - _head;
+      _head = _scan = _tail;
+      return true;
+    }
+    /* the separator could straddle the end of data */
+    _scan = (_tail - _head >= seplen ? _tail - seplen + 1 : _head);
+    /* discard consumed data */
+    if (_head > 0)
+    {
+      ::memmove(_buf, _buf + _head, _tail - _head);
+      _offset += _head;
+      _tail -= _head;
+      _scan -= _head;
+      _head = 0;
+    }
+    /* a record larger than the buffer requires to grow it */
+    if (_tail == _buf_size)
+    {
+      char * buf = new char[_buf_size * 2];
+      ::memcpy(buf, _buf, _tail);
+      delete [] _buf;
+      _data = _buf = buf;
+      _buf_size *= 2;
+    }
+    size_t n = ::fread(_buf + _tail, 1, _buf_size - _tail, _file);
+    if (n == 0)
+      _eof = true;
+    _tail += n;
+  }
+}
+
+int file::Handle::seek_stream(int64_t s, int whence)
+{
+  int64_t pos;
+  if (_map)
+  {
+    switch (whence)
+    {
+    case SEEK_CUR:
+      pos = (int64_t) _head + s;
+      break;
+    case SEEK_END:
+      pos = (int64_t) _map_size + s;
+      break;
+    default:
+      pos = s;
+    }
+    if (pos < 0)
+      return EINVAL;
+    _head = _scan = std::min((size_t) pos, _map_size);
+    return 0;
+  }
+  if (whence == SEEK_CUR)
+  {
+    /* the file position is ahead of the logical position */
+    s += _offset + (int64_t) _head;
+    whence = SEEK_SET;
+  }
+  if (::fseek(_file, s, whence) != 0)
+    return errno;
+  _offset = ::ftell(_file);
+  _head = _tail = _scan = 0;
+  _eof = false;
+  return 0;
+}
+
 } /* namespace import */
 } /* namespace bloc */
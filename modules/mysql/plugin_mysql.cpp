@@ -24,11 +24,14 @@
 #include <blocc/debug.h>
 #include <string.h>
 #include <cassert>
+#include <memory>
+#include <climits>
 
 #define PLUGIN_TEXT_MAXLEN   0x0ffff
 #define PLUGIN_TEXT_INILEN   0x00fff
 #define PLUGIN_BLOB_MAXLEN   0x10000
 #define PLUGIN_BLOB_INILEN   0x01000
+#define PLUGIN_CURSOR_PREFETCH 100
 /*
  * Create the module MySQLImport
  */
@@ -73,6 +76,7 @@ enum Method
 {
   Open = 0, Close, IsOpen, AutoC, Commit, Rollback, Query1, Query2, Exec1,
   Exec2, ErrMsg, Prepare, Execute1, Execute2, Header, Fetch, Finalize,
+  Cursor1, Cursor2, FetchN,
 };
 
 /**********************************************************************/
@@ -108,6 +112,11 @@ static PLUGIN_ARG fetch_args[]   = {
   { PLUGIN_INOUT, { "R", 0 } }, // row
 };
 
+static PLUGIN_ARG fetchn_args[]  = {
+  { PLUGIN_INOUT, { "R", 1 } }, // rows
+  { PLUGIN_IN,    { "I", 0 } }, // count
+};
+
 /**********************************************************************/
 /*  Methods list                                                      */
 /*  id:       name:         ret: decl,ndim  args_count,args:          */
@@ -149,12 +158,23 @@ static PLUGIN_METHOD methods[] =
           "Fetch next row." },
   { Finalize, "finalize", { "B", 0 },     0, nullptr,
           "Close the prepared statement." },
+  { Cursor1,  "cursor",   { "O", 0 },     1, string_args,
+          "Execute the query, and return a new cursor object sharing the\n"
+          "connection to fetch the rows." },
+  { Cursor2,  "cursor",   { "O", 0 },     2, stmt_args,
+          "Execute the query with bound parameters, and return a new cursor\n"
+          "object sharing the connection to fetch the rows." },
+  { FetchN,   "fetch",    { "I", 0 },     2, fetchn_args,
+          "Fetch the next rows into the table, up to the given count, and\n"
+          "return the count of rows fetched, 0 at the end. The storage of the\n"
+          "table is reused from one batch to the next." },
 };
 
 /**
  * The state of handle
  */
 struct Handle {
+  std::shared_ptr<MYSQL> _conn; /* shared with the cursors */
   MYSQL * _db = nullptr;
   MYSQL_STMT * _stmt = nullptr;
   std::string _errmsg;
@@ -183,7 +203,10 @@ struct Handle {
   int execute();
   int header(bloc::Collection ** hd);
   int fetch(bloc::Tuple ** row);
+  int fetch(bloc::Collection& rows, int max, bloc::TupleDecl::Decl& decl);
   int finalize();
+  Handle * cursor();
+  int declare_cursor();
 
   class Bindings {
     std::vector<MYSQL_BIND> _bindings;
@@ -206,6 +229,9 @@ struct Handle {
   Bindings _stmt_rs;
   bloc::TupleDecl::Decl _stmt_decl;
 
+  int bind_result();
+  void fetch_column(MYSQL_BIND& bind, unsigned i, bloc::Value& v);
+
   static void bind_args(Bindings& bindings, bloc::Tuple& args);
   static void unbind_args(Bindings& bindings);
 };
@@ -279,14 +305,15 @@ void MySQLPlugin::destroyObject(void * object)
   delete h;
 }
 
-bloc::Value * MySQLPlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * MySQLPlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  MySQL::Handle * h = static_cast<MySQL::Handle*>(object_this.instance());
+  MySQL::Handle * h = static_cast<MySQL::Handle*>(object_this.complex()->instance());
 
   switch (method_id)
   {
@@ -301,20 +328,20 @@ bloc::Value * MySQLPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (h->isOpen() == 1)
       h->close();
-    return new bloc::Value(bloc::Bool(h->open(*a0.literal(),
-                                              *a1.literal(),
-                                              *a2.literal(),
-                                              *a3.literal(),
-                                              (unsigned)*a4.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->open(*a0.literal(),
+                                                  *a1.literal(),
+                                                  *a2.literal(),
+                                                  *a3.literal(),
+                                                  (unsigned)*a4.integer()))));
   }
 
   case MySQL::Close:
     if (h->isOpen())
-      return new bloc::Value(bloc::Bool(h->close()));
-    return new bloc::Value(bloc::Bool(0));
+      return &(ret = bloc::Value(bloc::Bool(h->close())));
+    return &(ret = bloc::Value(bloc::Bool(0)));
 
   case MySQL::IsOpen:
-    return new bloc::Value(bloc::Bool(h->isOpen()));
+    return &(ret = bloc::Value(bloc::Bool(h->isOpen())));
 
   default:
     if (!h->isOpen())
@@ -330,21 +357,21 @@ bloc::Value * MySQLPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->autocommit(*a0.boolean()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case MySQL::Commit:
   {
     if (!h->exec("COMMIT"))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case MySQL::Rollback:
   {
     if (!h->exec("ROLLBACK"))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case MySQL::Query1:
@@ -355,7 +382,7 @@ bloc::Value * MySQLPlugin::executeMethod(
     bloc::Collection * c = nullptr;
     if (!h->query(*a0.literal(), &c))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case MySQL::Query2:
@@ -367,7 +394,7 @@ bloc::Value * MySQLPlugin::executeMethod(
     bloc::Collection * c = nullptr;
     if (!h->query(*a0.literal(), *a1.tuple(), &c))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case MySQL::Exec1:
@@ -377,7 +404,7 @@ bloc::Value * MySQLPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->exec(*a0.literal()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case MySQL::Exec2:
@@ -388,11 +415,11 @@ bloc::Value * MySQLPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->exec(*a0.literal(), *a1.tuple()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case MySQL::ErrMsg:
-    return new bloc::Value(new bloc::Literal(std::string(h->errmsg())));
+    return &(ret = bloc::Value(bloc::Literal(std::string(h->errmsg()))));
 
    case MySQL::Prepare:
   {
@@ -401,7 +428,7 @@ bloc::Value * MySQLPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->prepare(*a0.literal()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case MySQL::Execute1:
@@ -411,19 +438,19 @@ bloc::Value * MySQLPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->execute(*a0.tuple()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case MySQL::Execute2:
     if (!h->execute())
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
 
   case MySQL::Header:
   {
     bloc::Collection * c = nullptr;
     int r = h->header(&c);
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case MySQL::Fetch:
@@ -435,11 +462,80 @@ bloc::Value * MySQLPlugin::executeMethod(
     int r = h->fetch(&t);
     if (r == 1)
       ctx.storeVariable(args[0]->symbolId(), bloc::Value(t));
-    return new bloc::Value(bloc::Bool(r));
+    return &(ret = bloc::Value(bloc::Bool(r)));
   }
 
   case MySQL::Finalize:
-    return new bloc::Value(bloc::Bool(h->finalize()));
+    return &(ret = bloc::Value(bloc::Bool(h->finalize())));
+
+  case MySQL::Cursor1:
+  case MySQL::Cursor2:
+  {
+    bloc::Value& a0 = args[0]->value(ctx);
+    if (a0.isNull())
+      throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+    bloc::Tuple * binds = nullptr;
+    if (method_id == MySQL::Cursor2)
+    {
+      bloc::Value& a1 = args[1]->value(ctx);
+      if (a1.isNull())
+        throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+      binds = a1.tuple();
+    }
+    MySQL::Handle * c = h->cursor();
+    if (!c->prepare(*a0.literal()) || !c->declare_cursor() ||
+            !(binds ? c->execute(*binds) : c->execute()))
+    {
+      std::string msg(c->errmsg());
+      delete c;
+      throw RuntimeError(EXC_RT_USER_S, msg.c_str());
+    }
+    return &(ret = bloc::Value(bloc::Complex::newInstance(object_this.complex()->typeId(), c)));
+  }
+
+  case MySQL::FetchN:
+  {
+    bloc::Value& a1 = args[1]->value(ctx);
+    if (!args[0]->isVarName() || a1.isNull() || *a1.integer() <= 0)
+      throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+    int max = (*a1.integer() < INT_MAX ? (int) *a1.integer() : INT_MAX);
+
+    /* INOUT: reuse the storage of the bound table when possible */
+    bloc::Value& var = ctx.loadVariable(args[0]->symbolId()).deref_value();
+    bloc::Collection * tab = nullptr;
+    bool reuse = (var.type() == bloc::Type::ROWTYPE && var.type().level() == 1 && !var.isNull());
+    if (reuse)
+      tab = var.detach().collection();
+    else
+      tab = new bloc::Collection(bloc::Type(bloc::Type::ROWTYPE).levelUp());
+
+    bloc::TupleDecl::Decl decl;
+    int r;
+    try
+    {
+      r = h->fetch(*tab, max, decl);
+    }
+    catch (...)
+    {
+      if (!reuse)
+        delete tab;
+      throw;
+    }
+    if (!decl.empty() && tab->table_decl() != decl)
+    {
+      /* the declaration of the rows has changed */
+      bloc::Collection::container_t c;
+      c.reserve(tab->size());
+      for (bloc::Value& e : *tab)
+        c.push_back(std::move(e));
+      if (!reuse)
+        delete tab;
+      ctx.storeVariable(args[0]->symbolId(), bloc::Value(new bloc::Collection(decl, 1, std::move(c))));
+    }
+    else if (!reuse)
+      ctx.storeVariable(args[0]->symbolId(), bloc::Value(tab));
+    return &(ret = bloc::Value(bloc::Integer(r)));
+  }
 
   default:
     break;
@@ -601,12 +697,18 @@ int MySQL::Handle::open(const std::string& host,
                         const std::string& dbname,
                         unsigned port)
 {
-  _db = mysql_init(_db);
-  if (!mysql_real_connect(_db, host.c_str(), user.c_str(), password.c_str(),
+  MYSQL * db = mysql_init(nullptr);
+  if (!db)
+    return 0;
+  if (!mysql_real_connect(db, host.c_str(), user.c_str(), password.c_str(),
                              dbname.c_str(), port, 0, 0))
   {
+    _errmsg.assign(mysql_error(db));
+    mysql_close(db);
     return 0;
   }
+  _conn.reset(db, mysql_close);
+  _db = db;
   return 1;
 }
 
@@ -716,7 +818,10 @@ int MySQL::Handle::fetchall(MYSQL_STMT * stmt, bloc::Collection ** rs)
   else
   {
     r = 1;
-    bloc::Collection::container_t c;
+    bloc::Collection * tab = new bloc::Collection(decl, 1);
+    /* a result set of scalar fields is stored by column */
+    tab->make_columnar();
+    std::vector<bloc::Value> t;
     while (r == 1)
     {
       int status = mysql_stmt_fetch(stmt);
@@ -729,7 +834,7 @@ int MySQL::Handle::fetchall(MYSQL_STMT * stmt, bloc::Collection ** rs)
         break;
       }
 
-      std::vector<bloc::Value> t;
+      t.clear();
       int i = 0;
       for (MYSQL_BIND& bind : bindings())
       {
@@ -821,7 +926,7 @@ int MySQL::Handle::fetchall(MYSQL_STMT * stmt, bloc::Collection ** rs)
             default:
               *buf = '\0';
             }
-            t.push_back(bloc::Value(new bloc::Literal(buf)));
+            t.push_back(bloc::Value(bloc::Literal(buf)));
           }
           break;
         case MYSQL_TYPE_VAR_STRING:
@@ -834,14 +939,14 @@ int MySQL::Handle::fetchall(MYSQL_STMT * stmt, bloc::Collection ** rs)
             if (rl > 0)
             {
               if (rl <= bind.buffer_length)
-                t.push_back(bloc::Value(new bloc::Literal((char*)bind.buffer, rl)));
+                t.push_back(bloc::Value(bloc::Literal((char*)bind.buffer, rl)));
               else if (bind.buffer_length >= PLUGIN_TEXT_MAXLEN)
-                t.push_back(bloc::Value(new bloc::Literal((char*)bind.buffer, bind.buffer_length)));
+                t.push_back(bloc::Value(bloc::Literal((char*)bind.buffer, bind.buffer_length)));
               else
               {
                 if (Bindings::alloc_buffer(bind, (rl > PLUGIN_TEXT_MAXLEN ? PLUGIN_TEXT_MAXLEN : rl)) &&
                       !mysql_stmt_fetch_column(stmt, &bind, i, 0))
-                  t.push_back(bloc::Value(new bloc::Literal((char*)bind.buffer, bind.buffer_length)));
+                  t.push_back(bloc::Value(bloc::Literal((char*)bind.buffer, bind.buffer_length)));
                 else
                 {
                   _errmsg.assign("Out of memory");
@@ -850,7 +955,7 @@ int MySQL::Handle::fetchall(MYSQL_STMT * stmt, bloc::Collection ** rs)
               }
             }
             else
-              t.push_back(bloc::Value(new bloc::Literal()));
+              t.push_back(bloc::Value(bloc::Literal()));
           }
           break;
         case MYSQL_TYPE_BIT:
@@ -891,9 +996,10 @@ int MySQL::Handle::fetchall(MYSQL_STMT * stmt, bloc::Collection ** rs)
         }
         ++i;
       }
-      c.push_back(bloc::Value(new bloc::Tuple(std::move(t))));
+      if (r == 1)
+        tab->push_row(t);
     }
-    *rs = new bloc::Collection(decl, 1, std::move(c));
+    *rs = tab;
   }
 
   mysql_stmt_free_result(stmt);
@@ -905,11 +1011,35 @@ int MySQL::Handle::close()
   if (!_db)
     return 0;
   finalize();
-  mysql_close(_db);
+  /* the connection is closed with the last cursor */
+  _conn.reset();
   _db = nullptr;
   return 1;
 }
 
+MySQL::Handle * MySQL::Handle::cursor()
+{
+  Handle * c = new Handle();
+  c->_conn = _conn;
+  c->_db = _db;
+  return c;
+}
+
+int MySQL::Handle::declare_cursor()
+{
+  /* read the result set through a server side cursor, leaving the
+   * connection free for other statements */
+  unsigned long type = (unsigned long) CURSOR_TYPE_READ_ONLY;
+  unsigned long prefetch = PLUGIN_CURSOR_PREFETCH;
+  if (mysql_stmt_attr_set(_stmt, STMT_ATTR_CURSOR_TYPE, &type) ||
+          mysql_stmt_attr_set(_stmt, STMT_ATTR_PREFETCH_ROWS, &prefetch))
+  {
+    _errmsg.assign(mysql_stmt_error(_stmt));
+    return 0;
+  }
+  return 1;
+}
+
 int MySQL::Handle::query(const std::string& str, bloc::Collection ** rs)
 {
   int r = 0;
@@ -1083,7 +1213,7 @@ int MySQL::Handle::header(bloc::Collection ** hd)
   {
     MYSQL_FIELD * field = mysql_fetch_field(prepare_meta_result);
     std::vector<bloc::Value> t;
-    t.push_back(bloc::Value(new bloc::Literal(field->name, field->name_length)));
+    t.push_back(bloc::Value(bloc::Literal(field->name, field->name_length)));
     switch (field->type)
     {
     case MYSQL_TYPE_TINY:
@@ -1092,13 +1222,13 @@ int MySQL::Handle::header(bloc::Collection ** hd)
     case MYSQL_TYPE_INT24:
     case MYSQL_TYPE_LONG:
     case MYSQL_TYPE_LONGLONG:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_INTEGER)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_INTEGER)));
       break;
     case MYSQL_TYPE_FLOAT:
     case MYSQL_TYPE_DOUBLE:
     case MYSQL_TYPE_DECIMAL:
     case MYSQL_TYPE_NEWDECIMAL:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_NUMERIC)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_NUMERIC)));
       break;
     case MYSQL_TYPE_TIMESTAMP:
     case MYSQL_TYPE_TIME:
@@ -1106,18 +1236,18 @@ int MySQL::Handle::header(bloc::Collection ** hd)
     case MYSQL_TYPE_DATETIME:
     case MYSQL_TYPE_VAR_STRING:
     case MYSQL_TYPE_STRING:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_LITERAL)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_LITERAL)));
       break;
     case MYSQL_TYPE_BIT:
     case MYSQL_TYPE_BLOB:
     case MYSQL_TYPE_TINY_BLOB:
     case MYSQL_TYPE_MEDIUM_BLOB:
     case MYSQL_TYPE_LONG_BLOB:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_TABCHAR)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_TABCHAR)));
       break;
     default:
       /* use complex for unsupported datatype */
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_COMPLEX)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_COMPLEX)));
     }
     if (*hd)
       (*hd)->push_back(bloc::Value(new bloc::Tuple(std::move(t))));
@@ -1133,269 +1263,378 @@ int MySQL::Handle::header(bloc::Collection ** hd)
   return 1;
 }
 
-int MySQL::Handle::fetch(bloc::Tuple ** row)
+int MySQL::Handle::bind_result()
 {
-  if (_stmt == nullptr)
-    throw RuntimeError(EXC_RT_OTHER_S, "No query in progress");
-  /* initialize bindinds */
-  if (_stmt_rs.empty())
+  /* fetch result set meta information */
+  MYSQL_RES * prepare_meta_result = mysql_stmt_result_metadata(_stmt);
+  if (!prepare_meta_result)
   {
-    /* fetch result set meta information */
-    MYSQL_RES * prepare_meta_result = mysql_stmt_result_metadata(_stmt);
-    if (!prepare_meta_result)
-    {
-      /* no result set */
-      return 0;
-    }
-    /* Get total columns in the query */
-    unsigned column_count = mysql_num_fields(prepare_meta_result);
-    _stmt_rs.reset(column_count);
-    _stmt_decl.resize(column_count);
-
-    /* fetch metadata of the result set */
-    int i = 0;
-    for (MYSQL_BIND& bind : _stmt_rs())
-    {
-      MYSQL_FIELD * field = mysql_fetch_field(prepare_meta_result);
-      bind.buffer_type = field->type;
-      switch (field->type)
-      {
-      case MYSQL_TYPE_TINY:
-        Bindings::alloc_buffer(bind, 1);
-        _stmt_decl[i] = bloc::Type::INTEGER;
-        break;
-      case MYSQL_TYPE_SHORT:
-      case MYSQL_TYPE_YEAR:
-        Bindings::alloc_buffer(bind, 2);
-        _stmt_decl[i] = bloc::Type::INTEGER;
-        break;
-      case MYSQL_TYPE_INT24:
-      case MYSQL_TYPE_LONG:
-        Bindings::alloc_buffer(bind, 4);
-        _stmt_decl[i] = bloc::Type::INTEGER;
-        break;
-      case MYSQL_TYPE_FLOAT:
-        Bindings::alloc_buffer(bind, 4);
-        _stmt_decl[i] = bloc::Type::NUMERIC;
-        break;
-      case MYSQL_TYPE_LONGLONG:
-        Bindings::alloc_buffer(bind, 8);
-        _stmt_decl[i] = bloc::Type::INTEGER;
-        break;
-      case MYSQL_TYPE_DOUBLE:
-        Bindings::alloc_buffer(bind, 8);
-        _stmt_decl[i] = bloc::Type::NUMERIC;
-        break;
-      case MYSQL_TYPE_TIMESTAMP:
-      case MYSQL_TYPE_TIME:
-      case MYSQL_TYPE_DATE:
-      case MYSQL_TYPE_DATETIME:
-        Bindings::alloc_buffer(bind, sizeof(MYSQL_TIME));
-        _stmt_decl[i] = bloc::Type::LITERAL;
-        break;
-      case MYSQL_TYPE_DECIMAL:
-      case MYSQL_TYPE_NEWDECIMAL:
-        Bindings::alloc_buffer(bind, field->length);
-        _stmt_decl[i] = bloc::Type::NUMERIC;
-        break;
-      case MYSQL_TYPE_VAR_STRING:
-      case MYSQL_TYPE_STRING:
-        if (field->length > PLUGIN_TEXT_INILEN)
-          Bindings::alloc_buffer(bind, PLUGIN_TEXT_INILEN);
-        else
-          Bindings::alloc_buffer(bind, field->length);
-        _stmt_decl[i] = bloc::Type::LITERAL;
-        break;
-      case MYSQL_TYPE_BIT:
-      case MYSQL_TYPE_BLOB:
-      case MYSQL_TYPE_TINY_BLOB:
-      case MYSQL_TYPE_MEDIUM_BLOB:
-      case MYSQL_TYPE_LONG_BLOB:
-        if (field->length > PLUGIN_BLOB_INILEN)
-          Bindings::alloc_buffer(bind, PLUGIN_BLOB_INILEN);
-        else
-          Bindings::alloc_buffer(bind, field->length);
-        _stmt_decl[i] = bloc::Type::TABCHAR;
-        break;
-      default:
-        /* use complex for unsupported datatype */
-        _stmt_decl[i] = bloc::Type::COMPLEX;
-      }
-      ++i;
-    }
-    /* free metedata */
-    mysql_free_result(prepare_meta_result);
-    /* bind the result buffers */
-    if (mysql_stmt_bind_result(_stmt, _stmt_rs.data()))
-      throw RuntimeError(EXC_RT_OTHER_S, mysql_error(_db));
-  }
-
-  int status = mysql_stmt_fetch(_stmt);
-  if (status == MYSQL_NO_DATA)
+    /* no result set */
     return 0;
-  if (status == 1)
-    throw RuntimeError(EXC_RT_USER_S, mysql_error(_db));
+  }
+  /* Get total columns in the query */
+  unsigned column_count = mysql_num_fields(prepare_meta_result);
+  _stmt_rs.reset(column_count);
+  _stmt_decl.resize(column_count);
 
-  std::vector<bloc::Value> t;
+  /* fetch metadata of the result set */
   int i = 0;
   for (MYSQL_BIND& bind : _stmt_rs())
   {
-    switch (bind.buffer_type)
+    MYSQL_FIELD * field = mysql_fetch_field(prepare_meta_result);
+    bind.buffer_type = field->type;
+    switch (field->type)
     {
-    case MYSQL_TYPE_FLOAT:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_numeric));
-      else
-        t.push_back(bloc::Value(bloc::Numeric(*(float*)bind.buffer)));
-      break;
-    case MYSQL_TYPE_DOUBLE:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_numeric));
-      else
-        t.push_back(bloc::Value(bloc::Numeric(*(double*)bind.buffer)));
-      break;
     case MYSQL_TYPE_TINY:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_integer));
-      else
-        t.push_back(bloc::Value(bloc::Integer(*(char*)bind.buffer)));
+      Bindings::alloc_buffer(bind, 1);
+      _stmt_decl[i] = bloc::Type::INTEGER;
       break;
     case MYSQL_TYPE_SHORT:
     case MYSQL_TYPE_YEAR:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_integer));
-      else
-        t.push_back(bloc::Value(bloc::Integer(*(short int*)bind.buffer)));
+      Bindings::alloc_buffer(bind, 2);
+      _stmt_decl[i] = bloc::Type::INTEGER;
       break;
     case MYSQL_TYPE_INT24:
     case MYSQL_TYPE_LONG:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_integer));
-      else
-        t.push_back(bloc::Value(bloc::Integer(*(int*)bind.buffer)));
+      Bindings::alloc_buffer(bind, 4);
+      _stmt_decl[i] = bloc::Type::INTEGER;
+      break;
+    case MYSQL_TYPE_FLOAT:
+      Bindings::alloc_buffer(bind, 4);
+      _stmt_decl[i] = bloc::Type::NUMERIC;
       break;
     case MYSQL_TYPE_LONGLONG:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_integer));
-      else
-        t.push_back(bloc::Value(bloc::Integer(*(long long int*)bind.buffer)));
+      Bindings::alloc_buffer(bind, 8);
+      _stmt_decl[i] = bloc::Type::INTEGER;
       break;
-    case MYSQL_TYPE_DECIMAL:
-    case MYSQL_TYPE_NEWDECIMAL:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_numeric));
-      else
-        t.push_back(bloc::Value::parseNumeric(std::string((char*)bind.buffer, bind.buffer_length)));
+    case MYSQL_TYPE_DOUBLE:
+      Bindings::alloc_buffer(bind, 8);
+      _stmt_decl[i] = bloc::Type::NUMERIC;
       break;
     case MYSQL_TYPE_TIMESTAMP:
-    case MYSQL_TYPE_DATE:
     case MYSQL_TYPE_TIME:
+    case MYSQL_TYPE_DATE:
     case MYSQL_TYPE_DATETIME:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_literal));
-      else
-      {
-        char buf[32];
-        MYSQL_TIME * ts = (MYSQL_TIME*)bind.buffer;
-        switch (ts->time_type)
-        {
-        case MYSQL_TIMESTAMP_DATE:
-          /* iso date */
-          snprintf(buf, 11, "%04d-%02d-%02d",
-                   ts->year, ts->month, ts->day);
-          break;
-        case MYSQL_TIMESTAMP_DATETIME:
-          /* iso8601 date and time */
-          if (ts->second_part == 0)
-            snprintf(buf, 20, "%04d-%02d-%02dT%02d:%02d:%02d",
-                     ts->year, ts->month, ts->day,
-                     ts->hour, ts->minute, ts->second);
-          else
-            snprintf(buf, 27, "%04d-%02d-%02dT%02d:%02d:%02d.%06u",
-                     ts->year, ts->month, ts->day,
-                     ts->hour, ts->minute, ts->second,
-                     (unsigned)(ts->second_part));
-          break;
-        case MYSQL_TIMESTAMP_TIME:
-          if (ts->second_part == 0)
-            snprintf(buf, 9, "%02d:%02d:%02d",
-                     ts->hour, ts->minute, ts->second);
-          else
-            snprintf(buf, 16, "%02d:%02d:%02d.%06u",
-                     ts->hour, ts->minute, ts->second,
-                     (unsigned)(ts->second_part));
-          break;
-        default:
-          *buf = '\0';
-        }
-        t.push_back(bloc::Value(new bloc::Literal(buf)));
-      }
+      Bindings::alloc_buffer(bind, sizeof(MYSQL_TIME));
+      _stmt_decl[i] = bloc::Type::LITERAL;
+      break;
+    case MYSQL_TYPE_DECIMAL:
+    case MYSQL_TYPE_NEWDECIMAL:
+      Bindings::alloc_buffer(bind, field->length);
+      _stmt_decl[i] = bloc::Type::NUMERIC;
       break;
     case MYSQL_TYPE_VAR_STRING:
     case MYSQL_TYPE_STRING:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_literal));
+      if (field->length > PLUGIN_TEXT_INILEN)
+        Bindings::alloc_buffer(bind, PLUGIN_TEXT_INILEN);
       else
-      {
-        unsigned long rl = *bind.length;
-        if (rl > 0)
-        {
-          if (rl <= bind.buffer_length)
-            t.push_back(bloc::Value(new bloc::Literal((char*)bind.buffer, rl)));
-          else if (bind.buffer_length >= PLUGIN_TEXT_MAXLEN)
-            t.push_back(bloc::Value(new bloc::Literal((char*)bind.buffer, bind.buffer_length)));
-          else
-          {
-            if (Bindings::alloc_buffer(bind, (rl > PLUGIN_TEXT_MAXLEN ? PLUGIN_TEXT_MAXLEN : rl)) &&
-                  !mysql_stmt_fetch_column(_stmt, &bind, i, 0))
-              t.push_back(bloc::Value(new bloc::Literal((char*)bind.buffer, bind.buffer_length)));
-            else
-              throw RuntimeError(EXC_RT_USER_S, "Out of memory");
-          }
-        }
-        else
-          t.push_back(bloc::Value(new bloc::Literal()));
-      }
+        Bindings::alloc_buffer(bind, field->length);
+      _stmt_decl[i] = bloc::Type::LITERAL;
       break;
     case MYSQL_TYPE_BIT:
     case MYSQL_TYPE_BLOB:
     case MYSQL_TYPE_TINY_BLOB:
     case MYSQL_TYPE_MEDIUM_BLOB:
     case MYSQL_TYPE_LONG_BLOB:
-      if (*bind.is_null)
-        t.push_back(bloc::Value(bloc::Value::type_tabchar));
+      if (field->length > PLUGIN_BLOB_INILEN)
+        Bindings::alloc_buffer(bind, PLUGIN_BLOB_INILEN);
       else
+        Bindings::alloc_buffer(bind, field->length);
+      _stmt_decl[i] = bloc::Type::TABCHAR;
+      break;
+    default:
+      /* use complex for unsupported datatype */
+      _stmt_decl[i] = bloc::Type::COMPLEX;
+    }
+    ++i;
+  }
+  /* free metedata */
+  mysql_free_result(prepare_meta_result);
+  /* bind the result buffers */
+  if (mysql_stmt_bind_result(_stmt, _stmt_rs.data()))
+    throw RuntimeError(EXC_RT_OTHER_S, mysql_error(_db));
+  return 1;
+}
+
+static void _store_null(bloc::Value& v, const bloc::Type& type)
+{
+  if (!v.isNull() || v.type() != type)
+    v = bloc::Value(type);
+}
+
+static void _store_integer(bloc::Value& v, bloc::Integer i)
+{
+  if (v.type() == bloc::Type::INTEGER && v.type().level() == 0 && !v.isNull())
+    *v.integer() = i;
+  else
+    v = bloc::Value(i);
+}
+
+static void _store_numeric(bloc::Value& v, bloc::Numeric d)
+{
+  if (v.type() == bloc::Type::NUMERIC && v.type().level() == 0 && !v.isNull())
+    *v.numeric() = d;
+  else
+    v = bloc::Value(d);
+}
+
+static void _store_literal(bloc::Value& v, const char * str, size_t len)
+{
+  if (v.type() == bloc::Type::LITERAL && v.type().level() == 0 && !v.isNull())
+    v.literal()->assign(str, len);
+  else
+    v = bloc::Value(bloc::Literal(str, len));
+}
+
+static void _store_tabchar(bloc::Value& v, const char * buf, size_t len)
+{
+  if (v.type() == bloc::Type::TABCHAR && v.type().level() == 0 && !v.isNull())
+    v.tabchar()->assign(buf, buf + len);
+  else
+    v = bloc::Value(new bloc::TabChar(buf, buf + len));
+}
+
+/* store the column into the value, reusing its storage when possible */
+void MySQL::Handle::fetch_column(MYSQL_BIND& bind, unsigned i, bloc::Value& v)
+{
+  switch (bind.buffer_type)
+  {
+  case MYSQL_TYPE_FLOAT:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_numeric);
+    else
+      _store_numeric(v, *(float*)bind.buffer);
+    break;
+  case MYSQL_TYPE_DOUBLE:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_numeric);
+    else
+      _store_numeric(v, *(double*)bind.buffer);
+    break;
+  case MYSQL_TYPE_TINY:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_integer);
+    else
+      _store_integer(v, *(char*)bind.buffer);
+    break;
+  case MYSQL_TYPE_SHORT:
+  case MYSQL_TYPE_YEAR:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_integer);
+    else
+      _store_integer(v, *(short int*)bind.buffer);
+    break;
+  case MYSQL_TYPE_INT24:
+  case MYSQL_TYPE_LONG:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_integer);
+    else
+      _store_integer(v, *(int*)bind.buffer);
+    break;
+  case MYSQL_TYPE_LONGLONG:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_integer);
+    else
+      _store_integer(v, *(long long int*)bind.buffer);
+    break;
+  case MYSQL_TYPE_DECIMAL:
+  case MYSQL_TYPE_NEWDECIMAL:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_numeric);
+    else
+      _store_numeric(v, *(bloc::Value::parseNumeric(std::string((char*)bind.buffer, bind.buffer_length)).numeric()));
+    break;
+  case MYSQL_TYPE_TIMESTAMP:
+  case MYSQL_TYPE_DATE:
+  case MYSQL_TYPE_TIME:
+  case MYSQL_TYPE_DATETIME:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_literal);
+    else
+    {
+      char buf[32];
+      MYSQL_TIME * ts = (MYSQL_TIME*)bind.buffer;
+      switch (ts->time_type)
+      {
+      case MYSQL_TIMESTAMP_DATE:
+        /* iso date */
+        snprintf(buf, 11, "%04d-%02d-%02d",
+                 ts->year, ts->month, ts->day);
+        break;
+      case MYSQL_TIMESTAMP_DATETIME:
+        /* iso8601 date and time */
+        if (ts->second_part == 0)
+          snprintf(buf, 20, "%04d-%02d-%02dT%02d:%02d:%02d",
+                   ts->year, ts->month, ts->day,
+                   ts->hour, ts->minute, ts->second);
+        else
+          snprintf(buf, 27, "%04d-%02d-%02dT%02d:%02d:%02d.%06u",
+                   ts->year, ts->month, ts->day,
+                   ts->hour, ts->minute, ts->second,
+                   (unsigned)(ts->second_part));
+        break;
+      case MYSQL_TIMESTAMP_TIME:
+        if (ts->second_part == 0)
+          snprintf(buf, 9, "%02d:%02d:%02d",
+                   ts->hour, ts->minute, ts->second);
+        else
+          snprintf(buf, 16, "%02d:%02d:%02d.%06u",
+                   ts->hour, ts->minute, ts->second,
+                   (unsigned)(ts->second_part));
+        break;
+      default:
+        *buf = '\0';
+      }
+      _store_literal(v, buf, strlen(buf));
+    }
+    break;
+  case MYSQL_TYPE_VAR_STRING:
+  case MYSQL_TYPE_STRING:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_literal);
+    else
+    {
+      unsigned long rl = *bind.length;
+      if (rl > 0)
       {
-        unsigned long rl = *bind.length;
-        if (rl > 0)
+        if (rl <= bind.buffer_length)
+          _store_literal(v, (char*)bind.buffer, rl);
+        else if (bind.buffer_length >= PLUGIN_TEXT_MAXLEN)
+          _store_literal(v, (char*)bind.buffer, bind.buffer_length);
+        else
         {
-          if (rl <= bind.buffer_length)
-            t.push_back(bloc::Value(new bloc::TabChar((char*)bind.buffer, (char*)bind.buffer + rl)));
-          else if (bind.buffer_length >= PLUGIN_BLOB_MAXLEN)
-            t.push_back(bloc::Value(new bloc::TabChar((char*)bind.buffer, (char*)bind.buffer + bind.buffer_length)));
+          if (Bindings::alloc_buffer(bind, (rl > PLUGIN_TEXT_MAXLEN ? PLUGIN_TEXT_MAXLEN : rl)) &&
+                !mysql_stmt_fetch_column(_stmt, &bind, i, 0))
+            _store_literal(v, (char*)bind.buffer, bind.buffer_length);
           else
-          {
-            if (Bindings::alloc_buffer(bind, (rl > PLUGIN_BLOB_MAXLEN ? PLUGIN_BLOB_MAXLEN : rl)) &&
-                  !mysql_stmt_fetch_column(_stmt, &bind, i, 0))
-              t.push_back(bloc::Value(new bloc::TabChar((char*)bind.buffer, (char*)bind.buffer + bind.buffer_length)));
-            else
-              throw RuntimeError(EXC_RT_USER_S, "Out of memory");
-          }
+            throw RuntimeError(EXC_RT_USER_S, "Out of memory");
         }
+      }
+      else
+        _store_literal(v, nullptr, 0);
+    }
+    break;
+  case MYSQL_TYPE_BIT:
+  case MYSQL_TYPE_BLOB:
+  case MYSQL_TYPE_TINY_BLOB:
+  case MYSQL_TYPE_MEDIUM_BLOB:
+  case MYSQL_TYPE_LONG_BLOB:
+    if (*bind.is_null)
+      _store_null(v, bloc::Value::type_tabchar);
+    else
+    {
+      unsigned long rl = *bind.length;
+      if (rl > 0)
+      {
+        if (rl <= bind.buffer_length)
+          _store_tabchar(v, (char*)bind.buffer, rl);
+        else if (bind.buffer_length >= PLUGIN_BLOB_MAXLEN)
+          _store_tabchar(v, (char*)bind.buffer, bind.buffer_length);
         else
-          t.push_back(bloc::Value(new bloc::TabChar()));
+        {
+          if (Bindings::alloc_buffer(bind, (rl > PLUGIN_BLOB_MAXLEN ? PLUGIN_BLOB_MAXLEN : rl)) &&
+                !mysql_stmt_fetch_column(_stmt, &bind, i, 0))
+            _store_tabchar(v, (char*)bind.buffer, bind.buffer_length);
+          else
+            throw RuntimeError(EXC_RT_USER_S, "Out of memory");
+        }
       }
-      break;
-    default:
-      /* use complex for unsupported datatype */
-      t.push_back(bloc::Value(bloc::Value::type_complex));
+      else
+        _store_tabchar(v, nullptr, 0);
     }
+    break;
+  default:
+    /* use complex for unsupported datatype */
+    _store_null(v, bloc::Value::type_complex);
+  }
+}
+
+int MySQL::Handle::fetch(bloc::Tuple ** row)
+{
+  if (_stmt == nullptr)
+    throw RuntimeError(EXC_RT_OTHER_S, "No query in progress");
+  /* initialize bindinds */
+  if (_stmt_rs.empty() && !bind_result())
+    return 0;
+
+  int status = mysql_stmt_fetch(_stmt);
+  if (status == MYSQL_NO_DATA)
+    return 0;
+  if (status == 1)
+    throw RuntimeError(EXC_RT_USER_S, mysql_error(_db));
+
+  bloc::Tuple::container_t t(_stmt_rs.size());
+  unsigned i = 0;
+  for (MYSQL_BIND& bind : _stmt_rs())
+  {
+    fetch_column(bind, i, t[i]);
     ++i;
   }
   *row = new bloc::Tuple(std::move(t));
   return 1;
 }
 
+int MySQL::Handle::fetch(bloc::Collection& rows, int max, bloc::TupleDecl::Decl& decl)
+{
+  if (_stmt == nullptr)
+    throw RuntimeError(EXC_RT_OTHER_S, "No query in progress");
+  /* initialize bindinds */
+  if (_stmt_rs.empty() && !bind_result())
+  {
+    rows.clear();
+    return 0;
+  }
+  /* the types of the columns are given by the metadata */
+  decl = _stmt_decl;
+
+  int n = 0;
+  while (n < max)
+  {
+    int status = mysql_stmt_fetch(_stmt);
+    if (status == MYSQL_NO_DATA)
+      break;
+    if (status == 1)
+      throw RuntimeError(EXC_RT_USER_S, mysql_error(_db));
+
+    bloc::Tuple * t = nullptr;
+    if (n < (int) rows.size() && rows[n].type() == bloc::Type::ROWTYPE && !rows[n].isNull())
+    {
+      /* reuse the row of the previous batch */
+      t = rows[n].detach().tuple();
+      if (t->tuple_decl() != _stmt_decl)
+        t = nullptr;
+    }
+    if (t)
+    {
+      unsigned i = 0;
+      for (MYSQL_BIND& bind : _stmt_rs())
+      {
+        fetch_column(bind, i, t->at(i));
+        ++i;
+      }
+    }
+    else
+    {
+      bloc::Tuple::container_t items(_stmt_rs.size());
+      unsigned i = 0;
+      for (MYSQL_BIND& bind : _stmt_rs())
+      {
+        fetch_column(bind, i, items[i]);
+        ++i;
+      }
+      bloc::Value row(new bloc::Tuple(std::move(items)));
+      if (n < (int) rows.size())
+        rows[n].swap(row);
+      else
+        rows.push_back(std::move(row));
+    }
+    ++n;
+  }
+  if (n < (int) rows.size())
+    rows.erase(rows.begin() + n, rows.end());
+  return n;
+}
+
 int MySQL::Handle::finalize()
 {
   if (!_stmt)
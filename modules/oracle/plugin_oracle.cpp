@@ -351,14 +351,15 @@ void OraclePlugin::destroyObject(void * object)
   delete h;
 }
 
-bloc::Value * OraclePlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * OraclePlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  Oracle::Handle * h = static_cast<Oracle::Handle*>(object_this.instance());
+  Oracle::Handle * h = static_cast<Oracle::Handle*>(object_this.complex()->instance());
 
   switch (method_id)
   {
@@ -371,10 +372,10 @@ bloc::Value * OraclePlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (h->isOpen() == 1)
       h->close();
-    return new bloc::Value(bloc::Bool(h->open(*a0.literal(),
-                                              *a1.literal(),
-                                              *a2.literal(),
-                                              "")));
+    return &(ret = bloc::Value(bloc::Bool(h->open(*a0.literal(),
+                                                  *a1.literal(),
+                                                  *a2.literal(),
+                                                  ""))));
   }
 
   case Oracle::Open2:
@@ -387,19 +388,19 @@ bloc::Value * OraclePlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (h->isOpen() == 1)
       h->close();
-    return new bloc::Value(bloc::Bool(h->open(*a0.literal(),
-                                              *a1.literal(),
-                                              *a2.literal(),
-                                              (a3.isNull() ? "" : *a3.literal()))));
+    return &(ret = bloc::Value(bloc::Bool(h->open(*a0.literal(),
+                                                  *a1.literal(),
+                                                  *a2.literal(),
+                                                  (a3.isNull() ? "" : *a3.literal())))));
   }
 
   case Oracle::Close:
     if (h->isOpen())
-      return new bloc::Value(bloc::Bool(h->close()));
-    return new bloc::Value(bloc::Bool(0));
+      return &(ret = bloc::Value(bloc::Bool(h->close())));
+    return &(ret = bloc::Value(bloc::Bool(0)));
 
   case Oracle::IsOpen:
-    return new bloc::Value(bloc::Bool(h->isOpen()));
+    return &(ret = bloc::Value(bloc::Bool(h->isOpen())));
 
   default:
     if (!h->isOpen())
@@ -413,14 +414,14 @@ bloc::Value * OraclePlugin::executeMethod(
   {
     if (!h->commit())
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case Oracle::Rollback:
   {
     if (!h->rollback())
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case Oracle::Query1:
@@ -431,7 +432,7 @@ bloc::Value * OraclePlugin::executeMethod(
     bloc::Collection * c = nullptr;
     if (!h->query(*a0.literal(), &c))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case Oracle::Query2:
@@ -443,7 +444,7 @@ bloc::Value * OraclePlugin::executeMethod(
     bloc::Collection * c = nullptr;
     if (!h->query(*a0.literal(), *a1.tuple(), &c))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case Oracle::Exec1:
@@ -453,7 +454,7 @@ bloc::Value * OraclePlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->exec(*a0.literal()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case Oracle::Exec2:
@@ -464,11 +465,11 @@ bloc::Value * OraclePlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->exec(*a0.literal(), *a1.tuple()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case Oracle::ErrMsg:
-    return new bloc::Value(new bloc::Literal(std::string(h->errmsg())));
+    return &(ret = bloc::Value(bloc::Literal(std::string(h->errmsg()))));
 
    case Oracle::Prepare:
   {
@@ -477,7 +478,7 @@ bloc::Value * OraclePlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->prepare(*a0.literal()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case Oracle::Execute1:
@@ -487,19 +488,19 @@ bloc::Value * OraclePlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->execute(*a0.tuple()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case Oracle::Execute2:
     if (!h->execute())
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
 
   case Oracle::Header:
   {
     bloc::Collection * c = nullptr;
     (void) h->header(&c);
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case Oracle::Fetch:
@@ -513,11 +514,11 @@ bloc::Value * OraclePlugin::executeMethod(
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
     if (found)
       ctx.storeVariable(args[0]->symbolId(), bloc::Value(t));
-    return new bloc::Value(bloc::Bool(found));
+    return &(ret = bloc::Value(bloc::Bool(found)));
   }
 
   case Oracle::Finalize:
-    return new bloc::Value(bloc::Bool(h->finalize()));
+    return &(ret = bloc::Value(bloc::Bool(h->finalize())));
 
   default:
     break;
@@ -931,27 +932,27 @@ int Oracle::Handle::header(bloc::Collection ** hd)
   for (auto& decl : _stmt_decl)
   {
     std::vector<bloc::Value> t;
-    t.push_back(bloc::Value(new bloc::Literal(_stmt_columns[col++])));
+    t.push_back(bloc::Value(bloc::Literal(_stmt_columns[col++])));
     switch (decl.major())
     {
     case bloc::Type::BOOLEAN:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_BOOLEAN)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_BOOLEAN)));
       break;
     case bloc::Type::INTEGER:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_INTEGER)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_INTEGER)));
       break;
     case bloc::Type::NUMERIC:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_NUMERIC)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_NUMERIC)));
       break;
     case bloc::Type::LITERAL:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_LITERAL)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_LITERAL)));
       break;
     case bloc::Type::TABCHAR:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_TABCHAR)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_TABCHAR)));
       break;
     default:
       /* use complex for unsupported datatype */
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_COMPLEX)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_COMPLEX)));
     }
     if (*hd)
       (*hd)->push_back(bloc::Value(new bloc::Tuple(std::move(t))));
@@ -1019,12 +1020,12 @@ int Oracle::Handle::fetch(bloc::Tuple ** row, bool& found)
         uint32_t len;
         if (dpiRowid_getStringValue(data->value.asRowid, &str, &len) < 0)
             return onError();
-        t.push_back(bloc::Value(new bloc::Literal(str, len)));
+        t.push_back(bloc::Value(bloc::Literal(str, len)));
       }
       break;
     case DPI_NATIVE_TYPE_BYTES:
       if (decl == bloc::Type::LITERAL)
-        t.push_back(bloc::Value(new bloc::Literal(data->value.asBytes.ptr,
+        t.push_back(bloc::Value(bloc::Literal(data->value.asBytes.ptr,
                 data->value.asBytes.length)));
       else
         t.push_back(bloc::Value(new bloc::TabChar(data->value.asBytes.ptr,
@@ -1079,7 +1080,7 @@ int Oracle::Handle::fetch(bloc::Tuple ** row, bool& found)
                     data->value.asTimestamp.tzHourOffset,
                     data->value.asTimestamp.tzMinuteOffset);
         }
-        t.push_back(bloc::Value(new bloc::Literal(buf)));
+        t.push_back(bloc::Value(bloc::Literal(buf)));
       }
       break;
     case DPI_NATIVE_TYPE_LOB:
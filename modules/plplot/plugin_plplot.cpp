@@ -906,55 +906,56 @@ void PLPLOTPlugin::destroyObject(void * object)
   delete h;
 }
 
-bloc::Value * PLPLOTPlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * PLPLOTPlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  PLPLOT::Handle * h = static_cast<PLPLOT::Handle*>(object_this.instance());
+  PLPLOT::Handle * h = static_cast<PLPLOT::Handle*>(object_this.complex()->instance());
 
   switch (method_id)
   {
   case PLPLOT::Usage:
     h->_pls->OptUsage();
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
 
   case PLPLOT::Version:
-    return new bloc::Value(new bloc::Literal(h->version()));
+    return &(ret = bloc::Value(bloc::Literal(h->version())));
 
   case PLPLOT::Init:
-    return new bloc::Value(bloc::Bool(h->init(std::string())));
+    return &(ret = bloc::Value(bloc::Bool(h->init(std::string()))));
 
   case PLPLOT::Init1:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->init(*a0.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->init(*a0.literal()))));
   }
 
   case PLPLOT::Close:
-    return new bloc::Value(bloc::Bool(h->close()));
+    return &(ret = bloc::Value(bloc::Bool(h->close())));
 
   case PLPLOT::Flush:
-    return new bloc::Value(bloc::Bool(h->flush()));
+    return &(ret = bloc::Value(bloc::Bool(h->flush())));
 
   case PLPLOT::Replot:
-    return new bloc::Value(bloc::Bool(h->replot()));
+    return &(ret = bloc::Value(bloc::Bool(h->replot())));
 
   case PLPLOT::Pause:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->paused(*a0.boolean())));
+    return &(ret = bloc::Value(bloc::Bool(h->paused(*a0.boolean()))));
   }
 
   case PLPLOT::Pause1:
   {
-    return new bloc::Value(bloc::Bool(h->_paused));
+    return &(ret = bloc::Value(bloc::Bool(h->_paused)));
   }
 
   case PLPLOT::Env:
@@ -969,7 +970,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double xmax = (a1.type() == bloc::Type::NUMERIC ? *a1.numeric() : *a1.integer());
     double ymin = (a2.type() == bloc::Type::NUMERIC ? *a2.numeric() : *a2.integer());
     double ymax = (a3.type() == bloc::Type::NUMERIC ? *a3.numeric() : *a3.integer());
-    return new bloc::Value(bloc::Bool(h->env(xmin, xmax, ymin, ymax, 0, 0)));
+    return &(ret = bloc::Value(bloc::Bool(h->env(xmin, xmax, ymin, ymax, 0, 0))));
   }
 
   case PLPLOT::Env1:
@@ -988,7 +989,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double ymax = (a3.type() == bloc::Type::NUMERIC ? *a3.numeric() : *a3.integer());
     int just = (int) *a4.integer();
     int axis = (int) *a5.integer();
-    return new bloc::Value(bloc::Bool(h->env(xmin, xmax, ymin, ymax, just, axis)));
+    return &(ret = bloc::Value(bloc::Bool(h->env(xmin, xmax, ymin, ymax, just, axis))));
   }
 
   case PLPLOT::Lab:
@@ -998,7 +999,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a2 = args[2]->value(ctx);
     if (a0.isNull() || a1.isNull() || a2.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->lab(*a0.literal(), *a1.literal(), *a2.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->lab(*a0.literal(), *a1.literal(), *a2.literal()))));
   }
 
   case PLPLOT::Line:
@@ -1012,7 +1013,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     size_t n = (x.size() > y.size() ? y.size() : x.size());
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
-    return new bloc::Value(bloc::Bool(h->line((int) n, vx.data, vy.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->line((int) n, vx.data, vy.data))));
   }
 
   case PLPLOT::Adv:
@@ -1020,7 +1021,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->adv((int) *a0.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->adv((int) *a0.integer()))));
   }
 
   case PLPLOT::Vpor:
@@ -1035,7 +1036,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double xmax = (a1.type() == bloc::Type::NUMERIC ? *a1.numeric() : *a1.integer());
     double ymin = (a2.type() == bloc::Type::NUMERIC ? *a2.numeric() : *a2.integer());
     double ymax = (a3.type() == bloc::Type::NUMERIC ? *a3.numeric() : *a3.integer());
-    return new bloc::Value(bloc::Bool(h->vpor(xmin, xmax, ymin, ymax)));
+    return &(ret = bloc::Value(bloc::Bool(h->vpor(xmin, xmax, ymin, ymax))));
   }
 
   case PLPLOT::Wind:
@@ -1050,7 +1051,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double xmax = (a1.type() == bloc::Type::NUMERIC ? *a1.numeric() : *a1.integer());
     double ymin = (a2.type() == bloc::Type::NUMERIC ? *a2.numeric() : *a2.integer());
     double ymax = (a3.type() == bloc::Type::NUMERIC ? *a3.numeric() : *a3.integer());
-    return new bloc::Value(bloc::Bool(h->wind(xmin, xmax, ymin, ymax)));
+    return &(ret = bloc::Value(bloc::Bool(h->wind(xmin, xmax, ymin, ymax))));
   }
 
   case PLPLOT::Width:
@@ -1059,7 +1060,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     double w = (a0.type() == bloc::Type::NUMERIC ? *a0.numeric() : *a0.integer());
-    return new bloc::Value(bloc::Bool(h->width(w)));
+    return &(ret = bloc::Value(bloc::Bool(h->width(w))));
   }
 
   case PLPLOT::Col0:
@@ -1067,7 +1068,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->col0(*a0.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->col0(*a0.integer()))));
   }
 
   case PLPLOT::Col1:
@@ -1075,7 +1076,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->col1(*a0.numeric())));
+    return &(ret = bloc::Value(bloc::Bool(h->col1(*a0.numeric()))));
   }
 
   case PLPLOT::Scolbga:
@@ -1086,7 +1087,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a3 = args[3]->value(ctx);
     if (a0.isNull() || a1.isNull() || a2.isNull() || a3.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->scolbga((int) *a0.integer(), (int) *a1.integer(), (int) *a2.integer(), *a3.numeric())));
+    return &(ret = bloc::Value(bloc::Bool(h->scolbga((int) *a0.integer(), (int) *a1.integer(), (int) *a2.integer(), *a3.numeric()))));
   }
 
   case PLPLOT::Scol0a:
@@ -1098,7 +1099,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a4 = args[4]->value(ctx);
     if (a0.isNull() || a1.isNull() || a2.isNull() || a3.isNull() || a4.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->scol0a((int) *a0.integer(), (int) *a1.integer(), (int) *a2.integer(), (int) *a3.integer(), *a4.numeric())));
+    return &(ret = bloc::Value(bloc::Bool(h->scol0a((int) *a0.integer(), (int) *a1.integer(), (int) *a2.integer(), (int) *a3.integer(), *a4.numeric()))));
   }
 
   case PLPLOT::Ptex:
@@ -1117,7 +1118,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double dx = (a2.type() == bloc::Type::NUMERIC ? *a2.numeric() : *a2.integer());
     double dy = (a3.type() == bloc::Type::NUMERIC ? *a3.numeric() : *a3.integer());
     double just = (a4.type() == bloc::Type::NUMERIC ? *a4.numeric() : *a4.integer());
-    return new bloc::Value(bloc::Bool(h->ptex(x, y, dx, dy, just, *a5.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->ptex(x, y, dx, dy, just, *a5.literal()))));
   }
 
   case PLPLOT::Mtex:
@@ -1132,7 +1133,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double disp = (a1.type() == bloc::Type::NUMERIC ? *a1.numeric() : *a1.integer());
     double pos = (a2.type() == bloc::Type::NUMERIC ? *a2.numeric() : *a2.integer());
     double just = (a3.type() == bloc::Type::NUMERIC ? *a3.numeric() : *a3.integer());
-    return new bloc::Value(bloc::Bool(h->mtex(*a0.literal(), disp, pos, just, *a4.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->mtex(*a0.literal(), disp, pos, just, *a4.literal()))));
   }
 
   case PLPLOT::Box:
@@ -1148,7 +1149,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     double xtick = (a1.type() == bloc::Type::NUMERIC ? *a1.numeric() : *a1.integer());
     double ytick = (a4.type() == bloc::Type::NUMERIC ? *a4.numeric() : *a4.integer());
-    return new bloc::Value(bloc::Bool(h->box(*a0.literal(), xtick, (int) *a2.integer(), *a3.literal(), ytick, (int) *a5.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->box(*a0.literal(), xtick, (int) *a2.integer(), *a3.literal(), ytick, (int) *a5.integer()))));
   }
 
   case PLPLOT::Schr:
@@ -1159,7 +1160,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     double def = (a0.type() == bloc::Type::NUMERIC ? *a0.numeric() : *a0.integer());
     double scale = (a1.type() == bloc::Type::NUMERIC ? *a1.numeric() : *a1.integer());
-    return new bloc::Value(bloc::Bool(h->schr(def, scale)));
+    return &(ret = bloc::Value(bloc::Bool(h->schr(def, scale))));
   }
 
   case PLPLOT::String:
@@ -1174,7 +1175,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     size_t n = (x.size() > y.size() ? y.size() : x.size());
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
-    return new bloc::Value(bloc::Bool(h->string((int) n, vx.data, vy.data, *a2.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->string((int) n, vx.data, vy.data, *a2.literal()))));
   }
 
   case PLPLOT::Axes:
@@ -1194,8 +1195,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double y0 = (a1.type() == bloc::Type::NUMERIC ? *a1.numeric() : *a1.integer());
     double xt = (a3.type() == bloc::Type::NUMERIC ? *a3.numeric() : *a3.integer());
     double yt = (a6.type() == bloc::Type::NUMERIC ? *a6.numeric() : *a6.integer());
-    return new bloc::Value(bloc::Bool(h->axes(x0, y0, *a2.literal(), xt, (int) *a4.integer(),
-            *a5.literal(), yt, (int) *a7.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->axes(x0, y0, *a2.literal(), xt, (int) *a4.integer(),
+                *a5.literal(), yt, (int) *a7.integer()))));
   }
 
   case PLPLOT::Bin:
@@ -1210,7 +1211,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     size_t n = (x.size() > y.size() ? y.size() : x.size());
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
-    return new bloc::Value(bloc::Bool(h->bin((int) n, vx.data, vy.data, (int) *a2.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->bin((int) n, vx.data, vy.data, (int) *a2.integer()))));
   }
 
   case PLPLOT::Errx:
@@ -1229,7 +1230,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vmin = PLPLOT::col2taba(xmin, n);
     PLPLOT::TabA<double> vmax = PLPLOT::col2taba(xmax, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
-    return new bloc::Value(bloc::Bool(h->errx((int) n, vmin.data, vmax.data, vy.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->errx((int) n, vmin.data, vmax.data, vy.data))));
   }
 
   case PLPLOT::Erry:
@@ -1248,7 +1249,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vmin = PLPLOT::col2taba(ymin, n);
     PLPLOT::TabA<double> vmax = PLPLOT::col2taba(ymax, n);
-    return new bloc::Value(bloc::Bool(h->errx((int) n, vx.data, vmin.data, vmax.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->errx((int) n, vx.data, vmin.data, vmax.data))));
   }
 
   case PLPLOT::Fill:
@@ -1262,7 +1263,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     size_t n = (x.size() > y.size() ? y.size() : x.size());
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
-    return new bloc::Value(bloc::Bool(h->fill((int) n, vx.data, vy.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->fill((int) n, vx.data, vy.data))));
   }
 
   case PLPLOT::Font:
@@ -1270,7 +1271,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->font((int) *a0.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->font((int) *a0.integer()))));
   }
 
   case PLPLOT::Lsty:
@@ -1278,7 +1279,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->lsty((int) *a0.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->lsty((int) *a0.integer()))));
   }
 
   case PLPLOT::MinMax2dGrid:
@@ -1301,9 +1302,9 @@ bloc::Value * PLPLOTPlugin::executeMethod(
       /* INOUT */
       ctx.storeVariable(args[3]->symbolId(), bloc::Value(bloc::Numeric(zmax)));
       ctx.storeVariable(args[4]->symbolId(), bloc::Value(bloc::Numeric(zmin)));
-      return new bloc::Value(bloc::Bool(true));
+      return &(ret = bloc::Value(bloc::Bool(true)));
     }
-    return new bloc::Value(bloc::Bool(false));
+    return &(ret = bloc::Value(bloc::Bool(false)));
   }
 
   case PLPLOT::W3d:
@@ -1334,8 +1335,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double zmax = (a8.type() == bloc::Type::NUMERIC ? *a8.numeric() : *a8.integer());
     double alt = (a9.type() == bloc::Type::NUMERIC ? *a9.numeric() : *a9.integer());
     double az = (a10.type() == bloc::Type::NUMERIC ? *a10.numeric() : *a10.integer());
-    return new bloc::Value(bloc::Bool(h->w3d(basex, basey, height, xmin, xmax,
-                                             ymin, ymax, zmin, zmax, alt, az)));
+    return &(ret = bloc::Value(bloc::Bool(h->w3d(basex, basey, height, xmin, xmax,
+                                                 ymin, ymax, zmin, zmax, alt, az))));
   }
 
   case PLPLOT::Box3:
@@ -1359,10 +1360,10 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double xtick = (a2.type() == bloc::Type::NUMERIC ? *a2.numeric() : *a2.integer());
     double ytick = (a6.type() == bloc::Type::NUMERIC ? *a6.numeric() : *a6.integer());
     double ztick = (a10.type() == bloc::Type::NUMERIC ? *a10.numeric() : *a10.integer());
-    return new bloc::Value(bloc::Bool(h->box3(
-            *a0.literal(), *a1.literal(), xtick, (int) *a3.integer(),
-            *a4.literal(), *a5.literal(), ytick, (int) *a7.integer(),
-            *a8.literal(), *a9.literal(), ztick, (int) *a11.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->box3(
+                *a0.literal(), *a1.literal(), xtick, (int) *a3.integer(),
+                *a4.literal(), *a5.literal(), ytick, (int) *a7.integer(),
+                *a8.literal(), *a9.literal(), ztick, (int) *a11.integer()))));
   }
 
   case PLPLOT::Mesh:
@@ -1381,7 +1382,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabZ<double> vz = PLPLOT::col2tabz(z, nx, ny);
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, nx);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, ny);
-    return new bloc::Value(bloc::Bool(h->mesh(vx.data, vy.data, vz.data, (int) nx, (int) ny, (int) *a3.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->mesh(vx.data, vy.data, vz.data, (int) nx, (int) ny, (int) *a3.integer()))));
   }
 
   case PLPLOT::Meshc:
@@ -1404,8 +1405,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, nx);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, ny);
     PLPLOT::TabA<double> vc = PLPLOT::col2taba(c, nc);
-    return new bloc::Value(bloc::Bool(h->meshc(vx.data, vy.data, vz.data, (int) nx, (int) ny,
-                                              (int) *a3.integer(), vc.data, nc)));
+    return &(ret = bloc::Value(bloc::Bool(h->meshc(vx.data, vy.data, vz.data, (int) nx, (int) ny,
+                                                  (int) *a3.integer(), vc.data, nc))));
   }
 
   case PLPLOT::Scmap1n:
@@ -1413,7 +1414,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->scmap1n((int) *a0.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->scmap1n((int) *a0.integer()))));
   }
 
   case PLPLOT::Scmap1l:
@@ -1446,7 +1447,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> v2 = PLPLOT::col2taba(c2, n);
     PLPLOT::TabA<double> v3 = PLPLOT::col2taba(c3, n);
     PLPLOT::TabA<bool> vp = PLPLOT::col2tabab(ap, n);
-    return new bloc::Value(bloc::Bool(h->scmap1l(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, vp.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->scmap1l(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, vp.data))));
   }
 
   case PLPLOT::Scmap1l_1:
@@ -1473,7 +1474,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> v1 = PLPLOT::col2taba(c1, n);
     PLPLOT::TabA<double> v2 = PLPLOT::col2taba(c2, n);
     PLPLOT::TabA<double> v3 = PLPLOT::col2taba(c3, n);
-    return new bloc::Value(bloc::Bool(h->scmap1l(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, nullptr)));
+    return &(ret = bloc::Value(bloc::Bool(h->scmap1l(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, nullptr))));
   }
 
   case PLPLOT::Scmap1la:
@@ -1511,7 +1512,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> v3 = PLPLOT::col2taba(c3, n);
     PLPLOT::TabA<double> va = PLPLOT::col2taba(al, n);
     PLPLOT::TabA<bool> vp = PLPLOT::col2tabab(ap, n);
-    return new bloc::Value(bloc::Bool(h->scmap1la(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, va.data, vp.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->scmap1la(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, va.data, vp.data))));
   }
 
   case PLPLOT::Scmap1la_1:
@@ -1544,7 +1545,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> v2 = PLPLOT::col2taba(c2, n);
     PLPLOT::TabA<double> v3 = PLPLOT::col2taba(c3, n);
     PLPLOT::TabA<double> va = PLPLOT::col2taba(al, n);
-    return new bloc::Value(bloc::Bool(h->scmap1la(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, va.data, nullptr)));
+    return &(ret = bloc::Value(bloc::Bool(h->scmap1la(*a0.boolean(), n, vi.data, v1.data, v2.data, v3.data, va.data, nullptr))));
   }
 
   case PLPLOT::String3:
@@ -1564,7 +1565,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
     PLPLOT::TabA<double> vz = PLPLOT::col2taba(z, n);
-    return new bloc::Value(bloc::Bool(h->string3((int) n, vx.data, vy.data, vz.data, *a2.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->string3((int) n, vx.data, vy.data, vz.data, *a2.literal()))));
   }
 
   case PLPLOT::Fill3:
@@ -1583,7 +1584,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
     PLPLOT::TabA<double> vz = PLPLOT::col2taba(z, n);
-    return new bloc::Value(bloc::Bool(h->fill3((int) n, vx.data, vy.data, vz.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->fill3((int) n, vx.data, vy.data, vz.data))));
   }
 
   case PLPLOT::Line3:
@@ -1602,7 +1603,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
     PLPLOT::TabA<double> vz = PLPLOT::col2taba(z, n);
-    return new bloc::Value(bloc::Bool(h->line3((int) n, vx.data, vy.data, vz.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->line3((int) n, vx.data, vy.data, vz.data))));
   }
 
   case PLPLOT::Lightsource:
@@ -1612,7 +1613,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a2 = args[2]->value(ctx);
     if (a0.isNull() || a1.isNull() || a2.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->lightsource(*a0.numeric(), *a1.numeric(), *a2.numeric())));
+    return &(ret = bloc::Value(bloc::Bool(h->lightsource(*a0.numeric(), *a1.numeric(), *a2.numeric()))));
   }
 
   case PLPLOT::Mtex3:
@@ -1624,8 +1625,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a4 = args[4]->value(ctx);
     if (a0.isNull() || a1.isNull() || a2.isNull() || a3.isNull() || a4.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->mtex3(*a0.literal(), *a1.numeric(), *a2.numeric(),
-                                               *a3.numeric(), *a4.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->mtex3(*a0.literal(), *a1.numeric(), *a2.numeric(),
+                                                   *a3.numeric(), *a4.literal()))));
   }
 
   case PLPLOT::Poin:
@@ -1640,7 +1641,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     size_t n = (x.size() > y.size() ? y.size() : x.size());
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
-    return new bloc::Value(bloc::Bool(h->poin((int) n, vx.data, vy.data, (int) *a2.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->poin((int) n, vx.data, vy.data, (int) *a2.integer()))));
   }
 
   case PLPLOT::Poin3:
@@ -1660,7 +1661,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, n);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, n);
     PLPLOT::TabA<double> vz = PLPLOT::col2taba(z, n);
-    return new bloc::Value(bloc::Bool(h->poin3((int) n, vx.data, vy.data, vz.data, (int) *a3.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->poin3((int) n, vx.data, vy.data, vz.data, (int) *a3.integer()))));
   }
 
   case PLPLOT::Ptex3:
@@ -1690,8 +1691,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     double sy = (a7.type() == bloc::Type::NUMERIC ? *a7.numeric() : *a7.integer());
     double sz = (a8.type() == bloc::Type::NUMERIC ? *a8.numeric() : *a8.integer());
     double just = (a9.type() == bloc::Type::NUMERIC ? *a9.numeric() : *a9.integer());
-    return new bloc::Value(bloc::Bool(h->ptex3(wx, wy, wz, dx, dy, dz, sx, sy, sz,
-                                             just, *a10.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->ptex3(wx, wy, wz, dx, dy, dz, sx, sy, sz,
+                                                 just, *a10.literal()))));
   }
 
   case PLPLOT::Plot3d:
@@ -1711,8 +1712,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabZ<double> vz = PLPLOT::col2tabz(z, nx, ny);
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, nx);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, ny);
-    return new bloc::Value(bloc::Bool(h->plot3(vx.data, vy.data, vz.data, (int) nx, (int) ny,
-                                               (int) *a3.integer(), *a4.boolean())));
+    return &(ret = bloc::Value(bloc::Bool(h->plot3(vx.data, vy.data, vz.data, (int) nx, (int) ny,
+                                                   (int) *a3.integer(), *a4.boolean()))));
   }
 
   case PLPLOT::Plot3dc:
@@ -1735,8 +1736,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, nx);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, ny);
     PLPLOT::TabA<double> vc = PLPLOT::col2taba(c, nc);
-    return new bloc::Value(bloc::Bool(h->plot3c(vx.data, vy.data, vz.data, (int) nx, (int) ny,
-                                               (int) *a3.integer(), vc.data, (int) nc)));
+    return &(ret = bloc::Value(bloc::Bool(h->plot3c(vx.data, vy.data, vz.data, (int) nx, (int) ny,
+                                                   (int) *a3.integer(), vc.data, (int) nc))));
   }
 
   case PLPLOT::Prec:
@@ -1745,7 +1746,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     bloc::Value& a1 = args[1]->value(ctx);
     if (a0.isNull() || a1.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(h->prec((int) *a0.integer(), (int) *a1.integer())));
+    return &(ret = bloc::Value(bloc::Bool(h->prec((int) *a0.integer(), (int) *a1.integer()))));
   }
 
   case PLPLOT::Surf3d:
@@ -1768,8 +1769,8 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vx = PLPLOT::col2taba(x, nx);
     PLPLOT::TabA<double> vy = PLPLOT::col2taba(y, ny);
     PLPLOT::TabA<double> vc = PLPLOT::col2taba(c, nc);
-    return new bloc::Value(bloc::Bool(h->surf3(vx.data, vy.data, vz.data, (int) nx, (int) ny,
-                                               (int) *a3.integer(), vc.data, (int) nc)));
+    return &(ret = bloc::Value(bloc::Bool(h->surf3(vx.data, vy.data, vz.data, (int) nx, (int) ny,
+                                                   (int) *a3.integer(), vc.data, (int) nc))));
   }
 
   case PLPLOT::Surf3dl:
@@ -1803,9 +1804,9 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     PLPLOT::TabA<double> vc = PLPLOT::col2taba(c, (nc > 0 ? nc : 1));
     PLPLOT::TabA<int> vymin = PLPLOT::col2tabai(ymin, nx);
     PLPLOT::TabA<int> vymax = PLPLOT::col2tabai(ymax, nx);
-    return new bloc::Value(bloc::Bool(h->surf3l(vx.data, vy.data, vz.data, (int) nx, (int) ny,
-                                                (int) *a3.integer(), vc.data, (int) nc,
-                                                xmin, xmax, vymin.data, vymax.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->surf3l(vx.data, vy.data, vz.data, (int) nx, (int) ny,
+                                                    (int) *a3.integer(), vc.data, (int) nc,
+                                                    xmin, xmax, vymin.data, vymax.data))));
   }
 
   case PLPLOT::Pat:
@@ -1819,7 +1820,7 @@ bloc::Value * PLPLOTPlugin::executeMethod(
     size_t n = (inc.size() > del.size() ? del.size() : inc.size());
     PLPLOT::TabA<int> vi = PLPLOT::col2tabai(inc, n);
     PLPLOT::TabA<int> vd = PLPLOT::col2tabai(del, n);
-    return new bloc::Value(bloc::Bool(h->pat((int) n, vi.data, vd.data)));
+    return &(ret = bloc::Value(bloc::Bool(h->pat((int) n, vi.data, vd.data))));
   }
 
   default:
@@ -177,24 +177,25 @@ void REGEXPlugin::destroyObject(void * object)
   delete regx;
 }
 
-bloc::Value * REGEXPlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * REGEXPlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  regex::Handle * regx = static_cast<regex::Handle*>(object_this.instance());
+  regex::Handle * regx = static_cast<regex::Handle*>(object_this.complex()->instance());
   switch (method_id)
   {
   case regex::Search:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(static_cast<bloc::Collection*>(nullptr));
+      return &(ret = bloc::Value(static_cast<bloc::Collection*>(nullptr)));
     bloc::Collection * c = new bloc::Collection(bloc::Type(bloc::Type::ROWTYPE).levelUp());
     regx->search(*a0.literal(), *c);
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case regex::Replace:
@@ -202,10 +203,10 @@ bloc::Value * REGEXPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     bloc::Value& a1 = args[1]->value(ctx);
     if (a0.isNull() || a1.isNull())
-      return new bloc::Value(bloc::Value::type_literal);
-    bloc::Literal * r = new bloc::Literal();
-    regx->replace(*a0.literal(), *a1.literal(), *r);
-    return new bloc::Value(r);
+      return &(ret = bloc::Value(bloc::Value::type_literal));
+    bloc::Literal r;
+    regx->replace(*a0.literal(), *a1.literal(), r);
+    return &(ret = bloc::Value(std::move(r)));
   }
 
   default:
@@ -223,7 +224,7 @@ void regex::Handle::search(const std::string& str, bloc::Collection& subs)
     bloc::Tuple::container_t items;
     items.push_back(bloc::Value(bloc::Integer(std::distance(str.begin(), sub[i].first))));
     items.push_back(bloc::Value(bloc::Integer(std::distance(sub[i].first, sub[i].second))));
-    items.push_back(bloc::Value(new bloc::Literal(sub[i].str())));
+    items.push_back(bloc::Value(bloc::Literal(sub[i].str())));
     subs.push_back(bloc::Value(new bloc::Tuple(std::move(items))));
   }
 }
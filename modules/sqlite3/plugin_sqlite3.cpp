@@ -22,6 +22,9 @@
 #include <blocc/collection.h>
 #include <blocc/tuple.h>
 #include <blocc/debug.h>
+
+#include <memory>
+#include <climits>
 /*
  * Create the module SQLITE3Import
  */
@@ -60,7 +63,7 @@ static PLUGIN_CTOR ctors[] =
 enum Method
 {
   Open = 0, Close, IsOpen, Query1, Query2, Exec1, Exec2, ErrMsg,
-  Prepare, Bind, Execute, Header, Fetch, Finalize,
+  Prepare, Bind, Execute, Header, Fetch, Finalize, Cursor1, Cursor2, FetchN,
 };
 
 /**********************************************************************/
@@ -84,6 +87,11 @@ static PLUGIN_ARG fetch_args[]   = {
   { PLUGIN_INOUT, { "R", 0 } }, // row
 };
 
+static PLUGIN_ARG fetchn_args[]  = {
+  { PLUGIN_INOUT, { "R", 1 } }, // rows
+  { PLUGIN_IN,    { "I", 0 } }, // count
+};
+
 /**********************************************************************/
 /*  Methods list                                                      */
 /*  id:       name:         ret: decl,ndim  args_count,args:          */
@@ -118,6 +126,16 @@ static PLUGIN_METHOD methods[] =
           "Fetch next row." },
   { Finalize, "finalize", { "B", 0 },     0, nullptr,
           "Close the prepared statement." },
+  { Cursor1,  "cursor",   { "O", 0 },     1, string_args,
+          "Execute the query, and return a new cursor object sharing the\n"
+          "connection to fetch the rows." },
+  { Cursor2,  "cursor",   { "O", 0 },     2, stmt_args,
+          "Execute the query with bound parameters, and return a new cursor\n"
+          "object sharing the connection to fetch the rows." },
+  { FetchN,   "fetch",    { "I", 0 },     2, fetchn_args,
+          "Fetch the next rows into the table, up to the given count, and\n"
+          "return the count of rows fetched, 0 at the end. The storage of the\n"
+          "table is reused from one batch to the next." },
 };
 
 /**
@@ -125,6 +143,7 @@ static PLUGIN_METHOD methods[] =
  */
 struct Handle {
   std::string _path;
+  std::shared_ptr<struct sqlite3> _conn; /* shared with the cursors */
   struct sqlite3 * _db = nullptr;
   struct sqlite3_stmt * _stmt = nullptr;
   enum { STMT_NEW, STMT_ROW, STMT_DONE } _stmt_status = STMT_NEW;
@@ -134,8 +153,6 @@ struct Handle {
   {
     if (_stmt)
       sqlite3_finalize(_stmt);
-    if (_db)
-      sqlite3_close(_db);
   }
   Handle() { }
   int open(const std::string& path);
@@ -152,7 +169,9 @@ struct Handle {
   int execute();
   int header(bloc::Collection ** hd);
   int fetch(bloc::Tuple ** row);
+  int fetch(bloc::Collection& rows, int max, bloc::TupleDecl::Decl& decl);
   int finalize();
+  Handle * cursor();
 };
 
 } /* namespace SQLITE3 */
@@ -213,14 +232,15 @@ void SQLITE3Plugin::destroyObject(void * object)
   delete h;
 }
 
-bloc::Value * SQLITE3Plugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * SQLITE3Plugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  SQLITE3::Handle * h = static_cast<SQLITE3::Handle*>(object_this.instance());
+  SQLITE3::Handle * h = static_cast<SQLITE3::Handle*>(object_this.complex()->instance());
 
   switch (method_id)
   {
@@ -231,16 +251,16 @@ bloc::Value * SQLITE3Plugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (h->isOpen() == 1)
       h->close();
-    return new bloc::Value(bloc::Bool(h->open(*a0.literal())));
+    return &(ret = bloc::Value(bloc::Bool(h->open(*a0.literal()))));
   }
 
   case SQLITE3::Close:
     if (h->isOpen() == 1)
-      return new bloc::Value(bloc::Bool(h->close()));
-    return new bloc::Value(bloc::Bool(0));
+      return &(ret = bloc::Value(bloc::Bool(h->close())));
+    return &(ret = bloc::Value(bloc::Bool(0)));
 
   case SQLITE3::IsOpen:
-    return new bloc::Value(bloc::Bool(h->isOpen()));
+    return &(ret = bloc::Value(bloc::Bool(h->isOpen())));
 
   default:
     if (!h->isOpen())
@@ -257,7 +277,7 @@ bloc::Value * SQLITE3Plugin::executeMethod(
     bloc::Collection * c = nullptr;
     if (!h->query(*a0.literal(), &c))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case SQLITE3::Query2:
@@ -269,7 +289,7 @@ bloc::Value * SQLITE3Plugin::executeMethod(
     bloc::Collection * c = nullptr;
     if (!h->query(*a0.literal(), *a1.tuple(), &c))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case SQLITE3::Exec1:
@@ -279,7 +299,7 @@ bloc::Value * SQLITE3Plugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->exec(*a0.literal()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case SQLITE3::Exec2:
@@ -290,11 +310,11 @@ bloc::Value * SQLITE3Plugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->exec(*a0.literal(), *a1.tuple()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case SQLITE3::ErrMsg:
-    return new bloc::Value(new bloc::Literal(std::string(h->errmsg())));
+    return &(ret = bloc::Value(bloc::Literal(std::string(h->errmsg()))));
 
   case SQLITE3::Prepare:
   {
@@ -303,7 +323,7 @@ bloc::Value * SQLITE3Plugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->prepare(*a0.literal()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case SQLITE3::Bind:
@@ -313,20 +333,20 @@ bloc::Value * SQLITE3Plugin::executeMethod(
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!h->bind(*a0.tuple()))
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case SQLITE3::Execute:
     if (!h->execute())
       throw RuntimeError(EXC_RT_USER_S, h->errmsg());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
 
   case SQLITE3::Header:
   {
     bloc::Collection * c = nullptr;
     if (h->header(&c) != 1)
       throw RuntimeError(EXC_RT_OTHER_S, "No query in progress.");
-    return new bloc::Value(c);
+    return &(ret = bloc::Value(c));
   }
 
   case SQLITE3::Fetch:
@@ -338,11 +358,75 @@ bloc::Value * SQLITE3Plugin::executeMethod(
     int r = h->fetch(&t);
     if (r == 1)
       ctx.storeVariable(args[0]->symbolId(), bloc::Value(t));
-    return new bloc::Value(bloc::Bool(r));
+    return &(ret = bloc::Value(bloc::Bool(r)));
   }
 
   case SQLITE3::Finalize:
-    return new bloc::Value(bloc::Bool(h->finalize()));
+    return &(ret = bloc::Value(bloc::Bool(h->finalize())));
+
+  case SQLITE3::Cursor1:
+  case SQLITE3::Cursor2:
+  {
+    bloc::Value& a0 = args[0]->value(ctx);
+    if (a0.isNull())
+      throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+    bloc::Tuple * binds = nullptr;
+    if (method_id == SQLITE3::Cursor2)
+    {
+      bloc::Value& a1 = args[1]->value(ctx);
+      if (a1.isNull())
+        throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+      binds = a1.tuple();
+    }
+    SQLITE3::Handle * c = h->cursor();
+    if (!c->prepare(*a0.literal()) || (binds && !c->bind(*binds)) || !c->execute())
+    {
+      std::string msg(c->errmsg());
+      delete c;
+      throw RuntimeError(EXC_RT_USER_S, msg.c_str());
+    }
+    return &(ret = bloc::Value(bloc::Complex::newInstance(object_this.complex()->typeId(), c)));
+  }
+
+  case SQLITE3::FetchN:
+  {
+    bloc::Value& a1 = args[1]->value(ctx);
+    if (!args[0]->isVarName() || a1.isNull() || *a1.integer() <= 0)
+      throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
+    int max = (*a1.integer() < INT_MAX ? (int) *a1.integer() : INT_MAX);
+
+    /* INOUT: reuse the storage of the bound table when possible */
+    bloc::Value& var = ctx.loadVariable(args[0]->symbolId()).deref_value();
+    bloc::Collection * tab = nullptr;
+    bool reuse = (var.type() == bloc::Type::ROWTYPE && var.type().level() == 1 && !var.isNull());
+    if (reuse)
+      tab = var.detach().collection();
+    else
+      tab = new bloc::Collection(bloc::Type(bloc::Type::ROWTYPE).levelUp());
+
+    bloc::TupleDecl::Decl decl;
+    int r = h->fetch(*tab, max, decl);
+    if (r < 0)
+    {
+      if (!reuse)
+        delete tab;
+      throw RuntimeError(EXC_RT_USER_S, h->errmsg());
+    }
+    if (!decl.empty() && tab->table_decl() != decl)
+    {
+      /* the declaration of the rows has changed */
+      bloc::Collection::container_t c;
+      c.reserve(tab->size());
+      for (bloc::Value& e : *tab)
+        c.push_back(std::move(e));
+      if (!reuse)
+        delete tab;
+      ctx.storeVariable(args[0]->symbolId(), bloc::Value(new bloc::Collection(decl, 1, std::move(c))));
+    }
+    else if (!reuse)
+      ctx.storeVariable(args[0]->symbolId(), bloc::Value(tab));
+    return &(ret = bloc::Value(bloc::Integer(r)));
+  }
 
   default:
     break;
@@ -352,9 +436,19 @@ bloc::Value * SQLITE3Plugin::executeMethod(
 
 int SQLITE3::Handle::open(const std::string& path)
 {
-  int r = sqlite3_open(path.c_str(), &_db);
+  struct sqlite3 * db = nullptr;
+  int r = sqlite3_open(path.c_str(), &db);
   if (r != SQLITE_OK)
+  {
+    if (db)
+    {
+      _errmsg.assign(sqlite3_errmsg(db));
+      sqlite3_close(db);
+    }
     return 0;
+  }
+  _conn.reset(db, sqlite3_close);
+  _db = db;
   _path.assign(path);
   return 1;
 }
@@ -363,10 +457,88 @@ int SQLITE3::Handle::close()
 {
   if (_stmt)
     sqlite3_finalize(_stmt);
-  int r = sqlite3_close(_db);
+  _stmt = nullptr;
+  /* the connection is closed with the last cursor */
+  _conn.reset();
   _db = nullptr;
   _path.clear();
-  return (r == SQLITE_OK ? 1 : 0);
+  return 1;
+}
+
+SQLITE3::Handle * SQLITE3::Handle::cursor()
+{
+  Handle * c = new Handle();
+  c->_path = _path;
+  c->_conn = _conn;
+  c->_db = _db;
+  return c;
+}
+
+static bloc::Type::TypeMajor _column_type(struct sqlite3_stmt * stmt, int i)
+{
+  switch (sqlite3_column_type(stmt, i))
+  {
+  case SQLITE_INTEGER:
+    return bloc::Type::INTEGER;
+  case SQLITE_FLOAT:
+    return bloc::Type::NUMERIC;
+  case SQLITE_TEXT:
+    return bloc::Type::LITERAL;
+  case SQLITE_BLOB:
+    return bloc::Type::TABCHAR;
+  case SQLITE_NULL:
+    return bloc::Type::NO_TYPE;
+  default:
+    return bloc::Type::COMPLEX;
+  }
+}
+
+/* store the column into the value, reusing its storage when possible */
+static void _column_value(struct sqlite3_stmt * stmt, int i, bloc::Value& v)
+{
+  bool same = (v.type().level() == 0 && !v.isNull());
+  switch (sqlite3_column_type(stmt, i))
+  {
+  case SQLITE_INTEGER:
+    if (same && v.type() == bloc::Type::INTEGER)
+      *v.integer() = sqlite3_column_int64(stmt, i);
+    else
+      v = bloc::Value(bloc::Integer(sqlite3_column_int64(stmt, i)));
+    break;
+  case SQLITE_FLOAT:
+    if (same && v.type() == bloc::Type::NUMERIC)
+      *v.numeric() = sqlite3_column_double(stmt, i);
+    else
+      v = bloc::Value(bloc::Numeric(sqlite3_column_double(stmt, i)));
+    break;
+  case SQLITE_TEXT:
+  {
+    const char * text = (const char*) sqlite3_column_text(stmt, i);
+    int sz = sqlite3_column_bytes(stmt, i);
+    if (same && v.type() == bloc::Type::LITERAL)
+      v.literal()->assign(text, sz);
+    else
+      v = bloc::Value(bloc::Literal(text, sz));
+    break;
+  }
+  case SQLITE_BLOB:
+  {
+    int sz = sqlite3_column_bytes(stmt, i);
+    const char * blob = (const char*) sqlite3_column_blob(stmt, i);
+    if (same && v.type() == bloc::Type::TABCHAR)
+      v.tabchar()->assign(blob, blob + sz);
+    else
+      v = bloc::Value(new bloc::TabChar(blob, blob + sz));
+    break;
+  }
+  case SQLITE_NULL:
+    if (!v.isNull() || v.type() != bloc::Type::NO_TYPE)
+      v = bloc::Value(bloc::Value::type_no_type);
+    break;
+  default:
+    v = bloc::Value(bloc::Value::type_complex);
+    break;
+  }
 }
 
 int SQLITE3::Handle::fetchall(struct sqlite3_stmt * stmt, bloc::Collection ** rs)
@@ -393,7 +565,7 @@ int SQLITE3::Handle::fetchall(struct sqlite3_stmt * stmt, bloc::Collection ** rs
           decl[i] = bloc::Type::NUMERIC;
           break;
         case SQLITE_TEXT:
-          t.push_back(bloc::Value(new bloc::Literal((const char*) sqlite3_column_text(stmt, i))));
+          t.push_back(bloc::Value(bloc::Literal((const char*) sqlite3_column_text(stmt, i))));
           decl[i] = bloc::Type::LITERAL;
           break;
         case SQLITE_BLOB:
@@ -649,27 +821,27 @@ int SQLITE3::Handle::header(bloc::Collection ** hd)
   for (int i = 0; i < sqlite3_column_count(_stmt); ++i)
   {
     std::vector<bloc::Value> t;
-    t.push_back(bloc::Value(new bloc::Literal(sqlite3_column_name(_stmt, i))));
+    t.push_back(bloc::Value(bloc::Literal(sqlite3_column_name(_stmt, i))));
     switch (sqlite3_column_type(_stmt, i))
     {
     case SQLITE_INTEGER:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_INTEGER)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_INTEGER)));
       break;
     case SQLITE_FLOAT:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_NUMERIC)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_NUMERIC)));
       break;
     case SQLITE_TEXT:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_LITERAL)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_LITERAL)));
       break;
     case SQLITE_BLOB:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_TABCHAR)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_TABCHAR)));
       break;
     case SQLITE_NULL:
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_NO_TYPE)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_NO_TYPE)));
       break;
     default:
       /* use complex for unsupported datatype */
-      t.push_back(bloc::Value(new bloc::Literal(bloc::Type::STR_COMPLEX)));
+      t.push_back(bloc::Value(bloc::Literal(bloc::Type::STR_COMPLEX)));
       break;
     }
     if (*hd)
@@ -702,7 +874,7 @@ int SQLITE3::Handle::fetch(bloc::Tuple ** row)
         t.push_back(bloc::Value(bloc::Numeric(sqlite3_column_double(_stmt, i))));
         break;
       case SQLITE_TEXT:
-        t.push_back(bloc::Value(new bloc::Literal((const char*) sqlite3_column_text(_stmt, i))));
+        t.push_back(bloc::Value(bloc::Literal((const char*) sqlite3_column_text(_stmt, i))));
         break;
       case SQLITE_BLOB:
       {
@@ -728,6 +900,76 @@ int SQLITE3::Handle::fetch(bloc::Tuple ** row)
   return 0;
 }
 
+int SQLITE3::Handle::fetch(bloc::Collection& rows, int max, bloc::TupleDecl::Decl& decl)
+{
+  if (_stmt == nullptr || _stmt_status != STMT_ROW)
+  {
+    rows.clear();
+    return 0;
+  }
+  int ncol = sqlite3_column_count(_stmt);
+  if (rows.table_decl().size() == (size_t) ncol)
+    decl = rows.table_decl();
+  else
+    decl = bloc::TupleDecl::Decl(ncol, bloc::Type::NO_TYPE);
+
+  int n = 0;
+  while (n < max && _stmt_status == STMT_ROW)
+  {
+    bloc::Tuple * t = nullptr;
+    if (n < (int) rows.size() && rows[n].type() == bloc::Type::ROWTYPE && !rows[n].isNull())
+    {
+      /* reuse the row when the types of the columns are unchanged */
+      t = rows[n].detach().tuple();
+      if (t->size() != (size_t) ncol)
+        t = nullptr;
+      for (int i = 0; t && i < ncol; ++i)
+      {
+        if (t->tuple_decl()[i] != bloc::Type(_column_type(_stmt, i)))
+          t = nullptr;
+      }
+    }
+    if (t)
+    {
+      for (int i = 0; i < ncol; ++i)
+        _column_value(_stmt, i, t->at(i));
+    }
+    else
+    {
+      bloc::Tuple::container_t items(ncol);
+      for (int i = 0; i < ncol; ++i)
+        _column_value(_stmt, i, items[i]);
+      bloc::Value row(new bloc::Tuple(std::move(items)));
+      if (n < (int) rows.size())
+        rows[n].swap(row);
+      else
+        rows.push_back(std::move(row));
+    }
+    for (int i = 0; i < ncol; ++i)
+    {
+      bloc::Type::TypeMajor m = _column_type(_stmt, i);
+      /* do not upgrade existing type */
+      if (m != bloc::Type::NO_TYPE)
+        decl[i] = m;
+    }
+    ++n;
+    /* fetch next */
+    int r = sqlite3_step(_stmt);
+    if (r != SQLITE_ROW)
+    {
+      _stmt_status = STMT_DONE;
+      if (r != SQLITE_DONE)
+      {
+        _errmsg.assign(sqlite3_errmsg(_db));
+        return -1;
+      }
+    }
+  }
+  if (n < (int) rows.size())
+    rows.erase(rows.begin() + n, rows.end());
+  return n;
+}
+
 int SQLITE3::Handle::finalize()
 {
   if (_stmt)
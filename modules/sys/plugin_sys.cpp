@@ -210,22 +210,23 @@ void SYSPlugin::destroyObject(void * object)
   delete h;
 }
 
-bloc::Value * SYSPlugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * SYSPlugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  sys::Handle * h = static_cast<sys::Handle*>(object_this.instance());
+  sys::Handle * h = static_cast<sys::Handle*>(object_this.complex()->instance());
   switch (method_id)
   {
   case sys::Exec0:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_boolean);
-    return new bloc::Value(bloc::Bool(h->exec(*a0.literal(), ctx.ctxout())));
+      return &(ret = bloc::Value(bloc::Value::type_boolean));
+    return &(ret = bloc::Value(bloc::Bool(h->exec(*a0.literal(), ctx.ctxout()))));
   }
 
   case sys::Exec1:
@@ -233,13 +234,13 @@ bloc::Value * SYSPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     bloc::Value& a2 = args[2]->value(ctx);
     if (a0.isNull() || a2.isNull())
-      return new bloc::Value(bloc::Value::type_boolean);
+      return &(ret = bloc::Value(bloc::Value::type_boolean));
     if (!args[1]->isVarName())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     bloc::Value out(new bloc::TabChar());
     bool success = bloc::Bool(h->execinout(*a0.literal(), nullptr, *out.tabchar(), *a2.integer()));
     ctx.storeVariable(args[1]->symbolId(), std::move(out));
-    return new bloc::Value(success);
+    return &(ret = bloc::Value(success));
   }
 
   case sys::Exec2:
@@ -248,19 +249,19 @@ bloc::Value * SYSPlugin::executeMethod(
     bloc::Value& a1 = args[1]->value(ctx);
     bloc::Value& a3 = args[3]->value(ctx);
     if (a0.isNull() || a3.isNull())
-      return new bloc::Value(bloc::Value::type_boolean);
+      return &(ret = bloc::Value(bloc::Value::type_boolean));
     if (!args[2]->isVarName())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     const char * input = (a1.isNull() ? nullptr : a1.literal()->c_str());
     bloc::Value out(new bloc::TabChar());
     bool success = bloc::Bool(h->execinout(*a0.literal(), input, *out.tabchar(), *a3.integer()));
     ctx.storeVariable(args[2]->symbolId(), std::move(out));
-    return new bloc::Value(success);
+    return &(ret = bloc::Value(success));
   }
 
   case sys::CmdStatus:
   {
-    return new bloc::Value(bloc::Integer(h->_status));
+    return &(ret = bloc::Value(bloc::Integer(h->_status)));
   }
 
   case sys::Setenv:
@@ -268,16 +269,16 @@ bloc::Value * SYSPlugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     bloc::Value& a1 = args[1]->value(ctx);
     if (a0.isNull())
-      return new bloc::Value(bloc::Value::type_literal);
+      return &(ret = bloc::Value(bloc::Value::type_literal));
     bloc::Value old;
     const char * buf = h->getvar(*a0.literal());
     if (buf != nullptr)
-      old.swap(bloc::Value(new bloc::Literal(buf)));
+      old.swap(bloc::Value(bloc::Literal(buf)));
     if (a1.isNull())
       h->unsetvar(*a0.literal());
     else
       h->setvar(*a0.literal(), *a1.literal());
-    return new bloc::Value(std::move(old));
+    return &(ret = bloc::Value(std::move(old)));
   }
 
   case sys::Sleep:
@@ -304,9 +305,9 @@ bloc::Value * SYSPlugin::executeMethod(
           cur += 0.5;
         }
       }
-      return new bloc::Value(bloc::Integer(brk - cur));
+      return &(ret = bloc::Value(bloc::Integer(brk - cur)));
     }
-    return new bloc::Value(bloc::Value::type_integer);
+    return &(ret = bloc::Value(bloc::Value::type_integer));
   }
 
   default:
@@ -192,24 +192,25 @@ void UTF8Plugin::destroyObject(void * object)
   delete u;
 }
 
-bloc::Value * UTF8Plugin::executeMethod(
-          bloc::Complex& object_this,
+bloc::Value * UTF8Plugin::invokeMethod(
+          bloc::Value& object_this,
           int method_id,
           bloc::Context& ctx,
-          const std::vector<bloc::Expression*>& args
+          const std::vector<bloc::Expression*>& args,
+          bloc::Value& ret
           )
 {
-  utf8helper::UTF8String * u = static_cast<utf8helper::UTF8String*>(object_this.instance());
+  utf8helper::UTF8String * u = static_cast<utf8helper::UTF8String*>(object_this.complex()->instance());
   switch (method_id)
   {
   case utf8::Empty:
-    return new bloc::Value(bloc::Bool(u->Empty()));
+    return &(ret = bloc::Value(bloc::Bool(u->Empty())));
 
   case utf8::Size:
-    return new bloc::Value(bloc::Integer(u->Size()));
+    return &(ret = bloc::Value(bloc::Integer(u->Size())));
 
   case utf8::Rawsize:
-    return new bloc::Value(bloc::Integer(u->RawSize()));
+    return &(ret = bloc::Value(bloc::Integer(u->RawSize())));
 
   case utf8::Reserve:
   {
@@ -217,19 +218,19 @@ bloc::Value * UTF8Plugin::executeMethod(
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     u->Reserve(*a0.integer());
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
   }
 
   case utf8::Clear:
     u->Clear();
-    return new bloc::Value(bloc::Bool(true));
+    return &(ret = bloc::Value(bloc::Bool(true)));
 
   case utf8::Append:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (!a0.isNull())
       u->Append(*a0.integer());
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
   }
 
   case utf8::AppendL:
@@ -240,7 +241,7 @@ bloc::Value * UTF8Plugin::executeMethod(
       for (auto& c : *a0.literal())
         u->WriteByte(c);
     }
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
   }
 
   case utf8::ConcatC:
@@ -251,18 +252,18 @@ bloc::Value * UTF8Plugin::executeMethod(
       utf8helper::UTF8String * u0 = static_cast<utf8helper::UTF8String*>(a0.complex()->instance());
       u->Append(u0->Data());
     }
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
   }
 
   case utf8::Tostring:
-    return new bloc::Value(new bloc::Literal(u->ToStdString()));
+    return &(ret = bloc::Value(bloc::Literal(u->ToStdString())));
 
   case utf8::At:
   {
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Integer(u->operator[](*a0.integer())));
+    return &(ret = bloc::Value(bloc::Integer(u->operator[](*a0.integer()))));
   }
 
   case utf8::Remove:
@@ -271,7 +272,7 @@ bloc::Value * UTF8Plugin::executeMethod(
     bloc::Value& a1 = args[1]->value(ctx);
     if (a0.isNull() || a1.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(bloc::Bool(u->Remove((size_t)*a0.integer(), (size_t)*a1.integer())));
+    return &(ret = bloc::Value(bloc::Bool(u->Remove((size_t)*a0.integer(), (size_t)*a1.integer()))));
   }
 
   case utf8::Insert:
@@ -281,8 +282,8 @@ bloc::Value * UTF8Plugin::executeMethod(
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
     if (!a1.isNull())
-      return new bloc::Value(bloc::Bool(u->Insert((size_t)*a0.integer(), (utf8helper::codepoint)*a1.integer())));
-    return new bloc::Value(bloc::Bool(false));
+      return &(ret = bloc::Value(bloc::Bool(u->Insert((size_t)*a0.integer(), (utf8helper::codepoint)*a1.integer()))));
+    return &(ret = bloc::Value(bloc::Bool(false)));
   }
 
   case utf8::InsertC:
@@ -294,9 +295,9 @@ bloc::Value * UTF8Plugin::executeMethod(
     if (!a1.isNull())
     {
       utf8helper::UTF8String * u1 = static_cast<utf8helper::UTF8String*>(a1.complex()->instance());
-      return new bloc::Value(bloc::Integer(u->Insert((size_t)*a0.integer(), u1->Data())));
+      return &(ret = bloc::Value(bloc::Integer(u->Insert((size_t)*a0.integer(), u1->Data()))));
     }
-    return new bloc::Value(bloc::Integer(0));
+    return &(ret = bloc::Value(bloc::Integer(0)));
   }
 
   case utf8::Substr1:
@@ -304,7 +305,7 @@ bloc::Value * UTF8Plugin::executeMethod(
     bloc::Value& a0 = args[0]->value(ctx);
     if (a0.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(new bloc::Literal(u->Substr((size_t)*a0.integer())));
+    return &(ret = bloc::Value(bloc::Literal(u->Substr((size_t)*a0.integer()))));
   }
 
   case utf8::Substr2:
@@ -313,28 +314,28 @@ bloc::Value * UTF8Plugin::executeMethod(
     bloc::Value& a1 = args[1]->value(ctx);
     if (a0.isNull() || a1.isNull())
       throw RuntimeError(EXC_RT_OTHER_S, "Invalid arguments.");
-    return new bloc::Value(new bloc::Literal(u->Substr((size_t)*a0.integer(), (size_t)*a1.integer())));
+    return &(ret = bloc::Value(bloc::Literal(u->Substr((size_t)*a0.integer(), (size_t)*a1.integer()))));
   }
 
   case utf8::Tolower:
     u->Transform(utf8helper::TransformLower);
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
 
   case utf8::Toupper:
     u->Transform(utf8helper::TransformUpper);
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
 
   case utf8::Normaliz:
     u->Transform(utf8helper::TransformNormalize);
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
 
   case utf8::Capital:
     u->Transform(utf8helper::TransformCapitalize);
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
 
   case utf8::Translit:
     u->Transform(utf8helper::TransformTransliterate);
-    return new bloc::Value(new bloc::Complex(object_this));
+    return &object_this;
 
   }
   return nullptr;
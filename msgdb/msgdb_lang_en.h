@@ -2435,7 +2435,73 @@ static const unsigned char msgdb_en_d31d6f54_txt[] = {
   0x0a, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20,
   0x74, 0x61, 0x62, 0x6c, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
   0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x74, 0x2e, 0x0a };
+  0x73, 0x74, 0x61, 0x6e, 0x74, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20,
+  0x72, 0x6f, 0x77, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20,
+  0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x24,
+  0x24, 0x50, 0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45, 0x4c, 0x24, 0x24, 0x2e,
+  0x0a };
+
+static const unsigned char msgdb_en_1519a001_txt[] = {
+  0x54, 0x68, 0x65, 0x20, 0x50, 0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45, 0x4c,
+  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x24, 0x24, 0x46, 0x4f, 0x52, 0x41, 0x4c, 0x4c, 0x24, 0x24, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x64, 0x69,
+  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x0a, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x6d, 0x6f, 0x6e,
+  0x67, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x20, 0x77,
+  0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x72, 0x6f, 0x77, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x65, 0x74,
+  0x63, 0x68, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x2e, 0x0a, 0x0a, 0x66, 0x6f, 0x72, 0x61,
+  0x6c, 0x6c, 0x20, 0x7b, 0x76, 0x61, 0x72, 0x7d, 0x20, 0x69, 0x6e, 0x20,
+  0x7b, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+  0x73, 0x73, 0x69, 0x6f, 0x6e, 0x7d, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c,
+  0x6c, 0x65, 0x6c, 0x20, 0x5b, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20,
+  0x7b, 0x76, 0x61, 0x72, 0x7d, 0x20, 0x5b, 0x2c, 0x20, 0x2e, 0x2e, 0x2e,
+  0x5d, 0x5d, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x5b, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x2e,
+  0x2e, 0x2e, 0x5d, 0x0a, 0x65, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 0x6f, 0x70,
+  0x3b, 0x0a, 0x0a, 0x49, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x6f, 0x6e,
+  0x6c, 0x79, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x0a, 0x61, 0x6e, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
+  0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x41, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+  0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x69, 0x76,
+  0x61, 0x74, 0x65, 0x0a, 0x74, 0x6f, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x2e, 0x20, 0x41, 0x20, 0x76, 0x61,
+  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65,
+  0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x75, 0x73, 0x74,
+  0x20, 0x62, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x3a,
+  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72,
+  0x20, 0x73, 0x75, 0x6d, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x0a, 0x61,
+  0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x63, 0x6f, 0x70,
+  0x79, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x2c, 0x20, 0x74, 0x68,
+  0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69,
+  0x61, 0x6c, 0x20, 0x73, 0x75, 0x6d, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x0a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x74,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x2e, 0x0a, 0x42, 0x52,
+  0x45, 0x41, 0x4b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x52, 0x45, 0x54, 0x55,
+  0x52, 0x4e, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x74,
+  0x6f, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x2e,
+  0x0a };
+
+static const unsigned char msgdb_en_ee5f086c_txt[] = {
+  0x53, 0x65, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x24, 0x24, 0x50, 0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45, 0x4c,
+  0x24, 0x24, 0x2e, 0x0a };
 
 static const unsigned char msgdb_en_d4e7f45a_txt[] = {
   0x54, 0x68, 0x65, 0x20, 0x24, 0x24, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49,
@@ -2810,7 +2876,7 @@ static const MSGDB_KEYWORD_ROW msgdb_en_kw_statement[] = {
   { "end loop", 101, msgdb_en_b1ba2ca5_txt },
   { "exception", 785, msgdb_en_77d6cf63_txt },
   { "for", 678, msgdb_en_94a3aa3b_txt },
-  { "forall", 475, msgdb_en_d31d6f54_txt },
+  { "forall", 541, msgdb_en_d31d6f54_txt },
   { "function", 889, msgdb_en_d4e7f45a_txt },
   { "if", 437, msgdb_en_04811503_txt },
   { "import", 392, msgdb_en_d9f7dbcf_txt },
@@ -2820,9 +2886,11 @@ static const MSGDB_KEYWORD_ROW msgdb_en_kw_statement[] = {
   { "let", 239, msgdb_en_94a3c279_txt },
   { "loop", 80, msgdb_en_291c3bee_txt },
   { "nop", 36, msgdb_en_94a3cc41_txt },
+  { "parallel", 625, msgdb_en_1519a001_txt },
   { "print", 206, msgdb_en_4ceda781_txt },
   { "put", 228, msgdb_en_94a3d58d_txt },
   { "raise", 136, msgdb_en_4d0886a8_txt },
+  { "reduce", 28, msgdb_en_ee5f086c_txt },
   { "return", 305, msgdb_en_ee67d074_txt },
   { "then", 37, msgdb_en_29207fe3_txt },
   { "to", 23, msgdb_en_04811677_txt },
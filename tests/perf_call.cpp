@@ -0,0 +1,276 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/functor_manager.h>
+#include <blocc/tuple.h>
+
+/* count the heap allocations, including the ones done by the library */
+static unsigned long g_allocs = 0;
+
+void * operator new(std::size_t n)
+{
+  ++g_allocs;
+  void * p = std::malloc(n);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("perf 1M function calls")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function sq(x) return integer is begin return x * x; end;\n"
+          "n = 0;\n"
+          "for i in 1 to 1000000 loop n = n + sq(i % 100); end loop;\n"
+          "return n;"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "1M function calls in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 3283500000 );
+  delete r;
+}
+
+TEST_CASE("recursive call without heap allocation")
+{
+  ctx.purge();
+  Executable * x;
+  ctx.reset(
+          "function fib(n) return integer is begin\n"
+          "if n < 2 then return n; end if;\n"
+          "return fib(n - 1) + fib(n - 2);\n"
+          "end;"
+  );
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+
+  Expression * e;
+  ctx.reset("fib(15)");
+  e = ctx.parseExpression();
+  /* warm up the frames */
+  Integer r = *(e->value(ctx).integer());
+  ctx.purgeWorkingMemory();
+  REQUIRE( r == 610 );
+  unsigned long allocs = g_allocs;
+  for (int i = 0; i < 100; ++i)
+  {
+    Integer v = *(e->value(ctx).integer());
+    ctx.purgeWorkingMemory();
+    REQUIRE( v == r );
+  }
+  REQUIRE( g_allocs == allocs );
+  delete e;
+  /* a frame by depth of recursion */
+  unsigned id = ctx.functorManager().findDeclaration("FIB", 1);
+  REQUIRE( ctx.functorManager().getDeclaration(id).frames.size() == 15 );
+  REQUIRE( ctx.functorManager().getDeclaration(id).depth == 0 );
+}
+
+TEST_CASE("call in the arguments of a call")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function f(a, b) return integer is begin return a * 10 + b; end;\n"
+          "return f(f(1, 2), f(3, f(4, 5)));"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 195 );
+  delete r;
+}
+
+TEST_CASE("frames are released on error")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function g(n) return integer is begin\n"
+          "if n == 0 then return 1 / n; end if;\n"
+          "return g(n - 1) + 1;\n"
+          "end;\n"
+          "function h(n) return integer is begin if n > 0 then return n; end if; end;\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+
+  ctx.reset("a = g(5);");
+  e = ctx.parse();
+  try { e->run(); delete e; FAIL("No throw"); }
+  catch(RuntimeError& re) { delete e; REQUIRE( re.no == EXC_RT_DIVIDE_BY_ZERO ); }
+  unsigned id = ctx.functorManager().findDeclaration("G", 1);
+  REQUIRE( ctx.functorManager().getDeclaration(id).depth == 0 );
+
+  /* the value returned by a previous call is not returned again */
+  ctx.reset("a = h(3), b = h(0), c = g(-1);");
+  e = ctx.parse();
+  try { e->run(); delete e; FAIL("No throw"); }
+  catch(RuntimeError& re) { delete e; REQUIRE( re.no == EXC_RT_RECURSION_LIMIT ); }
+  REQUIRE( *(ctx.loadVariable("A")->integer()) == 3 );
+  REQUIRE( ctx.loadVariable("B")->isNull() );
+  REQUIRE( ctx.functorManager().getDeclaration(id).depth == 0 );
+}
+
+TEST_CASE("call in tail position")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function sum(n, acc) return integer is begin\n"
+          "if n == 0 then return acc; end if;\n"
+          "return sum(n - 1, acc + n);\n"
+          "end;\n"
+          "return sum(100000, 0);"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 5000050000 );
+  delete r;
+  /* the frames are swapped, not stacked */
+  unsigned id = ctx.functorManager().findDeclaration("SUM", 2);
+  REQUIRE( ctx.functorManager().getDeclaration(id).frames.size() == 2 );
+  REQUIRE( ctx.functorManager().getDeclaration(id).depth == 0 );
+}
+
+TEST_CASE("call in tail position under an exception handler")
+{
+  ctx.purge();
+  Executable * e;
+  /* the error of the innermost call is caught by the block of its caller */
+  ctx.reset(
+          "function k(n) return integer is begin\n"
+          "if n == 0 then return 1 / n; end if;\n"
+          "begin return k(n - 1); exception when divide_by_zero then return n; end;\n"
+          "end;\n"
+          "return k(5);"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 1 );
+  delete r;
+  unsigned id = ctx.functorManager().findDeclaration("K", 1);
+  REQUIRE( ctx.functorManager().getDeclaration(id).frames.size() == 6 );
+  REQUIRE( ctx.functorManager().getDeclaration(id).depth == 0 );
+}
+
+TEST_CASE("stack budget of the calls")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function deep(n) return integer is begin\n"
+          "if n == 0 then return 0; end if;\n"
+          "return deep(n - 1) + 1;\n"
+          "end;\n"
+          "function sum(n, acc) return integer is begin\n"
+          "if n == 0 then return acc; end if;\n"
+          "return sum(n - 1, acc + n);\n"
+          "end;\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+
+  Expression * x;
+  ctx.reset("deep(1000)");
+  x = ctx.parseExpression();
+  REQUIRE( *(x->value(ctx).integer()) == 1000 );
+  ctx.stackBudget(0x4000);
+  try { x->value(ctx); delete x; FAIL("No throw"); }
+  catch(RuntimeError& re) { delete x; REQUIRE( re.no == EXC_RT_RECURSION_LIMIT ); }
+  unsigned id = ctx.functorManager().findDeclaration("DEEP", 1);
+  REQUIRE( ctx.functorManager().getDeclaration(id).depth == 0 );
+
+  /* the calls in tail position do not use more stack */
+  ctx.reset("sum(10000, 0)");
+  x = ctx.parseExpression();
+  REQUIRE( *(x->value(ctx).integer()) == 50005000 );
+  delete x;
+  ctx.stackBudget(STACK_BUDGET);
+}
+
+TEST_CASE("perf ackermann")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function ack(m, n) return integer is begin\n"
+          "if m == 0 then return n + 1; end if;\n"
+          "if n == 0 then return ack(m - 1, 1); end if;\n"
+          "return ack(m - 1, ack(m, n - 1));\n"
+          "end;\n"
+          "return ack(3, 6);"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "ackermann(3, 6) in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 509 );
+  delete r;
+}
+
+TEST_CASE("perf tree walk")
+{
+  ctx.purge();
+  Executable * e;
+  /* the nodes are stored in a table, with the index of the children */
+  ctx.reset(
+          "function walk(t, i) return integer is begin\n"
+          "if i < 0 then return 0; end if;\n"
+          "n = t.at(i);\n"
+          "return n@1 + walk(t, n@2) + walk(t, n@3);\n"
+          "end;\n"
+          "t = tab(0, tup(0, 0, 0));\n"
+          "for i in 0 to 65534 loop\n"
+          "l = 2 * i + 1; r = l + 1;\n"
+          "if l > 65534 then l = -1; r = -1; end if;\n"
+          "t.concat(tup(i, l, r));\n"
+          "end loop;\n"
+          /* a degenerated tree */
+          "u = tab(0, tup(0, 0, 0));\n"
+          "for i in 0 to 1999 loop u.concat(tup(i, -1, i + 1)); end loop;\n"
+          "u.at(1999).set@3(-1);\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  ctx.reset("return tup(walk(t, 0), walk(u, 0));");
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "walk of 65535 nodes in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->tuple()->at(0).integer()) == 2147385345 );
+  REQUIRE( *(r->tuple()->at(1).integer()) == 1999000 );
+  delete r;
+}
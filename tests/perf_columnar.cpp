@@ -0,0 +1,153 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/collection.h>
+#include <blocc/tuple.h>
+
+/* count the bytes allocated on the heap */
+static unsigned long g_bytes = 0;
+
+void * operator new(std::size_t n)
+{
+  g_bytes += n;
+  void * p = std::malloc(n);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+TestingContext ctx;
+
+using namespace bloc;
+
+#define ROWS 1000000
+
+/* declare the table, and fill it with the given count of rows */
+static Collection * fill_table(const char * name, unsigned count, bool columnar)
+{
+  Executable * x;
+  std::string text(name);
+  text.append(" = tab(0, tup(0, \"\", 0.0, true));");
+  ctx.reset(text);
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Collection * c = ctx.loadVariable(name)->collection();
+  if (columnar)
+    REQUIRE( c->make_columnar() );
+  c->reserve(count);
+  Collection::container_t row;
+  for (unsigned i = 0; i < count; ++i)
+  {
+    row.reserve(4);
+    row.push_back(Value(Integer(i)));
+    row.push_back(Value(Literal("row")));
+    row.push_back(Value(Numeric(i) / 2));
+    row.push_back((i % 3) ? Value(Bool(i % 2)) : Value(Value::type_boolean));
+    c->push_row(row);
+  }
+  return c;
+}
+
+TEST_CASE("columnar table")
+{
+  ctx.purge();
+  Collection * c = fill_table("T", 10, true);
+  REQUIRE( c->columnar() );
+  REQUIRE( c->size() == 10 );
+  /* rows are made on demand */
+  Value r = c->row(3);
+  REQUIRE( *(r.tuple()->at(0).integer()) == 3 );
+  REQUIRE( r.tuple()->at(1).literal()->compare("row") == 0 );
+  REQUIRE( r.tuple()->at(3).isNull() );
+  REQUIRE( r.tuple()->tuple_decl() == c->table_decl() );
+  REQUIRE( c->columnar() );
+  /* a tuple of the declared type is appended by column */
+  Collection::container_t items;
+  items.push_back(Value(Integer(10)));
+  items.push_back(Value(Literal("last")));
+  items.push_back(Value(Numeric(5.0)));
+  items.push_back(Value(Bool(true)));
+  c->push_back(Value(new Tuple(std::move(items))));
+  REQUIRE( c->columnar() );
+  REQUIRE( c->size() == 11 );
+  /* an access by reference converts the table */
+  REQUIRE( c->at(10).tuple()->at(1).literal()->compare("last") == 0 );
+  REQUIRE( !c->columnar() );
+  REQUIRE( c->size() == 11 );
+  REQUIRE( *(c->at(3).tuple()->at(0).integer()) == 3 );
+}
+
+TEST_CASE("update of a columnar table")
+{
+  ctx.purge();
+  fill_table("T", 10, true);
+  Executable * e;
+  ctx.reset(
+          "U = T;\n"
+          "n = 0;\n"
+          "forall r in T loop n = n + r@1; r.set@1(r@1 * 2); r.set@2(\"r\" + str(r@1)); end loop;\n"
+          "x = T.at(9); m = 0;\n"
+          "forall r in T loop forall q in T loop if q@1 == r@1 then m = m + 1; end if; end loop; end loop;\n"
+          "return tup(n, T.at(4)@1, T.at(4)@2, U.at(4)@1, x@1, m);"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  REQUIRE( *(t.at(0).integer()) == 45 );
+  REQUIRE( *(t.at(1).integer()) == 8 );
+  REQUIRE( t.at(2).literal()->compare("r8") == 0 );
+  REQUIRE( *(t.at(3).integer()) == 4 );
+  REQUIRE( *(t.at(4).integer()) == 18 );
+  REQUIRE( *(t.at(5).integer()) == 10 );
+  delete r;
+}
+
+TEST_CASE("perf columnar table")
+{
+  ctx.purge();
+  unsigned long bytes = g_bytes;
+  Collection * rows = fill_table("R", ROWS, false);
+  double rows_mem = double(g_bytes - bytes) / ROWS;
+  bytes = g_bytes;
+  Collection * cols = fill_table("C", ROWS, true);
+  double cols_mem = double(g_bytes - bytes) / ROWS;
+  REQUIRE( !rows->columnar() );
+  REQUIRE( cols->columnar() );
+  std::cout << "memory per row: " << rows_mem << " bytes by row, "
+          << cols_mem << " bytes by column" << std::endl;
+  REQUIRE( cols_mem < rows_mem );
+
+  Executable * e;
+  Integer expected = Integer(ROWS) * (ROWS - 1) / 2;
+  for (const char * name : { "R", "C" })
+  {
+    ctx.reset(std::string("n = 0; forall e in ").append(name)
+            .append(" loop n = n + e@1; end loop; return n;"));
+    e = ctx.parse();
+    double ts = ctx.timestamp();
+    REQUIRE( e->run() == 0 );
+    double elapsed = ctx.elapsed(ts);
+    std::cout << "scan of 1M rows stored by " << (name[0] == 'R' ? "row" : "column")
+            << " in " << elapsed << " sec" << std::endl;
+    delete e;
+    Value * r = ctx.dropReturned();
+    REQUIRE( *(r->integer()) == expected );
+    ctx.returnCondition(false);
+    delete r;
+  }
+  /* the scan does not convert the table */
+  REQUIRE( ctx.loadVariable("C")->collection()->columnar() );
+}
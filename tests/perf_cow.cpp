@@ -0,0 +1,123 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/tuple.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("perf passing a large table to a function")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function f(t) return integer is begin\n"
+          "return t.count() + t.at(t.count() - 1);\n"
+          "end;\n"
+          "t = tab(1000000, 1);\n"
+          "n = 0;\n"
+          "for i in 1 to 1000 loop n = n + f(t); end loop;\n"
+          "return n;"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "1000 calls with a 1M table in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 1000001000 );
+  delete r;
+}
+
+TEST_CASE("update of a table passed to a function")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function f(t) return integer is begin\n"
+          "t.put(0, 5); return t.at(0);\n"
+          "end;\n"
+          "t = tab(10, 0);\n"
+          "r = f(t);\n"
+          "return tup(r, t.at(0));"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->tuple()->at(0).integer()) == 5 );
+  REQUIRE( *(r->tuple()->at(1).integer()) == 0 );
+  delete r;
+}
+
+TEST_CASE("update of a shared copy")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "t = tab(10, tup(\"abcd\", 1));\n"
+          "u = t;\n"
+          "u.put(1, tup(\"efgh\", 2));\n"
+          "v = t; v.at(2).set@2(3);\n"
+          "w = u; w.delete(0); w.concat(tup(\"ijkl\", 4));\n"
+          "return tup(t.at(1)@1, t.at(2)@2, u.at(1)@1, v.at(2)@2, u.count(), w.at(9)@1, u.at(9)@1);"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  REQUIRE( t.at(0).literal()->compare("abcd") == 0 );
+  REQUIRE( *(t.at(1).integer()) == 1 );
+  REQUIRE( t.at(2).literal()->compare("efgh") == 0 );
+  REQUIRE( *(t.at(3).integer()) == 3 );
+  REQUIRE( *(t.at(4).integer()) == 10 );
+  REQUIRE( t.at(5).literal()->compare("ijkl") == 0 );
+  REQUIRE( t.at(6).literal()->compare("abcd") == 0 );
+  delete r;
+}
+
+TEST_CASE("update of a nested table")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "t = tab(2, tab(2, 0));\n"
+          "u = t;\n"
+          "u.at(0).put(1, 7);\n"
+          "return tup(t.at(0).at(1), u.at(0).at(1), u.at(1).at(1));"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->tuple()->at(0).integer()) == 0 );
+  REQUIRE( *(r->tuple()->at(1).integer()) == 7 );
+  REQUIRE( *(r->tuple()->at(2).integer()) == 0 );
+  delete r;
+}
+
+TEST_CASE("forall over a shared table")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "t = tab(5, 1);\n"
+          "u = t;\n"
+          "forall e in u loop e = e + 1; end loop;\n"
+          "n = 0; forall e in t loop n = n + e; end loop;\n"
+          "m = 0; forall e in u loop m = m + e; end loop;\n"
+          "return tup(n, m);"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->tuple()->at(0).integer()) == 5 );
+  REQUIRE( *(r->tuple()->at(1).integer()) == 10 );
+  delete r;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <complex>
+
+#include <test.h>
+#include <hashvalue.c>
+
+/* count the heap allocations, including the ones done by the library */
+static unsigned long g_allocs = 0;
+
+void * operator new(std::size_t n)
+{
+  ++g_allocs;
+  void * p = std::malloc(n);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("perf 200k complex iterations")
+{
+  Executable * e;
+  ctx.reset(
+          "c = -0.4 + 0.6 * ii; z = 0 * ii; n = 0;\n"
+          "for i in 1 to 200000 loop\n"
+          "z = z * z + c;\n"
+          "if abs(z) > 2.0 then z = 0 * ii; n = n + 1; end if;\n"
+          "end loop;\nreturn n;"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+
+  /* same computation */
+  Integer n = 0;
+  double za = 0.0, zb = 0.0;
+  for (int i = 1; i <= 200000; ++i)
+  {
+    double a = za * za - zb * zb;
+    double b = za * zb + zb * za;
+    za = a + (-0.4);
+    zb = b + 0.6;
+    if (std::abs(std::complex<double>(za, zb)) > 2.0)
+    {
+      za = zb = 0.0;
+      ++n;
+    }
+  }
+  REQUIRE( *(r->integer()) == n );
+  delete r;
+}
+
+TEST_CASE("complex arithmetic without heap allocation")
+{
+  Expression * e;
+  Symbol& z = ctx.registerSymbol("Z", Type::IMAGINARY);
+  ctx.storeVariable(z.id(), Value(Imaginary{0.5, -1.5}));
+  Symbol& w = ctx.registerSymbol("W", Type::IMAGINARY);
+  ctx.storeVariable(w.id(), Value(Imaginary{-2.0, 0.25}));
+  ctx.reset("(z * w + 3 * z - w / 2.0) / (z - w) ** 2 + sqrt(z)");
+  e = ctx.parseExpression();
+  /* warm up the working memory */
+  Imaginary r = *(e->value(ctx).imaginary());
+  ctx.purgeWorkingMemory();
+  unsigned long allocs = g_allocs;
+  for (int i = 0; i < 100000; ++i)
+  {
+    Imaginary x = *(e->value(ctx).imaginary());
+    ctx.purgeWorkingMemory();
+    REQUIRE( (x.a == r.a && x.b == r.b) );
+  }
+  REQUIRE( g_allocs == allocs );
+  delete e;
+}
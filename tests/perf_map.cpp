@@ -0,0 +1,65 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/hashmap.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+#define ENTRIES 10000000
+
+TEST_CASE("perf 10M inserts and lookups")
+{
+  HashMap m(HashMap::make_type(Value::type_integer, Value::type_integer));
+  Value key(Integer(0));
+  Value val(Integer(0));
+  double ts = ctx.timestamp();
+  for (Integer i = 0; i < ENTRIES; ++i)
+  {
+    *key.integer() = i;
+    *val.integer() = i;
+    m.store(m.insert(key), val);
+  }
+  std::cout << "10M inserts in " << ctx.elapsed(ts) << " sec" << std::endl;
+  REQUIRE( m.size() == ENTRIES );
+
+  Integer n = 0;
+  ts = ctx.timestamp();
+  for (Integer i = 0; i < ENTRIES; ++i)
+  {
+    *key.integer() = (i * 7) % ENTRIES;
+    size_t pos = m.find(key);
+    if (pos != HashMap::npos)
+    {
+      m.value(pos, val);
+      n += *val.integer();
+    }
+  }
+  std::cout << "10M lookups in " << ctx.elapsed(ts) << " sec" << std::endl;
+  REQUIRE( n == Integer(ENTRIES) * (ENTRIES - 1) / 2 );
+}
+
+TEST_CASE("perf 1M string keys in script")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "m = map(\"\", 0);\n"
+          "for i in 1 to 1000000 loop m.put(str(i), i); end loop;\n"
+          "n = 0;\n"
+          "for i in 1 to 1000000 loop n = n + m.at(str(i)); end loop;\n"
+          "return n;"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "1M inserts and lookups of string keys in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == Integer(1000000) * 1000001 / 2 );
+  delete r;
+}
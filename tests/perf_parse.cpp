@@ -0,0 +1,107 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <climits>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/functor_manager.h>
+#include <blocc/exception_parse.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+#define SYMBOL_COUNT    50000
+#define FUNCTOR_COUNT   500
+
+TEST_CASE("perf parse 50000 symbols")
+{
+  ctx.purge();
+  Executable * e;
+  std::string text;
+  for (int i = 0; i < FUNCTOR_COUNT; ++i)
+  {
+    text.append("function f").append(std::to_string(i)).append("(a) return integer is\n")
+        .append("begin return a + ").append(std::to_string(i)).append("; end;\n");
+  }
+  for (int i = 0; i < SYMBOL_COUNT; ++i)
+  {
+    text.append("v").append(std::to_string(i)).append(" = ")
+        .append(std::to_string(i)).append(";\n");
+  }
+  /* resolve names declared at both ends of the tables */
+  text.append("return v0 + v").append(std::to_string(SYMBOL_COUNT - 1))
+      .append(" + f0(1) + f").append(std::to_string(FUNCTOR_COUNT - 1)).append("(1);");
+  ctx.reset(text);
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == (SYMBOL_COUNT - 1) + 1 + FUNCTOR_COUNT );
+  delete r;
+
+  /* lookup by name as done by the API */
+  for (int i = 0; i < SYMBOL_COUNT; ++i)
+  {
+    Value * v = ctx.loadVariable(std::string("V").append(std::to_string(i)));
+    REQUIRE( v != nullptr );
+    REQUIRE( *(v->integer()) == i );
+  }
+  REQUIRE( ctx.functorManager().declarations().size() == FUNCTOR_COUNT );
+  for (int i = 0; i < FUNCTOR_COUNT; ++i)
+    REQUIRE( ctx.functorManager().findDeclaration(std::string("F").append(std::to_string(i)), 1) == unsigned(i) );
+}
+
+TEST_CASE("name resolution after clone and purge")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset("function f(a) return integer is begin return a * 2; end;\na = 1, b = 2;\n");
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+
+  Context * other = ctx.clone();
+  REQUIRE( other->loadVariable("B") != nullptr );
+  REQUIRE( other->functorManager().findDeclaration("F", 1) == 0 );
+  REQUIRE( other->functorManager().nameExists("F") );
+  delete other;
+
+  ctx.purge();
+  REQUIRE( ctx.loadVariable("A") == nullptr );
+  REQUIRE( ctx.findSymbol("B") == nullptr );
+  REQUIRE( ctx.functorManager().findDeclaration("F", 1) == unsigned(FunctorManager::nid) );
+  REQUIRE( !ctx.functorManager().nameExists("F") );
+}
+
+TEST_CASE("name resolution after rollback")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function f(a) return integer is begin return a * 2; end;\n"
+          "function g(a) return integer is begin return a * 3; end;\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+
+  /* failed replacement of a declaration which is not the last */
+  ctx.reset("function f(a) return integer is begin return a +; end;\n");
+  try { e = ctx.parse(); delete e; FAIL("No throw"); }
+  catch (ParseError& pe) { SUCCEED(pe.what()); }
+  /* failed creation */
+  ctx.reset("function h(a, b) return integer is begin return a +; end;\n");
+  try { e = ctx.parse(); delete e; FAIL("No throw"); }
+  catch (ParseError& pe) { SUCCEED(pe.what()); }
+
+  REQUIRE( !ctx.functorManager().nameExists("H") );
+  REQUIRE( ctx.functorManager().findDeclaration("G", 1) == 1 );
+  ctx.reset("a = f(5), b = g(5);\n");
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  REQUIRE( *(ctx.loadVariable("A")->integer()) == 10 );
+  REQUIRE( *(ctx.loadVariable("B")->integer()) == 15 );
+}
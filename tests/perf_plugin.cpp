@@ -0,0 +1,86 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+
+#include <test.h>
+#include <hashvalue.c>
+
+/* count the heap allocations, including the ones done by the library */
+static unsigned long g_allocs = 0;
+
+void * operator new(std::size_t n)
+{
+  ++g_allocs;
+  void * p = std::malloc(n);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("perf 1M method calls")
+{
+  Executable * e;
+  /* importing from a path is restricted */
+  ctx.trusted(true);
+  ctx.reset(
+          "import \"" TEST_MODULE_UTF8 "\";\n"
+          "u = utf8(\"abcdef\"); n = 0;\n"
+          "for i in 1 to 1000000 loop n = n + u.count(); end loop;\n"
+          "return n;"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "1M method calls in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 6000000 );
+  delete r;
+}
+
+TEST_CASE("method call without heap allocation")
+{
+  Executable * x;
+  ctx.reset(
+          "import \"" TEST_MODULE_UTF8 "\";\n"
+          "u = utf8(\"abcdef\");"
+  );
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+
+  Expression * e;
+  ctx.reset("u.count() + u.at(2) + u.rawsize()");
+  e = ctx.parseExpression();
+  /* warm up the working memory */
+  Integer r = *(e->value(ctx).integer());
+  ctx.purgeWorkingMemory();
+  REQUIRE( r == 6 + 'c' + 6 );
+  unsigned long allocs = g_allocs;
+  for (int i = 0; i < 100000; ++i)
+  {
+    Integer v = *(e->value(ctx).integer());
+    ctx.purgeWorkingMemory();
+    REQUIRE( v == r );
+  }
+  REQUIRE( g_allocs == allocs );
+  delete e;
+
+  /* the method returning the object itself */
+  ctx.reset("u.toupper().tolower().count()");
+  e = ctx.parseExpression();
+  REQUIRE( *(e->value(ctx).integer()) == 6 );
+  ctx.purgeWorkingMemory();
+  delete e;
+}
@@ -22,7 +22,9 @@ TEST_CASE("perf 10000 prims")
           "end loop;\nif b then cnt=cnt+1; end if;\nend loop;\nreturn cnt;"
   );
   e = ctx.parse();
+  double ts = ctx.timestamp();
   REQUIRE( e->run() == 0 );
+  std::cout << "10000 prims in " << ctx.elapsed(ts) << " sec" << std::endl;
   delete e;
   Value * r = ctx.dropReturned();
   REQUIRE( *(r->integer()) == 1230 );
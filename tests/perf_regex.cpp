@@ -0,0 +1,90 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/exception_parse.h>
+#include <blocc/regex_cache.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("perf 1M lines matching a constant pattern")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "n = 0;\n"
+          "for i in 1 to 1000000 loop\n"
+          "line = \"GET /index/\" + str(i) + \" 200\";\n"
+          "if line matches \"GET /[a-z]+/[0-9]*7 200\" then n = n + 1; end if;\n"
+          "end loop;\nreturn n;"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "1M lines matched in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 100000 );
+  delete r;
+  /* the constant pattern is compiled once when parsing */
+  REQUIRE( ctx.regexCached() == false );
+}
+
+TEST_CASE("dynamic pattern through the cache")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "n = 0, p = \"GET /[a-z]+/[0-9]*7 200\";\n"
+          "for i in 1 to 100000 loop\n"
+          "line = \"GET /index/\" + str(i) + \" 200\";\n"
+          "if line matches p then n = n + 1; end if;\n"
+          "end loop;\nreturn n;"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 10000 );
+  delete r;
+  REQUIRE( ctx.regexCached() == true );
+  REQUIRE( ctx.regexCache().misses() == 1 );
+  REQUIRE( ctx.regexCache().hits() == 99999 );
+  ctx.purge();
+  REQUIRE( ctx.regexCached() == false );
+}
+
+TEST_CASE("eviction of the least recently used pattern")
+{
+  RegexCache cache(2);
+  REQUIRE( std::regex_match("abc", cache.get("a.c")) );
+  REQUIRE( std::regex_match("b", cache.get("b+")) );
+  REQUIRE( std::regex_match("abc", cache.get("a.c")) );
+  /* evicts b+ */
+  REQUIRE( std::regex_match("c", cache.get("c?")) );
+  REQUIRE( cache.size() == 2 );
+  REQUIRE( std::regex_match("abc", cache.get("a.c")) );
+  REQUIRE( std::regex_match("bb", cache.get("b+")) );
+  REQUIRE( cache.hits() == 2 );
+  REQUIRE( cache.misses() == 4 );
+  REQUIRE_THROWS_AS( cache.get("[a-"), std::regex_error );
+  REQUIRE( cache.size() == 2 );
+}
+
+TEST_CASE("invalid pattern")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset("b = \"abc\" matches \"[a-\";");
+  try { e = ctx.parse(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+
+  ctx.reset("p = \"[a-\"; b = \"abc\" matches p;");
+  e = ctx.parse();
+  try { e->run(); delete e; FAIL("No throw"); }
+  catch(RuntimeError& re) { delete e; SUCCEED(re.what()); }
+}
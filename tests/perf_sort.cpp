@@ -0,0 +1,51 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/collection.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+#define ROWS 2000000
+
+static bool sorted(Collection * c)
+{
+  for (size_t i = 1; i < c->size(); ++i)
+    if (*(c->at(i - 1).integer()) > *(c->at(i).integer()))
+      return false;
+  return true;
+}
+
+TEST_CASE("perf sort 2M integers")
+{
+  ctx.purge();
+  Executable * e;
+  std::string text("T = tab(0, 0); for i in 1 to ");
+  text.append(std::to_string(ROWS))
+      .append(" loop T.concat((i * 7919) % 1000003); end loop; U = T; V = T;");
+  ctx.reset(text);
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+
+  /* split the parallel sort even on a single core */
+  ctx.parallelism(4);
+  for (const char * s : { "T.sort();", "U.sort(parallel);", "V.topk(100);" })
+  {
+    ctx.reset(s);
+    e = ctx.parse();
+    double ts = ctx.timestamp();
+    REQUIRE( e->run() == 0 );
+    std::cout << s << " of 2M integers in " << ctx.elapsed(ts) << " sec" << std::endl;
+    delete e;
+  }
+  ctx.parallelism(0);
+  REQUIRE( sorted(ctx.loadVariable("T")->collection()) );
+  REQUIRE( sorted(ctx.loadVariable("U")->collection()) );
+  Collection * v = ctx.loadVariable("V")->collection();
+  REQUIRE( *(v->at(0).integer()) == 1000002 );
+}
@@ -0,0 +1,68 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/collection.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("perf insert a table in the middle")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "t = tab(100000, 1); u = tab(100000, 2);\n"
+          "for i in 1 to 10 loop t.insert(t.count() / 2, u); end loop;\n"
+          "return t.count();"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "10 insertions of 100K elements in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 1100000 );
+  delete r;
+}
+
+TEST_CASE("perf 1M deletions at the head")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "q = tab(0, 0); for i in 1 to 1000000 loop q.concat(i); end loop;\n"
+          "n = 0; while q.count() > 0 loop n = n + q.at(0); q.delete(0); end loop;\n"
+          "return n;"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "1M deletions at the head in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 500000500000 );
+  delete r;
+}
+
+TEST_CASE("perf delete a range")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "t = tab(1000000, 1);\n"
+          "for i in 1 to 100 loop t.delete(t.count() / 2, 1000); end loop;\n"
+          "return t.count();"
+  );
+  e = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( e->run() == 0 );
+  std::cout << "100 deletions of 1000 elements in " << ctx.elapsed(ts) << " sec" << std::endl;
+  delete e;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 900000 );
+  delete r;
+}
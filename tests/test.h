@@ -8,6 +8,8 @@
 #include <blocc/parser.h>
 #include <blocc/string_reader.h>
 
+#include <cstdlib>
+
 class TestingContext : public bloc::Context
 {
   bloc::StringReader input;
@@ -18,6 +20,9 @@ public:
   TestingContext () : Context ()
   {
     parser = bloc::Parser::createInteractiveParser(*this, input);
+    /* differential mode: run the same tests with bytecode enabled */
+    if (::getenv("BLOC_TEST_BYTECODE") != nullptr)
+      bytecode(true);
   }
 
   void reset (const std::string &text)
@@ -0,0 +1,172 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/exception_parse.h>
+#include <blocc/hashmap.h>
+#include <blocc/tuple.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("map CTOR")
+{
+  Expression * e;
+  ctx.reset("map(\"\", 0)");
+  e = ctx.parseExpression();
+  REQUIRE( e->typeName(ctx) == "map{ string, integer }" );
+  Value& v = e->value(ctx);
+  REQUIRE( (v.type() == Type::MAPTYPE && v.type().level() == 0) );
+  REQUIRE( v.map()->size() == 0 );
+  REQUIRE( v.map()->key_type() == Type::LITERAL );
+  REQUIRE( v.map()->value_type() == Type::INTEGER );
+  delete e;
+}
+
+TEST_CASE("map CTOR bad type")
+{
+  Expression * e;
+  ctx.reset("map(0.5, 0)");
+  try { e = ctx.parseExpression(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+  ctx.reset("map(0, tup(1, 2))");
+  try { e = ctx.parseExpression(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+}
+
+TEST_CASE("map put at contains")
+{
+  Expression * e;
+  ctx.reset("map(\"\", 0.0).put(\"a\", 1.5).put(\"b\", 2).put(\"a\", 3.5)");
+  e = ctx.parseExpression();
+  Value& v = e->value(ctx); /* value from temporary pool */
+  HashMap * m = v.map();
+  REQUIRE( m->size() == 2 );
+  Value key(Literal("a"));
+  size_t pos = m->find(key);
+  REQUIRE( pos != HashMap::npos );
+  Value val;
+  m->value(pos, val);
+  REQUIRE( *(val.numeric()) == 3.5 );
+  key = Value(Literal("c"));
+  REQUIRE( m->find(key) == HashMap::npos );
+  delete e;
+
+  ctx.reset("map(0, \"\").put(1, \"one\").put(2, \"two\").at(2)");
+  e = ctx.parseExpression();
+  REQUIRE( e->type(ctx) == Type::LITERAL );
+  REQUIRE( *(e->value(ctx).literal()) == "two" );
+  delete e;
+
+  ctx.reset("map(0, \"\").put(1, \"one\").at(3)");
+  e = ctx.parseExpression();
+  REQUIRE( e->value(ctx).isNull() );
+  delete e;
+
+  ctx.reset("map(0, true).put(1, false).contains(1)");
+  e = ctx.parseExpression();
+  REQUIRE( *(e->value(ctx).boolean()) == true );
+  delete e;
+
+  ctx.reset("map(0, true).put(1, false).delete(1).contains(1)");
+  e = ctx.parseExpression();
+  REQUIRE( *(e->value(ctx).boolean()) == false );
+  delete e;
+}
+
+TEST_CASE("map bad key or value")
+{
+  Expression * e;
+  ctx.reset("map(0, 0).put(\"a\", 1)");
+  try { e = ctx.parseExpression(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+  ctx.reset("map(0, 0).put(1, \"a\")");
+  try { e = ctx.parseExpression(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+  ctx.reset("map(\"\", 0).at(1)");
+  try { e = ctx.parseExpression(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+  ctx.reset("map(\"\", 0).contains(1)");
+  try { e = ctx.parseExpression(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+  ctx.reset("map(\"\", 0).concat(1)");
+  try { e = ctx.parseExpression(); delete e; FAIL("No throw"); }
+  catch(ParseError& pe) { SUCCEED(pe.what()); }
+}
+
+TEST_CASE("map delete and rehash")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "m = map(0, 0);\n"
+          "for i in 1 to 1000 loop m.put(i, i * 2); end loop;\n"
+          "for i in 1 to 1000 step 3 loop m.delete(i); end loop;\n"
+          "n = 0; s = 0;\n"
+          "for i in 1 to 1000 loop if m.contains(i) then n = n + 1; s = s + m.at(i); end if; end loop;\n"
+          "return tup(m.count(), n, s);"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  REQUIRE( *(t.at(0).integer()) == 666 );
+  REQUIRE( *(t.at(1).integer()) == 666 );
+  Integer s = 0;
+  for (Integer i = 1; i <= 1000; ++i)
+    if ((i - 1) % 3 != 0)
+      s += i * 2;
+  REQUIRE( *(t.at(2).integer()) == s );
+  delete r;
+}
+
+TEST_CASE("forall over a map")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "m = map(\"\", 0);\n"
+          "m.put(\"a\", 1).put(\"b\", 2).put(\"c\", 3);\n"
+          "u = m;\n"
+          "k = \"\"; forall e in m loop k = k + e@1; e.set@2(e@2 * 10); end loop;\n"
+          "n = 0; forall e in u loop n = n + e@2; end loop;\n"
+          "d = \"\"; forall e in m desc loop d = d + e@1; if e@1 == \"b\" then break; end if; end loop;\n"
+          "return tup(k, d, m.at(\"b\"), n);"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  REQUIRE( *(t.at(0).literal()) == "abc" );
+  REQUIRE( *(t.at(1).literal()) == "cb" );
+  REQUIRE( *(t.at(2).integer()) == 20 );
+  REQUIRE( *(t.at(3).integer()) == 6 );
+  delete r;
+}
+
+TEST_CASE("map passed to a function")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset(
+          "function f(m:map, k:string) return integer is begin\n"
+          "m.put(k, 0); return m.count();\n"
+          "end;\n"
+          "w = map(\"\", 0); w.put(\"a\", 1);\n"
+          "return tup(f(w, \"b\"), w.count(), w.contains(\"b\"));"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  REQUIRE( *(t.at(0).integer()) == 2 );
+  REQUIRE( *(t.at(1).integer()) == 1 );
+  REQUIRE( *(t.at(2).boolean()) == false );
+  delete r;
+}
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/plugin_manager.h>
+#include <blocc/debug.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+#define THREAD_COUNT    16
+#define ROUND_COUNT     4
+
+/* the scripts of the other tests, and the integer they return */
+static const struct { const char * text; Integer result; } scripts[] = {
+  { "cnt=0;\nfor i in 2 to 2000 loop\nb=true;\n"
+    "for j in 2 to i/2 asc loop\nif i%j == 0 then b=false; break; end if;\n"
+    "end loop;\nif b then cnt=cnt+1; end if;\nend loop;\nreturn cnt;", 303 },
+  { "function fib(n) return integer is\n"
+    "begin if n < 2 then return n; end if; return fib(n-1) + fib(n-2); end;\n"
+    "return fib(15);", 610 },
+  { "s = \"\";\nfor i in 1 to 100 loop s = s + str(i % 10); end loop;\n"
+    "return s.count();", 100 },
+  { "t = tab(0, tup(\"\", 0));\n"
+    "for i in 1 to 500 loop t.concat(tup(\"k\" + str(i), i)); end loop;\n"
+    "n = 0;\nforall r in t loop n = n + r@2; end loop;\nreturn n;", 125250 },
+  { "z = (1 + 2 * ii) * (3 - ii);\nreturn int(round(abs(z) * abs(z), 0));", 50 },
+  { "begin\n  raise myerror;\nexception\n"
+    "when divide_by_zero then return 1;\nwhen myerror then return 2;\n"
+    "when others then return 3;\nend; return 0;", 2 },
+  { "n = 0;\nfor i in 1 to 1000 loop\nx = random(10.0);\n"
+    "if x >= 0.0 and x <= 10.0 then n = n + 1; end if;\nend loop;\nreturn n;", 1000 },
+};
+
+static void worker(std::atomic<int> * failures)
+{
+  for (int round = 0; round < ROUND_COUNT; ++round)
+  {
+    /* an independent context per thread */
+    TestingContext tctx;
+    for (auto& script : scripts)
+    {
+      try
+      {
+        tctx.purge();
+        tctx.reset(script.text);
+        Executable * e = tctx.parse();
+        int ret = e->run();
+        delete e;
+        Value * r = tctx.dropReturned();
+        if (ret != 0 || r == nullptr || *(r->integer()) != script.result)
+          ++(*failures);
+        delete r;
+      }
+      catch (Error& err)
+      {
+        (void)err.what();
+        ++(*failures);
+      }
+    }
+    /* the registry of modules is read by all the threads */
+    if (PluginManager::instance().findModuleTypeId("notamodule") != 0)
+      ++(*failures);
+    (void)PluginManager::instance().reportInterfaces();
+    (void)PluginManager::instance().bannedPlugin("notamodule");
+  }
+}
+
+TEST_CASE("run the scripts on 16 threads")
+{
+  std::atomic<int> failures(0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < THREAD_COUNT; ++i)
+    threads.emplace_back(worker, &failures);
+  /* the settings shared by the process can be changed meanwhile */
+  for (int i = 0; i < 100; ++i)
+  {
+    DBGLevel(i % 2 ? DBG_NONE : DBG_ERROR);
+    PluginManager::instance().unbanPlugin("notamodule");
+    PluginManager::instance().clearPermissions();
+  }
+  DBGLevel(DBG_NONE);
+  for (std::thread& t : threads)
+    t.join();
+  REQUIRE( failures.load() == 0 );
+}
+
+TEST_CASE("random sequence per context")
+{
+  TestingContext c1, c2;
+  std::vector<double> s1, s2;
+  for (int i = 0; i < 10; ++i)
+  {
+    s1.push_back(c1.random(1.0));
+    s2.push_back(c2.random(1.0));
+  }
+  REQUIRE( s1 != s2 );
+}
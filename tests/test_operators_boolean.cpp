@@ -97,6 +97,8 @@ TEST_CASE("operator B || B")
   ctx.reset("null || false");
   e = ctx.parseExpression();
   REQUIRE( e->value(ctx).isNull() );
+  /* the null constant is not changed by the evaluation */
+  REQUIRE( e->value(ctx).isNull() );
   delete e;
   ctx.reset("false || null");
   e = ctx.parseExpression();
@@ -76,3 +76,16 @@ TEST_CASE("operator N ** I (POWER)")
   REQUIRE( fequal(*(e->value(ctx).numeric()), 451239450.633787) );
   delete e;
 }
+
+TEST_CASE("operator on variable changing type")
+{
+  /* the operators are parsed with a integer, then a becomes decimal */
+  ctx.reset("a = 2; r = 0.0; for i in 1 to 2 loop r = r + a * 3; b = a < 2.5; a = 2.5; end loop; return r;");
+  Executable * x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Value * r = ctx.dropReturned();
+  REQUIRE( r->type() == Type::NUMERIC );
+  REQUIRE( fequal(*(r->numeric()), 13.5) );
+  delete r;
+}
@@ -0,0 +1,454 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/executable.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+static std::string unparse_expression(const char * text)
+{
+  ctx.reset(text);
+  Expression * e = ctx.parseExpression();
+  std::string str = e->unparse(ctx);
+  delete e;
+  return str;
+}
+
+static std::string unparse_program(Executable * x)
+{
+  FILE * f = ::tmpfile();
+  REQUIRE( f != nullptr );
+  x->unparse(f);
+  std::string str;
+  ::rewind(f);
+  int c;
+  while ((c = ::fgetc(f)) != EOF)
+    str.push_back((char) c);
+  ::fclose(f);
+  return str;
+}
+
+/* run the program with the given level of optimization, and return the
+ * returned value as string */
+static std::string run_program(const std::string& text, unsigned level, double * elapsed = nullptr)
+{
+  ctx.optimization(level);
+  ctx.reset(text);
+  Executable * x = ctx.parse();
+  double ts = ctx.timestamp();
+  REQUIRE( x->run() == 0 );
+  if (elapsed)
+    *elapsed = ctx.elapsed(ts);
+  delete x;
+  Value * r = ctx.dropReturned();
+  ctx.returnCondition(false);
+  std::string str = r->toString();
+  delete r;
+  ctx.optimization(0);
+  return str;
+}
+
+/* count the hidden variables */
+static unsigned hidden_count()
+{
+  unsigned n = 0;
+  for (unsigned id = 0; id < ctx.symbolCount(); ++id)
+  {
+    if (ctx.getSymbol(id).name().front() == Symbol::HIDDEN_QUALIFIER)
+      ++n;
+  }
+  return n;
+}
+
+TEST_CASE("fold constant expressions")
+{
+  ctx.purge();
+  ctx.optimization(0);
+  REQUIRE( unparse_expression("2 * pi / 4") == "2 * pi / 4" );
+  ctx.optimization(1);
+  REQUIRE( unparse_expression("2 * pi / 4") == "1.570796326794897" );
+  REQUIRE( unparse_expression("pow(2, 10)") == "1024" );
+  REQUIRE( unparse_expression("upper(\"abc\") + hex(255)") == "\"ABCff\"" );
+  REQUIRE( unparse_expression("1 + 2 > 2 and not false") == "true" );
+  /* a constant is not folded more */
+  REQUIRE( unparse_expression("pi") == "pi" );
+  /* only the constant subtrees are folded */
+  ctx.reset("x = 3;");
+  Executable * x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  REQUIRE( unparse_expression("x * (2 + 3)") == "X * 5" );
+  REQUIRE( unparse_expression("sqrt(x) + sqrt(16)") == "sqrt(X) + 4.0" );
+  /* the builtins with side effect are not folded */
+  REQUIRE( unparse_expression("random(10) + 1") == "random(10) + 1" );
+  ctx.optimization(0);
+}
+
+TEST_CASE("folding keeps the runtime errors")
+{
+  ctx.purge();
+  ctx.optimization(1);
+  Executable * x;
+  ctx.reset("n = 1 / 0;");
+  x = ctx.parse();
+  REQUIRE_THROWS( x->run() );
+  delete x;
+  ctx.reset("n = num(\"nan\");");
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  REQUIRE( std::isnan(*ctx.loadVariable("N")->numeric()) );
+  ctx.optimization(0);
+}
+
+TEST_CASE("drop unreachable branches")
+{
+  ctx.purge();
+  ctx.optimization(1);
+  Executable * x;
+  ctx.reset(
+          "n = 0;\n"
+          "if false then n = 1;\n"
+          "elsif n > 0 then n = 2;\n"
+          "elsif 1 < 2 then n = 3;\n"
+          "else n = 4;\n"
+          "end if;\n"
+          "if 1 > 2 then n = n + 10; else n = n + 20; end if;\n"
+          "if false then n = 100; end if;\n"
+          "return n;"
+  );
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  std::string str = unparse_program(x);
+  delete x;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 23 );
+  delete r;
+  REQUIRE( str ==
+          "N = 0;\n"
+          "if N > 0 then\n"
+          "    N = 2;\n"
+          "elsif true then\n"
+          "    N = 3;\n"
+          "end if;\n"
+          "if true then\n"
+          "    N = N + 20;\n"
+          "end if;\n"
+          "if false then\n"
+          "    N = 100;\n"
+          "end if;\n"
+          "return N;\n" );
+  ctx.optimization(0);
+}
+
+TEST_CASE("perf folding in a loop")
+{
+  ctx.purge();
+  Executable * x;
+  ctx.reset(
+          "n = 0.0;\n"
+          "for i in 1 to 1000000 loop\n"
+          "  n = n + 2 * pi / 4 * sqrt(pow(2, 10));\n"
+          "  if false then n = 0.0; end if;\n"
+          "end loop;\n"
+          "return n;"
+  );
+  double elapsed[2];
+  Numeric n[2];
+  for (int k = 0; k < 2; ++k)
+  {
+    ctx.optimization(k);
+    x = ctx.parse();
+    double ts = ctx.timestamp();
+    REQUIRE( x->run() == 0 );
+    elapsed[k] = ctx.elapsed(ts);
+    delete x;
+    Value * r = ctx.dropReturned();
+    n[k] = *(r->numeric());
+    ctx.returnCondition(false);
+    delete r;
+    ctx.reset(
+            "n = 0.0;\n"
+            "for i in 1 to 1000000 loop\n"
+            "  n = n + 2 * pi / 4 * sqrt(pow(2, 10));\n"
+            "  if false then n = 0.0; end if;\n"
+            "end loop;\n"
+            "return n;"
+    );
+  }
+  REQUIRE( n[0] == n[1] );
+  std::cout << "1M iterations in " << elapsed[0] << " sec, folded in "
+          << elapsed[1] << " sec" << std::endl;
+  ctx.optimization(0);
+}
+
+TEST_CASE("hoist loop invariants")
+{
+  ctx.purge();
+  const char * text =
+          "x = 2.0; s = \"hello\"; n = 0.0;\n"
+          "for i in 1 to 10 loop\n"
+          "  n = n + sqrt(x) * s.count() + i;\n"
+          "  if abs(sin(i)) > 0.5 then n = n + abs(sin(i)); end if;\n"
+          "end loop;\n"
+          "return n;";
+  std::string r1 = run_program(text, 1);
+  REQUIRE( hidden_count() == 0 );
+  ctx.purge();
+  REQUIRE( run_program(text, 2) == r1 );
+  /* the invariant, and the value shared by the statements of the body */
+  REQUIRE( hidden_count() == 2 );
+  /* the hidden variables are not shown */
+  ctx.optimization(2);
+  ctx.reset("n = 0; for i in 1 to 3 loop n = n + abs(i - 5) * sqrt(4); end loop;");
+  Executable * x = ctx.parse();
+  REQUIRE( unparse_program(x) ==
+          "N = 0;\n"
+          "for I in 1 to 3 loop\n"
+          "    N = N + abs(I - 5) * 2.0;\n"
+          "end loop;\n" );
+  delete x;
+  ctx.optimization(0);
+}
+
+TEST_CASE("keep the expressions written by the loop")
+{
+  const char * texts[] = {
+    /* the variable is written by the body */
+    "x = 1.0; n = 0.0;\n"
+    "for i in 1 to 10 loop n = n + sqrt(x); x = x + 1.0; end loop;\n"
+    "return n;",
+    /* the variable is written by an inner loop */
+    "x = 1.0; n = 0.0;\n"
+    "for i in 1 to 5 loop\n"
+    "  n = n + sqrt(x) + sqrt(i);\n"
+    "  for j in 1 to 2 loop x = x + sqrt(i); n = n + sqrt(x) + sqrt(i); end loop;\n"
+    "  n = n + sqrt(i);\n"
+    "end loop;\n"
+    "return n;",
+    /* the table is updated by the body */
+    "t = tab(1, 0); n = 0;\n"
+    "while t.count() < 10 loop n = n + t.count() * 2; t.concat(n); end loop;\n"
+    "return n;",
+    /* the count is not changed by the update of an element */
+    "t = tab(10, 1); n = 0;\n"
+    "forall e in t loop n = n + abs(t.count() - e); e = n; end loop;\n"
+    "return tup(n, t.at(9));",
+    /* the element pointed to by the iterator is updated by an inner loop */
+    "t = tab(10, 1); n = 0;\n"
+    "forall e in t loop for j in 1 to 3 loop n = n + abs(e - 10); e = e + j; end loop; end loop;\n"
+    "return tup(n, t.at(9));",
+    /* the variable read by the condition */
+    "s = \"abcdef\"; n = 0;\n"
+    "while s.count() > 0 loop n = n + strlen(s); s = substr(s, 1); end loop;\n"
+    "return n;",
+  };
+  for (const char * text : texts)
+  {
+    ctx.purge();
+    std::string r1 = run_program(text, 1);
+    ctx.purge();
+    REQUIRE( run_program(text, 2) == r1 );
+  }
+}
+
+TEST_CASE("share the common subexpressions")
+{
+  ctx.purge();
+  ctx.optimization(2);
+  ctx.reset("x = 4.0;");
+  Executable * x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Expression * e;
+  ctx.reset("sqrt(x) * sqrt(x) + abs(sqrt(x) - 1)");
+  e = ctx.parseExpression();
+  REQUIRE( hidden_count() == 1 );
+  REQUIRE( *(e->value(ctx).numeric()) == 5.0 );
+  /* the value is released before the next evaluation */
+  ctx.storeVariable(ctx.findSymbol("X")->id(), Value(Numeric(9.0)));
+  REQUIRE( *(e->value(ctx).numeric()) == 11.0 );
+  REQUIRE( e->unparse(ctx) == "sqrt(X) * sqrt(X) + abs(sqrt(X) - 1)" );
+  delete e;
+  ctx.optimization(0);
+}
+
+TEST_CASE("hoisting in functions")
+{
+  const char * text =
+          "function f(x, k) return decimal is begin\n"
+          "  n = 0.0;\n"
+          "  for i in 1 to k loop\n"
+          "    n = n + sqrt(x) + sqrt(i);\n"
+          "    if k > 1 then n = n + f(x + 1.0, k - 1) + sqrt(i); end if;\n"
+          "  end loop;\n"
+          "  return n;\n"
+          "end;\n"
+          "m = 0.0;\n"
+          "for j in 1 to 3 loop m = m + f(j, 4); end loop;\n"
+          "return m;";
+  ctx.purge();
+  std::string r1 = run_program(text, 1);
+  ctx.purge();
+  REQUIRE( run_program(text, 2) == r1 );
+}
+
+TEST_CASE("hoisting in a parallel forall")
+{
+  const char * text =
+          "a = tab(1000, 0);\n"
+          "for i in 0 to a.count() - 1 loop a.put(i, i); end loop;\n"
+          "x = 4.0; s = 0.0;\n"
+          "forall i in a parallel reduce s loop\n"
+          "  for j in 1 to 3 loop s = s + sqrt(x) * a.count() + sqrt(j * j) + sqrt(j * j); end loop;\n"
+          "  s = s + sqrt(x);\n"
+          "end loop;\n"
+          "return s;";
+  ctx.purge();
+  ctx.parallelism(4);
+  std::string r1 = run_program(text, 1);
+  ctx.purge();
+  /* the sums of integral values are exact */
+  std::string r2 = run_program(text, 2);
+  ctx.parallelism(0);
+  REQUIRE( r1 == r2 );
+}
+
+TEST_CASE("parse error in a loop")
+{
+  ctx.purge();
+  ctx.optimization(2);
+  Executable * x;
+  ctx.reset("x = 1.0; for i in 1 to 3 loop while sqrt(x) > 2 loop x = ; end loop; end loop;");
+  REQUIRE_THROWS( ctx.parse() );
+  /* the next parse is not in the loop */
+  ctx.reset("x = 4.0; n = 0.0; for i in 1 to 3 loop n = n + sqrt(x); end loop; return n;");
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->numeric()) == 6.0 );
+  ctx.returnCondition(false);
+  delete r;
+  ctx.optimization(0);
+}
+
+TEST_CASE("perf hoisting in a loop")
+{
+  const char * text =
+          "x = 2.0; s = \"hello world\"; n = 0.0;\n"
+          "for i in 1 to 1000000 loop\n"
+          "  n = n + sqrt(x) * s.count() + i;\n"
+          "  if abs(sin(i)) > 0.5 then n = n + abs(sin(i)); end if;\n"
+          "end loop;\n"
+          "return n;";
+  double elapsed[2];
+  ctx.purge();
+  std::string r1 = run_program(text, 1, &elapsed[0]);
+  ctx.purge();
+  REQUIRE( run_program(text, 2, &elapsed[1]) == r1 );
+  std::cout << "1M iterations in " << elapsed[0] << " sec, hoisted in "
+          << elapsed[1] << " sec" << std::endl;
+}
+
+TEST_CASE("inline small functions")
+{
+  const char * text =
+          "function sq(x) return integer is begin return x * x; end;\n"
+          "function mix(a, b, c) return decimal is begin return a + b * 2 + c; end;\n"
+          "function len(s) return integer is begin return s.count(); end;\n"
+          "function inc(count) return integer is begin return count + 1; end;\n"
+          "function one() return integer is begin return 1; end;\n"
+          "return str(sq(7)) + \",\" + str(mix(1, 2.5, 3)) + \",\" + str(len(\"hello\")) + \",\" + str(inc(4))\n"
+          "  + \",\" + str(one()) + \",\" + str(sq(sq(2))) + \",\" + str(sq(mix(1, 1, 1)));";
+  ctx.purge();
+  std::string r0 = run_program(text, 0);
+  REQUIRE( hidden_count() == 0 );
+  ctx.purge();
+  REQUIRE( run_program(text, 1) == r0 );
+  /* a hidden variable by parameter of each call */
+  REQUIRE( hidden_count() == 12 );
+  /* the call is unparsed as written */
+  ctx.optimization(1);
+  REQUIRE( unparse_expression("sq(2 + 1)") == "SQ(3)" );
+  ctx.optimization(0);
+}
+
+TEST_CASE("inlined arguments are evaluated once")
+{
+  const char * text =
+          "function twice(x) return integer is begin return x + x; end;\n"
+          "function none(x) return integer is begin return 0; end;\n"
+          "t = tab(0, 0);\n"
+          "r = twice(t.concat(7).count());\n"
+          "s = none(t.concat(8).count());\n"
+          "return r * 100 + s * 10 + t.count();";
+  ctx.purge();
+  REQUIRE( run_program(text, 1) == "integer 202" );
+  REQUIRE( hidden_count() == 2 );
+  ctx.purge();
+  REQUIRE( run_program(text, 2) == "integer 202" );
+}
+
+TEST_CASE("functions not inlined")
+{
+  const char * text =
+          "function down(n) return boolean is begin return n <= 0 || down(n - 1); end;\n"
+          "function two(x) return integer is begin y = x * 2; return y; end;\n"
+          "function safe(x) return integer is begin return 1 / x; exception when divide_by_zero then return 0; end;\n"
+          "function big(x) return integer is begin return x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x; end;\n"
+          "return str(down(5)) + \",\" + str(two(3)) + \",\" + str(safe(0)) + \",\" + str(big(1));";
+  ctx.purge();
+  std::string r0 = run_program(text, 0);
+  ctx.purge();
+  REQUIRE( run_program(text, 1) == r0 );
+  REQUIRE( hidden_count() == 0 );
+}
+
+TEST_CASE("redefined function is not inlined anymore")
+{
+  Executable * x;
+  ctx.purge();
+  ctx.optimization(1);
+  ctx.reset("function f(x) return integer is begin return x + 1; end;");
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  ctx.reset("f(2) * 10");
+  Expression * e = ctx.parseExpression();
+  REQUIRE( hidden_count() == 1 );
+  REQUIRE( *(e->value(ctx).integer()) == 30 );
+  ctx.purgeWorkingMemory();
+  /* the interactive session replaces the function */
+  ctx.reset("function f(x) return integer is begin return x + 2; end;");
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  REQUIRE( *(e->value(ctx).integer()) == 40 );
+  ctx.purgeWorkingMemory();
+  delete e;
+  ctx.optimization(0);
+}
+
+TEST_CASE("perf inlined calls")
+{
+  const char * text =
+          "function sq(x) return integer is begin return x * x; end;\n"
+          "n = 0;\n"
+          "for i in 1 to 1000000 loop n = n + sq(i % 100); end loop;\n"
+          "return n;";
+  double elapsed[2];
+  ctx.purge();
+  std::string r0 = run_program(text, 0, &elapsed[0]);
+  ctx.purge();
+  REQUIRE( run_program(text, 1, &elapsed[1]) == r0 );
+  std::cout << "1M calls in " << elapsed[0] << " sec, inlined in "
+          << elapsed[1] << " sec" << std::endl;
+}
@@ -92,3 +92,29 @@ TEST_CASE("string")
           "\"/\\\\@$^~|_.+-=#012345679\\\"ABCDEFGHIJKLMNOPQRSTUVWXYZ\\\"\\a\\b\\f\\n\\r\\t\\\\\"" );
   delete e;
 }
+
+TEST_CASE("interned string")
+{
+  Expression * e1, * e2;
+  ctx.reset("\"abc\"");
+  e1 = ctx.parseExpression();
+  ctx.reset("\"abc\"");
+  e2 = ctx.parseExpression();
+  REQUIRE( &(e1->value(ctx)) == &(e2->value(ctx)) );
+  REQUIRE( e1->value(ctx).lvalue() );
+  delete e1;
+  REQUIRE( *(e2->value(ctx).literal()) == "abc" );
+  delete e2;
+
+  Executable * e;
+  ctx.reset("a=\"abc\"; a.concat(\"def\"); b=\"abc\".concat(\"xyz\"); c=\"abc\";\n"
+            "d=\"a string longer than the inline buffer\"; f=d; d.concat(\"!\");\n");
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  REQUIRE( *(ctx.loadVariable("A")->literal()) == "abcdef" );
+  REQUIRE( *(ctx.loadVariable("B")->literal()) == "abcxyz" );
+  REQUIRE( *(ctx.loadVariable("C")->literal()) == "abc" );
+  REQUIRE( *(ctx.loadVariable("D")->literal()) == "a string longer than the inline buffer!" );
+  REQUIRE( *(ctx.loadVariable("F")->literal()) == "a string longer than the inline buffer" );
+}
@@ -0,0 +1,181 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/profiler.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+/* find the entry of the statement at the given line, knowing that the
+ * testing context prepends a new line to the source */
+static const Profiler::Entry * find_line(const std::vector<Profiler::Entry>& v, unsigned line)
+{
+  for (const Profiler::Entry& e : v)
+    if (e.kind == Profiler::STATEMENT && e.line == line)
+      return &e;
+  return nullptr;
+}
+
+static const Profiler::Entry * find_function(const std::vector<Profiler::Entry>& v, const char * label)
+{
+  for (const Profiler::Entry& e : v)
+    if (e.kind == Profiler::FUNCTION && e.label == label)
+      return &e;
+  return nullptr;
+}
+
+TEST_CASE("profile of statements and functions")
+{
+  ctx.purge();
+  Executable * x;
+  ctx.reset(
+          "function f(a) return string is begin\n"
+          "  return str(a) + \"!\";\n"
+          "end;\n"
+          "n = 0;\n"
+          "for i in 1 to 100 loop\n"
+          "  n = n + f(i).count();\n"
+          "end loop;\n"
+          "return n;"
+  );
+  x = ctx.parse();
+  ctx.profile(true);
+  REQUIRE( ctx.profile() );
+  REQUIRE( x->run() == 0 );
+  std::vector<Profiler::Entry> v = ctx.profiler()->entries();
+  delete x;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 192 + 100 );
+  delete r;
+
+  const Profiler::Entry * e;
+  e = find_function(v, "F/1");
+  REQUIRE( e != nullptr );
+  REQUIRE( e->count == 100 );
+  REQUIRE( e->allocs > 0 );
+  /* the function allocates only in its statements */
+  REQUIRE( e->self_allocs == 0 );
+  const Profiler::Entry * f = e;
+  e = find_line(v, 3);
+  REQUIRE( e != nullptr );
+  REQUIRE( e->label == "return" );
+  REQUIRE( e->count == 100 );
+  REQUIRE( e->allocs == f->allocs );
+  e = find_line(v, 5);
+  REQUIRE( e != nullptr );
+  REQUIRE( e->count == 1 );
+  e = find_line(v, 7);
+  REQUIRE( e != nullptr );
+  REQUIRE( e->count == 100 );
+  /* the call is included, but not in the exclusive counters */
+  REQUIRE( e->allocs > f->allocs );
+  REQUIRE( e->self_allocs == e->allocs - f->allocs );
+  REQUIRE( e->total >= f->total );
+  /* the loop includes its body */
+  e = find_line(v, 6);
+  REQUIRE( e != nullptr );
+  REQUIRE( e->allocs >= find_line(v, 7)->allocs );
+  /* sorted by exclusive time */
+  for (size_t i = 1; i < v.size(); ++i)
+    REQUIRE( v[i - 1].self >= v[i].self );
+  for (const Profiler::Entry& e : v)
+  {
+    REQUIRE( e.self_allocs <= e.allocs );
+    REQUIRE( e.self <= e.total );
+  }
+  /* the purge disables the profiler */
+  ctx.purge();
+  REQUIRE( !ctx.profile() );
+  REQUIRE( ctx.profiler() == nullptr );
+}
+
+TEST_CASE("profile of a failed run")
+{
+  ctx.purge();
+  Executable * x;
+  ctx.reset(
+          "function f(a) return integer is begin\n"
+          "  return 10 / a;\n"
+          "end;\n"
+          "n = f(1);\n"
+          "n = f(0);\n"
+  );
+  x = ctx.parse();
+  ctx.profile(true);
+  REQUIRE_THROWS( x->run() );
+  delete x;
+  /* the frames are unwound, a next run is accounted */
+  ctx.reset("n = 1;\nn = n + 1;\n");
+  x = ctx.parse();
+  ctx.profile(true);
+  REQUIRE( ctx.profiler()->size() == 0 );
+  REQUIRE( x->run() == 0 );
+  std::vector<Profiler::Entry> v = ctx.profiler()->entries();
+  delete x;
+  REQUIRE( v.size() == 2 );
+  REQUIRE( find_line(v, 2)->count == 1 );
+  REQUIRE( find_line(v, 3)->count == 1 );
+  ctx.profile(false);
+  REQUIRE( !ctx.profile() );
+}
+
+TEST_CASE("profile of a parallel loop")
+{
+  ctx.purge();
+  Executable * x;
+  ctx.parallelism(4);
+  ctx.reset(
+          "t = tab(1000, 1);\n"
+          "forall e in t parallel loop\n"
+          "  e = e + 1;\n"
+          "end loop;\n"
+          "return t.at(999);"
+  );
+  x = ctx.parse();
+  ctx.profile(true);
+  REQUIRE( x->run() == 0 );
+  std::vector<Profiler::Entry> v = ctx.profiler()->entries();
+  delete x;
+  Value * r = ctx.dropReturned();
+  REQUIRE( *(r->integer()) == 2 );
+  delete r;
+  /* the workers are not profiled, the loop is */
+  REQUIRE( find_line(v, 3) != nullptr );
+  REQUIRE( find_line(v, 4) == nullptr );
+  ctx.parallelism(0);
+  ctx.profile(false);
+}
+
+TEST_CASE("perf profiling overhead")
+{
+  ctx.purge();
+  Executable * x;
+  ctx.reset(
+          "function f(a) return integer is begin return a + 1; end;\n"
+          "n = 0;\n"
+          "for i in 1 to 500000 loop n = f(n); end loop;\n"
+          "return n;"
+  );
+  x = ctx.parse();
+  double elapsed[2];
+  for (int k = 0; k < 2; ++k)
+  {
+    ctx.profile(k == 1);
+    double ts = ctx.timestamp();
+    REQUIRE( x->run() == 0 );
+    elapsed[k] = ctx.elapsed(ts);
+    Value * r = ctx.dropReturned();
+    REQUIRE( *(r->integer()) == 500000 );
+    ctx.returnCondition(false);
+    delete r;
+  }
+  ctx.profiler()->report(stdout);
+  ctx.profile(false);
+  delete x;
+  std::cout << "500K calls in " << elapsed[0] << " sec, profiled in "
+          << elapsed[1] << " sec" << std::endl;
+}
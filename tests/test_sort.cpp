@@ -0,0 +1,169 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/exception_parse.h>
+#include <blocc/collection.h>
+#include <blocc/tuple.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+TEST_CASE("sort table of integer")
+{
+  Expression * e;
+  ctx.reset("tab(0, 0).concat(5).concat(3).concat(int()).concat(9).concat(1).sort()");
+  e = ctx.parseExpression();
+  REQUIRE( e->unparse(ctx) == "tab(0, 0).concat(5).concat(3).concat(int()).concat(9).concat(1).sort(asc)" );
+  Collection * c = e->value(ctx).collection();
+  REQUIRE( c->size() == 5 );
+  /* nulls come first in ascending order */
+  REQUIRE( c->at(0).isNull() );
+  REQUIRE( *(c->at(1).integer()) == 1 );
+  REQUIRE( *(c->at(2).integer()) == 3 );
+  REQUIRE( *(c->at(3).integer()) == 5 );
+  REQUIRE( *(c->at(4).integer()) == 9 );
+  delete e;
+
+  ctx.reset("tab(0, 0).concat(5).concat(int()).concat(9).concat(1).sort(desc)");
+  e = ctx.parseExpression();
+  c = e->value(ctx).collection();
+  REQUIRE( *(c->at(0).integer()) == 9 );
+  REQUIRE( *(c->at(2).integer()) == 1 );
+  REQUIRE( c->at(3).isNull() );
+  delete e;
+}
+
+TEST_CASE("sort table of decimal and string")
+{
+  Expression * e;
+  ctx.reset("tab(0, 0.0).concat(2.5).concat(num(\"nan\")).concat(-1.0).sort()");
+  e = ctx.parseExpression();
+  Collection * c = e->value(ctx).collection();
+  REQUIRE( *(c->at(0).numeric()) == -1.0 );
+  REQUIRE( *(c->at(1).numeric()) == 2.5 );
+  REQUIRE( std::isnan(*(c->at(2).numeric())) );
+  delete e;
+
+  ctx.reset("tab(0, \"\").concat(\"pear\").concat(\"apple\").concat(\"fig\").sort(desc)");
+  e = ctx.parseExpression();
+  c = e->value(ctx).collection();
+  REQUIRE( c->at(0).literal()->compare("pear") == 0 );
+  REQUIRE( c->at(1).literal()->compare("fig") == 0 );
+  REQUIRE( c->at(2).literal()->compare("apple") == 0 );
+  delete e;
+}
+
+TEST_CASE("sort table of tuple by column")
+{
+  Executable * x;
+  ctx.purge();
+  ctx.reset(
+          "r = tab(0, tup(0, \"\"));\n"
+          "r.concat(tup(3, \"c\")).concat(tup(1, \"a\")).concat(tup(2, \"b\")).concat(tup(1, \"z\"));\n"
+          "u = r;\n"
+          "r.sort(1);\n"
+          "return tup(r.at(0)@2, r.at(1)@2, r.at(3)@2, u.at(0)@2, r.bsearch(1, 2), r.bsearch(1, 4));"
+  );
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  /* the sort is stable */
+  REQUIRE( t.at(0).literal()->compare("a") == 0 );
+  REQUIRE( t.at(1).literal()->compare("z") == 0 );
+  REQUIRE( t.at(2).literal()->compare("c") == 0 );
+  /* the shared copy is unchanged */
+  REQUIRE( t.at(3).literal()->compare("c") == 0 );
+  REQUIRE( *(t.at(4).integer()) == 2 );
+  REQUIRE( t.at(5).isNull() );
+  delete r;
+}
+
+TEST_CASE("sort columnar table")
+{
+  ctx.purge();
+  Executable * x;
+  ctx.reset("C = tab(0, tup(0, \"\", 0.0));");
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Collection * c = ctx.loadVariable("C")->collection();
+  REQUIRE( c->make_columnar() );
+  Collection::container_t row;
+  for (int i = 0; i < 100; ++i)
+  {
+    row.reserve(3);
+    row.push_back(Value(Integer((i * 37) % 100)));
+    row.push_back(Value(Literal(std::to_string(i))));
+    row.push_back(Value(Numeric(i)));
+    c->push_row(row);
+  }
+  ctx.reset("C.sort(1, desc); n = C.bsearch(1, 97, desc); C.topk(3, 2, asc); return n;");
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Value * r = ctx.dropReturned();
+  c = ctx.loadVariable("C")->collection();
+  REQUIRE( c->columnar() );
+  REQUIRE( *(r->integer()) == 2 );
+  /* the top rows sorted on decimal */
+  Value v = c->row(0);
+  REQUIRE( *(v.tuple()->at(0).integer()) == 0 );
+  REQUIRE( *(v.tuple()->at(2).numeric()) == 0.0 );
+  v = c->row(1);
+  REQUIRE( *(v.tuple()->at(0).integer()) == 37 );
+  delete r;
+}
+
+TEST_CASE("topk and bsearch")
+{
+  Executable * x;
+  ctx.purge();
+  ctx.reset(
+          "k = tab(0, 0); for i in 1 to 20 loop k.concat((i * 7) % 20); end loop;\n"
+          "k.topk(3); a = tup(k.at(0), k.at(1), k.at(2));\n"
+          "k.sort(desc);\n"
+          "return tup(a@1, a@2, a@3, k.bsearch(19, desc), k.bsearch(0, desc), k.bsearch(int()));"
+  );
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  REQUIRE( *(t.at(0).integer()) == 19 );
+  REQUIRE( *(t.at(1).integer()) == 18 );
+  REQUIRE( *(t.at(2).integer()) == 17 );
+  REQUIRE( *(t.at(3).integer()) == 0 );
+  REQUIRE( *(t.at(4).integer()) == 19 );
+  REQUIRE( t.at(5).isNull() );
+  delete r;
+}
+
+TEST_CASE("sort bad argument")
+{
+  Expression * e;
+  const char * bad[] = {
+    "tab(2, tup(1, \"\")).sort()",
+    "tab(2, 1).sort(1)",
+    "tab(2, 1 + 2 * ii).sort()",
+    "tab(2, 1).sort(asc, desc)",
+    "tab(2, 1).bsearch(\"a\")",
+    "tab(2, 1).topk(\"a\")",
+  };
+  for (const char * s : bad)
+  {
+    ctx.reset(s);
+    try { e = ctx.parseExpression(); delete e; FAIL(s); }
+    catch(ParseError& pe) { SUCCEED(pe.what()); }
+  }
+  ctx.reset("tab(2, tup(1, \"\")).sort(3)");
+  e = ctx.parseExpression();
+  try { e->value(ctx); FAIL("No throw"); }
+  catch(RuntimeError& re) { SUCCEED(re.what()); }
+  delete e;
+}
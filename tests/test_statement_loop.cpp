@@ -286,3 +286,102 @@ TEST_CASE("Table constness in forall loop")
     SUCCEED(er.what());
   }
 }
+
+TEST_CASE("parallel forall loop")
+{
+  ctx.purge();
+  ctx.parallelism(4);
+  Executable * e;
+  ctx.reset(
+    "a=tab(10000, 0);\n"
+    "for i in 0 to a.count()-1 loop a.put(i, i); end loop;\n"
+    "function sq(x) return integer is begin return x * x; end;\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+
+  ctx.reset(
+    "s=0, d=0.0, z=0*ii;\n"
+    "forall i in a parallel reduce s, d, z loop\n"
+    "  k = sq(i); s = s + k; d = d + 0.5; z = z + ii; i = k;\n"
+    "end loop;\n"
+    "t=0;\n"
+    "forall i in a loop t=t+i; end loop;\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  REQUIRE( *(ctx.loadVariable("S")->integer()) == 333283335000 );
+  REQUIRE( *(ctx.loadVariable("T")->integer()) == 333283335000 );
+  REQUIRE( fequal(*(ctx.loadVariable("D")->numeric()), 5000.0) );
+  REQUIRE( fequal(ctx.loadVariable("Z")->imaginary()->b, 10000.0) );
+  /* the private variables are not merged */
+  REQUIRE( ctx.loadVariable("K")->isNull() );
+
+  ctx.reset(
+    "n=0;\n"
+    "forall i in tab(100, tab(10, 1)) parallel reduce n loop\n"
+    "  forall j in i loop if j > 0 then continue; end if; n = n - 1; end loop;\n"
+    "  n = n + i.count();\n"
+    "end loop;\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  REQUIRE( *(ctx.loadVariable("N")->integer()) == 1000 );
+
+  ctx.reset("forall i in a parallel loop break; end loop;\n");
+  e = ctx.parse();
+  try { e->run(); delete e; FAIL("No throw"); }
+  catch(RuntimeError& re) { delete e; SUCCEED(re.what()); }
+
+  ctx.reset("forall i in a parallel loop i = 100 / (i - 4900); end loop;\n");
+  e = ctx.parse();
+  try { e->run(); delete e; FAIL("No throw"); }
+  catch(RuntimeError& re) { delete e; REQUIRE( re.no == EXC_RT_DIVIDE_BY_ZERO ); }
+  ctx.parallelism(0);
+}
+
+TEST_CASE("Shared state in parallel forall loop")
+{
+  ctx.purge();
+  Executable * e;
+  ctx.reset("a=tab(10, 1), b=tab(10, 1), s=0, l=\"abc\";\n");
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+
+  const char * bodies[] = {
+    "forall i in a parallel loop s = s + i; end loop;\n",
+    "forall i in a parallel loop b.put(0, i); end loop;\n",
+    "forall i in a parallel loop a.put(0, i); end loop;\n",
+    "forall i in a parallel reduce s loop s = \"abc\"; end loop;\n",
+    "forall i in a parallel reduce l loop nop; end loop;\n",
+    "forall i in a parallel reduce i loop nop; end loop;\n",
+    "forall i in a desc parallel loop nop; end loop;\n",
+  };
+  for (const char * body : bodies)
+  {
+    ctx.reset(body);
+    try {
+      e = ctx.parse();
+      delete e;
+      FAIL("Compilation should fail.");
+    }
+    catch(Error& er) {
+      std::cout << "\t=> " << er.what() << std::endl;
+      SUCCEED(er.what());
+    }
+  }
+
+  /* the symbols are unlocked after parsing */
+  ctx.reset(
+    "forall i in a parallel loop x = i + s; end loop;\n"
+    "s = 1; b.put(0, 2);\n"
+  );
+  e = ctx.parse();
+  REQUIRE( e->run() == 0 );
+  delete e;
+  REQUIRE( *(ctx.loadVariable("S")->integer()) == 1 );
+}
@@ -129,6 +129,58 @@ TEST_CASE("tab delete row")
   delete e;
 }
 
+TEST_CASE("tab delete range")
+{
+  Expression * e;
+  ctx.reset("tab(0, 0).concat(0).concat(1).concat(2).concat(3).concat(4).delete(1, 2)");
+  e = ctx.parseExpression();
+  REQUIRE( e->unparse(ctx) == "tab(0, 0).concat(0).concat(1).concat(2).concat(3).concat(4).delete(1, 2)" );
+  Collection * c = e->value(ctx).collection();
+  REQUIRE( c->size() == 3 );
+  REQUIRE( *(c->at(1).integer()) == 3 );
+  delete e;
+  /* the count is bounded by the end of table */
+  ctx.reset("tab(10, 0).delete(8, 100)");
+  e = ctx.parseExpression();
+  REQUIRE( e->value(ctx).collection()->size() == 8 );
+  delete e;
+  ctx.reset("\"abcdef\".delete(1, 3)");
+  e = ctx.parseExpression();
+  REQUIRE( *(e->value(ctx).literal()) == "aef" );
+  delete e;
+  ctx.reset("tab(10, 0).delete(8, -1)");
+  e = ctx.parseExpression();
+  try { e->value(ctx); FAIL("No throw"); }
+  catch(RuntimeError& re) { SUCCEED(re.what()); }
+  delete e;
+}
+
+TEST_CASE("tab as a queue")
+{
+  Executable * x;
+  ctx.purge();
+  ctx.reset(
+          "q = tab(0, 0); for i in 1 to 100 loop q.concat(i); end loop;\n"
+          "n = 0; while q.count() > 10 loop n = n + q.at(0); q.delete(0); end loop;\n"
+          "q.insert(0, 0); q.insert(0, tab(2, -1)); q.insert(5, q);\n"
+          "return tup(n, q.count(), q.at(0), q.at(2), q.at(3), q.at(5), q.at(18), q.at(25));"
+  );
+  x = ctx.parse();
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Value * r = ctx.dropReturned();
+  Tuple& t = *(r->tuple());
+  REQUIRE( *(t.at(0).integer()) == 90 * 91 / 2 );
+  REQUIRE( *(t.at(1).integer()) == 26 );
+  REQUIRE( *(t.at(2).integer()) == -1 );
+  REQUIRE( *(t.at(3).integer()) == 0 );
+  REQUIRE( *(t.at(4).integer()) == 91 );
+  REQUIRE( *(t.at(5).integer()) == -1 );
+  REQUIRE( *(t.at(6).integer()) == 93 );
+  REQUIRE( *(t.at(7).integer()) == 100 );
+  delete r;
+}
+
 TEST_CASE("table type mixing")
 {
   Expression * e;
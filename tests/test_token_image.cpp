@@ -0,0 +1,119 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdio>
+
+#include <test.h>
+#include <hashvalue.c>
+#include <blocc/exception_parse.h>
+#include <blocc/token_image.h>
+
+TestingContext ctx;
+
+using namespace bloc;
+
+#define SOURCE_PATH "test_token_image.bs"
+#define IMAGE_PATH  "test_token_image.bs.img"
+
+static void write_source(const char * text)
+{
+  FILE * f = ::fopen(SOURCE_PATH, "wb");
+  REQUIRE( f != nullptr );
+  ::fputs(text, f);
+  ::fclose(f);
+}
+
+static Integer run_returned(Executable * x)
+{
+  REQUIRE( x->run() == 0 );
+  delete x;
+  Value * r = ctx.dropReturned();
+  Integer n = *(r->integer());
+  delete r;
+  return n;
+}
+
+TEST_CASE("replay the image of a source")
+{
+  ctx.purge();
+  const char * text =
+          "function f(a) return integer is begin return a * 2; end;\n"
+          "s = \"a;b // c\"; /* comment */ n = 0;\n"
+          "for i in 1 to 10 loop n = n + f(i); end loop;\n"
+          "return n + s.count();";
+  write_source(text);
+  TokenImage::Signature sig;
+  REQUIRE( TokenImage::sign(SOURCE_PATH, sig) );
+  REQUIRE( sig.size == ::strlen(text) );
+
+  TokenImage image;
+  StringReader reader(text);
+  Executable * x = Parser::compile(ctx, reader, image);
+  REQUIRE( image.size() > 0 );
+  REQUIRE( run_returned(x) == 118 );
+  REQUIRE( image.save(IMAGE_PATH, sig) );
+
+  ctx.purge();
+  TokenImage loaded;
+  REQUIRE( loaded.load(IMAGE_PATH, sig) );
+  REQUIRE( loaded.size() == image.size() );
+  x = Parser::parse(ctx, loaded);
+  REQUIRE( run_returned(x) == 118 );
+  /* the image can be replayed again */
+  ctx.purge();
+  x = Parser::parse(ctx, loaded);
+  REQUIRE( run_returned(x) == 118 );
+}
+
+TEST_CASE("stale image")
+{
+  ctx.purge();
+  write_source("return 1;");
+  TokenImage::Signature sig;
+  REQUIRE( TokenImage::sign(SOURCE_PATH, sig) );
+  TokenImage image;
+  StringReader reader("return 1;");
+  delete Parser::compile(ctx, reader, image);
+  REQUIRE( image.save(IMAGE_PATH, sig) );
+
+  /* the source is changed */
+  write_source("return 2;");
+  TokenImage::Signature other;
+  REQUIRE( TokenImage::sign(SOURCE_PATH, other) );
+  REQUIRE( !(other == sig) );
+  REQUIRE( !image.load(IMAGE_PATH, other) );
+  REQUIRE( image.size() == 0 );
+
+  /* the image is truncated */
+  FILE * f = ::fopen(IMAGE_PATH, "r+b");
+  REQUIRE( f != nullptr );
+  ::fseek(f, 0, SEEK_END);
+  long len = ::ftell(f);
+  ::fclose(f);
+  std::string data(len - 1, '\0');
+  f = ::fopen(IMAGE_PATH, "rb");
+  REQUIRE( ::fread(&data[0], 1, data.size(), f) == data.size() );
+  ::fclose(f);
+  f = ::fopen(IMAGE_PATH, "wb");
+  ::fwrite(data.data(), 1, data.size(), f);
+  ::fclose(f);
+  REQUIRE( !image.load(IMAGE_PATH, sig) );
+
+  ::remove(IMAGE_PATH);
+  ::remove(SOURCE_PATH);
+  REQUIRE( !TokenImage::sign(SOURCE_PATH, sig) );
+  REQUIRE( !image.load(IMAGE_PATH, sig) );
+}
+
+TEST_CASE("parse error replaying an image")
+{
+  ctx.purge();
+  TokenImage image;
+  StringReader reader("a = 1;\nb = a +;");
+  try { delete Parser::compile(ctx, reader, image); FAIL("No throw"); }
+  catch (ParseError& pe) { SUCCEED(pe.what()); }
+  /* the error is located as in the source */
+  ctx.purge();
+  try { delete Parser::parse(ctx, image); FAIL("No throw"); }
+  catch (ParseError& pe) { REQUIRE( pe.token->line == 2 ); }
+}